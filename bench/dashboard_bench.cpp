@@ -0,0 +1,591 @@
+/******************************************************************************
+ * dashboard_bench.cpp
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Offscreen rendering benchmark of the instruments
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+/**************************************************************************
+ * How to use:                                                            *
+ *                                                                        *
+ * Built with cmake -DDASHBOARD_BENCH=ON (needs DASHBOARD_HOST_SHIM).     *
+ *   xvfb-run ./dashboard_bench [output.json [frames]]                    *
+ * Every instrument class is created in a hidden frame and drawn          *
+ * 'frames' times (default 200) into a wxMemoryDC / wxGCDC at each of     *
+ * BENCH_WIDTHS, with random input values before every frame. Warm        *
+ * frames keep the cached drawings as the dashboard does, cold frames     *
+ * call ResetCache() before each one. For dials the cold frames are also  *
+ * split into the draw phases. Last the compass rose is drawn directly    *
+ * and through CompassRoseSprite. All times are in us per frame, written  *
+ * to output.json (default dashboard_bench.json) and printed.             *
+ * The instruments are wxControls, so a display is needed, Xvfb will do.  *
+ * Inputs use a fixed seed, results of two builds are comparable. The     *
+ * history instruments keep their files in a new temporary directory,     *
+ * so every run starts without history and leaves nothing behind.         *
+ **************************************************************************
+ */
+
+#include <wx/wxprec.h>
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/dcgraph.h>
+#include <wx/dcmemory.h>
+#include <wx/filename.h>
+#include <wx/wfstream.h>
+#include "wx/jsonwriter.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "instrument.h"
+#include "dial.h"
+#include "speedometer.h"
+#include "compass.h"
+#include "wind.h"
+#include "rudder_angle.h"
+#include "depth.h"
+#include "altitude.h"
+#include "gps.h"
+#include "clock.h"
+#include "from_ownship.h"
+#include "wind_history.h"
+#include "baro_history.h"
+#include "host_shim.h"
+
+#define BENCH_FRAMES 200
+#define BENCH_SEED 4711
+
+static const int BENCH_WIDTHS[] = {150, 300, 600};
+
+// Settings in dashboard_pi.cpp the instruments read, set by RunBench()
+extern int g_iDashDepthUnit;
+extern int g_iDashDistanceUnit;
+extern int g_iDashWindSpeedUnit;
+extern int g_iDashWindHistorySpan;
+extern int g_iDashBaroHistorySpan;
+extern PI_ColorScheme aktuellColorScheme;
+
+typedef std::chrono::steady_clock Clock;
+
+static double ToUs(Clock::duration time) {
+  return std::chrono::duration<double, std::micro>(time).count();
+}
+
+// Time of the draw phases of a dial, summed over the frames
+struct DrawPhases {
+  DrawPhases()
+      : frame(Clock::duration::zero()),
+        labels(Clock::duration::zero()),
+        markers(Clock::duration::zero()),
+        foreground(Clock::duration::zero()) {}
+  Clock::duration frame;
+  Clock::duration labels;
+  Clock::duration markers;
+  Clock::duration foreground;
+};
+
+// Adds the time of its scope to 'time'
+class PhaseTimer {
+public:
+  PhaseTimer(Clock::duration &time) : m_time(time), m_start(Clock::now()) {}
+  ~PhaseTimer() { m_time += Clock::now() - m_start; }
+
+private:
+  Clock::duration &m_time;
+  Clock::time_point m_start;
+};
+
+// Draw() of an instrument is protected, Render() makes it callable
+class Renderer {
+public:
+  virtual ~Renderer() {}
+  virtual DashboardInstrument *Instrument(void) = 0;
+  virtual void Render(wxGCDC *dc) = 0;
+  virtual bool HasPhases(void) { return false; }
+  DrawPhases m_Phases;
+};
+
+template <class T>
+class Timed : public T, public Renderer {
+public:
+  template <typename... A>
+  Timed(A... args) : T(args...) {}
+  DashboardInstrument *Instrument(void) { return this; }
+  void Render(wxGCDC *dc) { this->Draw(dc); }
+};
+
+// The dial phases are virtual, they are timed by overriding them
+template <class T>
+class TimedDial : public Timed<T> {
+public:
+  template <typename... A>
+  TimedDial(A... args) : Timed<T>(args...) {}
+  bool HasPhases(void) { return true; }
+
+protected:
+  void DrawFrame(wxGCDC *dc) {
+    PhaseTimer timer(this->m_Phases.frame);
+    T::DrawFrame(dc);
+  }
+  void DrawLabels(wxGCDC *dc) {
+    PhaseTimer timer(this->m_Phases.labels);
+    T::DrawLabels(dc);
+  }
+  void DrawMarkers(wxGCDC *dc) {
+    PhaseTimer timer(this->m_Phases.markers);
+    T::DrawMarkers(dc);
+  }
+  void DrawForeground(wxGCDC *dc) {
+    PhaseTimer timer(this->m_Phases.foreground);
+    T::DrawForeground(dc);
+  }
+};
+
+// Properties NULL, the instruments use the global fonts and colours
+static InstrumentProperties *const s_NoProperties = NULL;
+
+static Renderer *Create_Dial(wxWindow *parent) {
+  TimedDial<DashboardInstrument_Dial> *instrument =
+      new TimedDial<DashboardInstrument_Dial>(parent, wxID_ANY, _T("Dial"),
+                                              s_NoProperties, OCPN_DBP_STC_STW,
+                                              225, 270, 0, 12);
+  instrument->SetOptionMarker(0.5, DIAL_MARKER_SIMPLE, 2);
+  instrument->SetOptionLabel(1, DIAL_LABEL_HORIZONTAL);
+  return instrument;
+}
+
+static Renderer *Create_Speedometer(wxWindow *parent) {
+  TimedDial<DashboardInstrument_Speedometer> *instrument =
+      new TimedDial<DashboardInstrument_Speedometer>(
+          parent, wxID_ANY, _T("Speedometer"), s_NoProperties,
+          OCPN_DBP_STC_SOG, 0, 12);
+  instrument->SetOptionLabel(1, DIAL_LABEL_HORIZONTAL);
+  instrument->SetOptionMarker(0.5, DIAL_MARKER_SIMPLE, 2);
+  instrument->SetOptionExtraValue(OCPN_DBP_STC_STW, _T("STW\n%.2f"),
+                                  DIAL_POSITION_BOTTOMLEFT);
+  return instrument;
+}
+
+static Renderer *Create_Compass(wxWindow *parent) {
+  TimedDial<DashboardInstrument_Compass> *instrument =
+      new TimedDial<DashboardInstrument_Compass>(
+          parent, wxID_ANY, _T("Compass"), s_NoProperties, OCPN_DBP_STC_COG);
+  instrument->SetOptionMarker(5, DIAL_MARKER_SIMPLE, 2);
+  instrument->SetOptionLabel(30, DIAL_LABEL_ROTATED);
+  instrument->SetOptionExtraValue(OCPN_DBP_STC_SOG, _T("SOG\n%.2f"),
+                                  DIAL_POSITION_BOTTOMLEFT);
+  return instrument;
+}
+
+static Renderer *Create_Wind(wxWindow *parent) {
+  TimedDial<DashboardInstrument_Wind> *instrument =
+      new TimedDial<DashboardInstrument_Wind>(
+          parent, wxID_ANY, _T("Wind"), s_NoProperties, OCPN_DBP_STC_AWA);
+  instrument->SetOptionMainValue(_T("%.0f"), DIAL_POSITION_BOTTOMLEFT);
+  instrument->SetOptionExtraValue(OCPN_DBP_STC_AWS, _T("%.1f"),
+                                  DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static Renderer *Create_WindCompass(wxWindow *parent) {
+  TimedDial<DashboardInstrument_WindCompass> *instrument =
+      new TimedDial<DashboardInstrument_WindCompass>(
+          parent, wxID_ANY, _T("WindCompass"), s_NoProperties,
+          OCPN_DBP_STC_TWD);
+  instrument->SetOptionMainValue(_T("%.0f"), DIAL_POSITION_BOTTOMLEFT);
+  instrument->SetOptionExtraValue(OCPN_DBP_STC_TWS2, _T("%.1f"),
+                                  DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static Renderer *Create_TrueWindAngle(wxWindow *parent) {
+  TimedDial<DashboardInstrument_TrueWindAngle> *instrument =
+      new TimedDial<DashboardInstrument_TrueWindAngle>(
+          parent, wxID_ANY, _T("TrueWindAngle"), s_NoProperties,
+          OCPN_DBP_STC_TWA);
+  instrument->SetOptionMainValue(_T("%.0f"), DIAL_POSITION_BOTTOMLEFT);
+  instrument->SetOptionExtraValue(OCPN_DBP_STC_TWS, _T("%.1f"),
+                                  DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static Renderer *Create_AppTrueWindAngle(wxWindow *parent) {
+  TimedDial<DashboardInstrument_AppTrueWindAngle> *instrument =
+      new TimedDial<DashboardInstrument_AppTrueWindAngle>(
+          parent, wxID_ANY, _T("AppTrueWindAngle"), s_NoProperties,
+          OCPN_DBP_STC_AWA);
+  instrument->SetCapFlag(OCPN_DBP_STC_TWA);
+  instrument->SetOptionMainValue(_T("%.0f"), DIAL_POSITION_NONE);
+  instrument->SetOptionExtraValue(OCPN_DBP_STC_TWS, _T("%.1f"),
+                                  DIAL_POSITION_NONE);
+  instrument->SetOptionExtraValue(OCPN_DBP_STC_AWS, _T("%.1f"),
+                                  DIAL_POSITION_NONE);
+  return instrument;
+}
+
+static Renderer *Create_RudderAngle(wxWindow *parent) {
+  return new TimedDial<DashboardInstrument_RudderAngle>(
+      parent, wxID_ANY, _T("RudderAngle"), s_NoProperties);
+}
+
+static Renderer *Create_Depth(wxWindow *parent) {
+  return new Timed<DashboardInstrument_Depth>(parent, wxID_ANY, _T("Depth"),
+                                              s_NoProperties);
+}
+
+static Renderer *Create_Altitude(wxWindow *parent) {
+  return new Timed<DashboardInstrument_Altitude>(
+      parent, wxID_ANY, _T("Altitude"), s_NoProperties);
+}
+
+static Renderer *Create_WindDirHistory(wxWindow *parent) {
+  return new Timed<DashboardInstrument_WindDirHistory>(
+      parent, wxID_ANY, _T("WindDirHistory"), s_NoProperties);
+}
+
+static Renderer *Create_BaroHistory(wxWindow *parent) {
+  return new Timed<DashboardInstrument_BaroHistory>(
+      parent, wxID_ANY, _T("BaroHistory"), s_NoProperties);
+}
+
+static Renderer *Create_GPS(wxWindow *parent) {
+  return new Timed<DashboardInstrument_GPS>(parent, wxID_ANY, _T("GPS"),
+                                            s_NoProperties);
+}
+
+static Renderer *Create_Clock(wxWindow *parent) {
+  return new Timed<DashboardInstrument_Clock>(parent, wxID_ANY, _T("Clock"),
+                                              s_NoProperties);
+}
+
+static Renderer *Create_Sun(wxWindow *parent) {
+  return new Timed<DashboardInstrument_Sun>(parent, wxID_ANY, _T("Sun"),
+                                            s_NoProperties);
+}
+
+static Renderer *Create_Moon(wxWindow *parent) {
+  return new Timed<DashboardInstrument_Moon>(parent, wxID_ANY, _T("Moon"),
+                                             s_NoProperties);
+}
+
+static Renderer *Create_FromOwnship(wxWindow *parent) {
+  return new Timed<DashboardInstrument_FromOwnship>(
+      parent, wxID_ANY, _T("FromOwnship"), s_NoProperties);
+}
+
+static Renderer *Create_Position(wxWindow *parent) {
+  return new Timed<DashboardInstrument_Position>(
+      parent, wxID_ANY, _T("Position"), s_NoProperties);
+}
+
+static Renderer *Create_Single(wxWindow *parent) {
+  return new Timed<DashboardInstrument_Single>(
+      parent, wxID_ANY, _T("Single"), s_NoProperties, OCPN_DBP_STC_SOG,
+      wxString(_T("%5.1f")));
+}
+
+static Renderer *Create_Block(wxWindow *parent) {
+  return new Timed<DashboardInstrument_Block>(
+      parent, wxID_ANY, _T("Block"), s_NoProperties,
+      OCPN_DBP_STC_TANK_LEVEL_FUEL_GAUGE_01, wxString(_T("%s")));
+}
+
+// Range of the random values sent to the instruments for a cap
+struct BenchInput {
+  DASH_CAP cap;
+  double min, max;
+  const wxChar *unit;
+};
+
+static const BenchInput s_Inputs[] = {
+    {OCPN_DBP_STC_SOG, 0, 12, _T("Kn")},
+    {OCPN_DBP_STC_STW, 0, 12, _T("Kn")},
+    {OCPN_DBP_STC_COG, 0, 360, _T("\u00B0")},
+    {OCPN_DBP_STC_AWA, 0, 180, _T("\u00B0R")},
+    {OCPN_DBP_STC_AWS, 0, 40, _T("Kn")},
+    {OCPN_DBP_STC_TWA, 0, 180, _T("\u00B0L")},
+    {OCPN_DBP_STC_TWS, 0, 40, _T("Kn")},
+    {OCPN_DBP_STC_TWD, 0, 360, _T("\u00B0")},
+    {OCPN_DBP_STC_TWS2, 0, 40, _T("Kn")},
+    {OCPN_DBP_STC_RSA, -40, 40, _T("\u00B0")},
+    {OCPN_DBP_STC_DPT, 1, 100, _T("m")},
+    {OCPN_DBP_STC_TMP, 5, 30, _T("C")},
+    {OCPN_DBP_STC_ALTI, 0, 50, _T("m")},
+    {OCPN_DBP_STC_ATMP, 5, 30, _T("C")},
+    {OCPN_DBP_STC_MDA, 960, 1050, _T("hPa")},
+    {OCPN_DBP_STC_LAT, -60, 60, _T("SDMM")},
+    {OCPN_DBP_STC_LON, -180, 180, _T("SDMM")},
+    {OCPN_DBP_STC_PLA, -60, 60, _T("SDMM")},
+    {OCPN_DBP_STC_PLO, -180, 180, _T("SDMM")},
+    {OCPN_DBP_STC_TANK_LEVEL_FUEL_GAUGE_01, 1, 100, _T("Level")}};
+
+struct BenchInstrument {
+  const char *name;
+  Renderer *(*create)(wxWindow *parent);
+};
+
+static const BenchInstrument s_Instruments[] = {
+    {"Dial", Create_Dial},
+    {"Speedometer", Create_Speedometer},
+    {"Compass", Create_Compass},
+    {"Wind", Create_Wind},
+    {"WindCompass", Create_WindCompass},
+    {"TrueWindAngle", Create_TrueWindAngle},
+    {"AppTrueWindAngle", Create_AppTrueWindAngle},
+    {"RudderAngle", Create_RudderAngle},
+    {"Depth", Create_Depth},
+    {"Altitude", Create_Altitude},
+    {"WindDirHistory", Create_WindDirHistory},
+    {"BaroHistory", Create_BaroHistory},
+    {"GPS", Create_GPS},
+    {"Clock", Create_Clock},
+    {"Sun", Create_Sun},
+    {"Moon", Create_Moon},
+    {"FromOwnship", Create_FromOwnship},
+    {"Position", Create_Position},
+    {"Single", Create_Single},
+    {"Block", Create_Block}};
+
+static double Random(std::mt19937 &random, double min, double max) {
+  return std::uniform_real_distribution<double>(min, max)(random);
+}
+
+// Every instrument gets all inputs, it takes the ones of its caps
+static void FeedInstrument(DashboardInstrument *instrument,
+                           std::mt19937 &random) {
+  for (size_t i = 0; i < sizeof(s_Inputs) / sizeof(s_Inputs[0]); i++) {
+    const BenchInput &input = s_Inputs[i];
+    instrument->SetData(input.cap, Random(random, input.min, input.max),
+                        input.unit);
+  }
+  DashboardInstrument_Clock *clock =
+      dynamic_cast<DashboardInstrument_Clock *>(instrument);
+  if (clock)
+    clock->SetUtcTime(wxDateTime((time_t)Random(random, 1.6e9, 1.9e9)));
+  DashboardInstrument_GPS *gps =
+      dynamic_cast<DashboardInstrument_GPS *>(instrument);
+  if (gps) {
+    SAT_INFO sats[4];
+    for (int seq = 1; seq <= 3; seq++) {
+      for (int i = 0; i < 4; i++) {
+        sats[i].SatNumber = (seq - 1) * 4 + i + 1;
+        sats[i].ElevationDegrees = (int)Random(random, 0, 90);
+        sats[i].AzimuthDegreesTrue = (int)Random(random, 0, 360);
+        sats[i].SignalToNoiseRatio = (int)Random(random, 0, 50);
+      }
+      gps->SetSatInfo(12, seq, _T("GP"), sats);
+    }
+  }
+}
+
+// Draws 'frames' frames into a bitmap of the instrument size, as OnPaint()
+// does, and returns the time of all
+static Clock::duration RenderFrames(Renderer *renderer, int frames,
+                                    bool cold, std::mt19937 &random) {
+  DashboardInstrument *instrument = renderer->Instrument();
+  wxSize size = instrument->GetClientSize();
+  wxBitmap bitmap(size.x, size.y);
+  wxMemoryDC mdc(bitmap);
+  wxGCDC dc(mdc);
+  const InstrumentPalette &palette = GetInstrumentPalette(s_NoProperties);
+
+  Clock::duration time = Clock::duration::zero();
+  for (int i = 0; i < frames; i++) {
+    FeedInstrument(instrument, random);
+    if (cold) instrument->ResetCache();
+    Clock::time_point start = Clock::now();
+    dc.SetBackground(palette.m_DataBackgroundBrush);
+    dc.Clear();
+    renderer->Render(&dc);
+    time += Clock::now() - start;
+  }
+  mdc.SelectObject(wxNullBitmap);
+  return time;
+}
+
+static wxJSONValue BenchInstrumentSize(const BenchInstrument &bench,
+                                       wxWindow *parent, int width,
+                                       int frames, std::mt19937 &random) {
+  Renderer *renderer = bench.create(parent);
+  DashboardInstrument *instrument = renderer->Instrument();
+  wxSize size = instrument->GetSize(wxVERTICAL, wxSize(width, width));
+  instrument->SetSize(size);
+
+  // One frame to fill the caches before the warm frames
+  RenderFrames(renderer, 1, false, random);
+  double warm = ToUs(RenderFrames(renderer, frames, false, random)) / frames;
+  renderer->m_Phases = DrawPhases();
+  double cold = ToUs(RenderFrames(renderer, frames, true, random)) / frames;
+
+  wxJSONValue result;
+  result[_T("Width")] = size.x;
+  result[_T("Height")] = size.y;
+  result[_T("WarmUs")] = warm;
+  result[_T("ColdUs")] = cold;
+  printf("%-18s %4dx%-4d %10.1f %10.1f", bench.name, size.x, size.y, warm,
+         cold);
+  if (renderer->HasPhases()) {
+    const DrawPhases &phases = renderer->m_Phases;
+    wxJSONValue &p = result[_T("PhasesUs")];
+    p[_T("DrawFrame")] = ToUs(phases.frame) / frames;
+    p[_T("DrawLabels")] = ToUs(phases.labels) / frames;
+    p[_T("DrawMarkers")] = ToUs(phases.markers) / frames;
+    p[_T("DrawForeground")] = ToUs(phases.foreground) / frames;
+    printf(" %10.1f %10.1f %10.1f %10.1f", ToUs(phases.frame) / frames,
+           ToUs(phases.labels) / frames, ToUs(phases.markers) / frames,
+           ToUs(phases.foreground) / frames);
+  }
+  printf("\n");
+  instrument->Destroy();
+  return result;
+}
+
+// The rose drawn for every heading against the rotated CompassRoseSprite
+static wxJSONValue BenchCompassRose(int width, int frames,
+                                    std::mt19937 &random) {
+  int radius = width * 0.35;
+  wxBitmap bitmap(width, width);
+  wxMemoryDC mdc(bitmap);
+  wxGCDC dc(mdc);
+  CompassRoseSprite sprite;
+
+  Clock::duration direct = Clock::duration::zero();
+  Clock::duration sprited = Clock::duration::zero();
+  for (int i = 0; i < frames; i++) {
+    int angle = (int)Random(random, 0, 360);
+    Clock::time_point start = Clock::now();
+    DrawCompassRose(&dc, width / 2, width / 2, radius, angle, true,
+                    s_NoProperties);
+    direct += Clock::now() - start;
+    start = Clock::now();
+    sprite.Draw(&dc, width / 2, width / 2, radius, angle, true,
+                s_NoProperties);
+    sprited += Clock::now() - start;
+  }
+  mdc.SelectObject(wxNullBitmap);
+
+  wxJSONValue result;
+  result[_T("Radius")] = radius;
+  result[_T("DirectUs")] = ToUs(direct) / frames;
+  result[_T("SpriteUs")] = ToUs(sprited) / frames;
+  printf("%-18s %4d      %10.1f %10.1f\n", "CompassRose", radius,
+         ToUs(direct) / frames, ToUs(sprited) / frames);
+  return result;
+}
+
+static int RunBench(const wxString &output, int frames) {
+  g_iDashDepthUnit = 3;  // Meters
+  g_iDashDistanceUnit = 0;
+  g_iDashWindSpeedUnit = 0;
+  g_iUTCOffset = 0;
+  g_iDashWindHistorySpan = 1;
+  g_iDashBaroHistorySpan = 24;
+  aktuellColorScheme = PI_GLOBAL_COLOR_SCHEME_DAY;
+  g_pFontTitle = new wxFontData();
+  g_pFontTitle->SetChosenFont(wxFont(10, wxFONTFAMILY_SWISS,
+                                     wxFONTSTYLE_ITALIC, wxFONTWEIGHT_NORMAL));
+  g_pFontData = new wxFontData();
+  g_pFontData->SetChosenFont(wxFont(14, wxFONTFAMILY_SWISS,
+                                    wxFONTSTYLE_NORMAL, wxFONTWEIGHT_NORMAL));
+  g_pFontLabel = new wxFontData();
+  g_pFontLabel->SetChosenFont(wxFont(8, wxFONTFAMILY_SWISS,
+                                     wxFONTSTYLE_NORMAL, wxFONTWEIGHT_NORMAL));
+  g_pFontSmall = new wxFontData();
+  g_pFontSmall->SetChosenFont(wxFont(8, wxFONTFAMILY_SWISS,
+                                     wxFONTSTYLE_NORMAL, wxFONTWEIGHT_NORMAL));
+
+  // Never shown, the instruments only need a parent
+  wxFrame *frame = new wxFrame(NULL, wxID_ANY, _T("dashboard_bench"));
+  std::mt19937 random(BENCH_SEED);
+
+  wxJSONValue root;
+  root[_T("Frames")] = frames;
+  root[_T("Seed")] = BENCH_SEED;
+  root[_T("wxWidgets")] = wxString(wxVERSION_STRING);
+  root[_T("Date")] = wxDateTime::Now().FormatISOCombined();
+
+  printf("%-18s %9s %10s %10s %10s %10s %10s %10s\n", "us/frame", "size",
+         "warm", "cold", "frame", "labels", "markers", "foreground");
+  wxJSONValue &instruments = root[_T("Instruments")];
+  for (size_t i = 0; i < sizeof(s_Instruments) / sizeof(s_Instruments[0]);
+       i++) {
+    wxJSONValue &sizes = instruments[wxString(s_Instruments[i].name)];
+    for (size_t w = 0; w < sizeof(BENCH_WIDTHS) / sizeof(BENCH_WIDTHS[0]);
+         w++)
+      sizes.Append(BenchInstrumentSize(s_Instruments[i], frame,
+                                       BENCH_WIDTHS[w], frames, random));
+  }
+
+  printf("%-18s %9s %10s %10s\n", "us/frame", "radius", "direct", "sprite");
+  wxJSONValue &rose = root[_T("CompassRose")];
+  for (size_t w = 0; w < sizeof(BENCH_WIDTHS) / sizeof(BENCH_WIDTHS[0]); w++)
+    rose.Append(BenchCompassRose(BENCH_WIDTHS[w], frames, random));
+
+  frame->Destroy();
+
+  wxJSONWriter writer;
+  wxString json;
+  writer.Write(root, json);
+  wxFileOutputStream file(output);
+  if (!file.IsOk()) {
+    fprintf(stderr, "dashboard_bench: cannot write %s\n",
+            (const char *)output.mb_str());
+    return 1;
+  }
+  wxScopedCharBuffer utf8 = json.utf8_str();
+  file.Write(utf8.data(), utf8.length());
+  return file.IsOk() ? 0 : 1;
+}
+
+int main(int argc, char **argv) {
+  wxString output = argc > 1 ? wxString(argv[1]) : _T("dashboard_bench.json");
+  long frames = BENCH_FRAMES;
+  if (argc > 2 && (!wxString(argv[2]).ToLong(&frames) || frames < 1)) {
+    fprintf(stderr, "usage: dashboard_bench [output.json [frames]]\n");
+    return 2;
+  }
+
+  wxApp::SetInstance(new wxApp());
+  if (!wxEntryStart(argc, argv) || !wxTheApp->CallOnInit()) {
+    fprintf(stderr, "dashboard_bench: no display, run it with xvfb-run\n");
+    return 1;
+  }
+  // A unique name from a temporary file, replaced by the directory
+  wxString dataDir = wxFileName::CreateTempFileName(_T("dashboard_bench"));
+  bool haveDir = !dataDir.IsEmpty() && wxRemoveFile(dataDir) &&
+                 wxFileName::Mkdir(dataDir);
+  int result = 1;
+  if (haveDir) {
+    HostShimSetDataDir(dataDir);
+    result = RunBench(output, (int)frames);
+  } else
+    fprintf(stderr, "dashboard_bench: cannot create a temporary directory\n");
+  wxTheApp->OnExit();
+  wxEntryCleanup();
+  // Only now, the windows deleted by the cleanup may still save into it
+  if (haveDir) wxFileName::Rmdir(dataDir, wxPATH_RMDIR_RECURSIVE);
+  return result;
+}
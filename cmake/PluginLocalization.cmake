@@ -37,7 +37,7 @@ string(REPLACE "_pi" "" I18N_NAME ${PACKAGE_NAME})
 if(GETTEXT_XGETTEXT_EXECUTABLE)
     add_custom_command(
         OUTPUT po/${PACKAGE_NAME}.pot.dummy
-        COMMAND ${GETTEXT_XGETTEXT_EXECUTABLE} --force-po -F --package-name=${PACKAGE_NAME} --package-version="${PACKAGE_VERSION}" --output=po/${PACKAGE_NAME}.pot --keyword=_ --width=80 --files-from=${CMAKE_CURRENT_SOURCE_DIR}/po/POTFILES.in
+        COMMAND ${GETTEXT_XGETTEXT_EXECUTABLE} --force-po -F --package-name=${PACKAGE_NAME} --package-version="${PACKAGE_VERSION}" --output=po/${PACKAGE_NAME}.pot --keyword=_ --keyword=wxTRANSLATE --width=80 --files-from=${CMAKE_CURRENT_SOURCE_DIR}/po/POTFILES.in
         DEPENDS po/POTFILES.in po/${PACKAGE_NAME}.pot
         WORKING_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}
         COMMENT "${I18N_NAME}-pot-update [${PACKAGE_NAME}]: Generated pot file.")
@@ -0,0 +1,338 @@
+/******************************************************************************
+ * host_shim.cpp
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Headless stand-in for the OpenCPN host
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+#include "host_shim.h"
+#include <wx/fileconf.h>
+#include <wx/filename.h>
+#include <wx/sstream.h>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include "../../../include/ocpn_plugin.h"
+
+// Approximately the DAY colours of OpenCPN
+static std::map<wxString, wxColour> s_Colours = {
+    {_T("DASHB"), wxColour(255, 255, 255)},
+    {_T("DASHL"), wxColour(190, 184, 162)},
+    {_T("DASHF"), wxColour(0, 0, 0)},
+    {_T("DASHN"), wxColour(255, 0, 0)},
+    {_T("DASHR"), wxColour(200, 0, 0)},
+    {_T("DASHG"), wxColour(0, 200, 0)},
+    {_T("DASH1"), wxColour(204, 41, 41)},
+    {_T("DASH2"), wxColour(0, 0, 255)},
+    {_T("BLUE3"), wxColour(0, 0, 255)},
+    {_T("UBLCK"), wxColour(0, 0, 0)}};
+
+static wxString s_DataDir =
+    wxFileName::GetTempDir() + wxFileName::GetPathSeparator();
+static int s_DistanceUnit = 0;     // NMi
+static int s_SpeedUnit = 0;        // kts
+static int s_TemperatureUnit = 0;  // Celsius
+static double s_DIPScaleFactor = 1.0;
+static wxWindow *s_CanvasWindow = NULL;
+static std::vector<std::string> s_PriorityIdentifiers;
+
+void HostShimSetColour(const wxString &name, const wxColour &colour) {
+  s_Colours[name] = colour;
+}
+
+void HostShimSetDataDir(const wxString &dir) {
+  s_DataDir = dir;
+  if (!s_DataDir.EndsWith(wxFileName::GetPathSeparator()))
+    s_DataDir += wxFileName::GetPathSeparator();
+}
+
+void HostShimSetUnits(int distance, int speed, int temperature) {
+  s_DistanceUnit = distance;
+  s_SpeedUnit = speed;
+  s_TemperatureUnit = temperature;
+}
+
+void HostShimSetDIPScaleFactor(double factor) { s_DIPScaleFactor = factor; }
+
+void HostShimSetCanvasWindow(wxWindow *canvas) { s_CanvasWindow = canvas; }
+
+void HostShimSetPriorityIdentifiers(const std::vector<std::string> &ids) {
+  s_PriorityIdentifiers = ids;
+}
+
+// A GetListener() registration, kept while the plugin holds it
+struct HostShimListener {
+  HostShimListener(uint64_t pgn, wxEventType type, wxEvtHandler *handler)
+      : m_Pgn(pgn), m_Type(type), m_Handler(handler) {
+    s_Listeners.push_back(this);
+  }
+  ~HostShimListener() {
+    s_Listeners.erase(
+        std::remove(s_Listeners.begin(), s_Listeners.end(), this),
+        s_Listeners.end());
+  }
+
+  uint64_t m_Pgn;
+  wxEventType m_Type;
+  wxEvtHandler *m_Handler;
+
+  static std::vector<HostShimListener *> s_Listeners;
+};
+
+std::vector<HostShimListener *> HostShimListener::s_Listeners;
+
+// What the ObservedEvt of HostShimPost() carries
+struct HostShimN2kMsg {
+  HostShimN2kMsg(const std::vector<uint8_t> &p, const std::string &s)
+      : payload(p), source(s) {}
+  std::vector<uint8_t> payload;
+  std::string source;
+};
+
+int HostShimPost(int pgn, const std::vector<uint8_t> &payload,
+                 const std::string &source) {
+  std::shared_ptr<const void> msg =
+      std::make_shared<const HostShimN2kMsg>(payload, source);
+  // A handler may drop listeners, so work on a copy and skip dropped ones
+  std::vector<HostShimListener *> listeners = HostShimListener::s_Listeners;
+  const std::vector<HostShimListener *> &current =
+      HostShimListener::s_Listeners;
+  int count = 0;
+  for (HostShimListener *listener : listeners) {
+    if (std::find(current.begin(), current.end(), listener) == current.end())
+      continue;
+    if (listener->m_Pgn != (uint64_t)pgn) continue;
+    ObservedEvt ev(listener->m_Type);
+    ev.SetSharedPtr(msg);
+    listener->m_Handler->ProcessEvent(ev);
+    count++;
+  }
+  return count;
+}
+
+//    The plugin base classes
+
+opencpn_plugin::~opencpn_plugin() {}
+int opencpn_plugin::Init(void) { return 0; }
+bool opencpn_plugin::DeInit(void) { return true; }
+int opencpn_plugin::GetAPIVersionMajor() { return 1; }
+int opencpn_plugin::GetAPIVersionMinor() { return 18; }
+int opencpn_plugin::GetPlugInVersionMajor() { return 1; }
+int opencpn_plugin::GetPlugInVersionMinor() { return 0; }
+wxBitmap *opencpn_plugin::GetPlugInBitmap() { return NULL; }
+wxString opencpn_plugin::GetCommonName() { return _T("BaseClassCommonName"); }
+wxString opencpn_plugin::GetShortDescription() {
+  return _T("OpenCPN PlugIn Base Class");
+}
+wxString opencpn_plugin::GetLongDescription() {
+  return _T("OpenCPN PlugIn Base Class");
+}
+void opencpn_plugin::SetDefaults(void) {}
+int opencpn_plugin::GetToolbarToolCount(void) { return 0; }
+int opencpn_plugin::GetToolboxPanelCount(void) { return 0; }
+void opencpn_plugin::SetupToolboxPanel(int page_sel, wxNotebook *pnotebook) {}
+void opencpn_plugin::OnCloseToolboxPanel(int page_sel, int ok_apply_cancel) {}
+void opencpn_plugin::ShowPreferencesDialog(wxWindow *parent) {}
+bool opencpn_plugin::RenderOverlay(wxMemoryDC *pmdc, PlugIn_ViewPort *vp) {
+  return false;
+}
+void opencpn_plugin::SetCursorLatLon(double lat, double lon) {}
+void opencpn_plugin::SetCurrentViewPort(PlugIn_ViewPort &vp) {}
+void opencpn_plugin::SetPositionFix(PlugIn_Position_Fix &pfix) {}
+void opencpn_plugin::SetNMEASentence(wxString &sentence) {}
+void opencpn_plugin::SetAISSentence(wxString &sentence) {}
+void opencpn_plugin::ProcessParentResize(int x, int y) {}
+void opencpn_plugin::SetColorScheme(PI_ColorScheme cs) {}
+void opencpn_plugin::OnToolbarToolCallback(int id) {}
+void opencpn_plugin::OnContextMenuItemCallback(int id) {}
+void opencpn_plugin::UpdateAuiStatus(void) {}
+wxArrayString opencpn_plugin::GetDynamicChartClassNameArray(void) {
+  return wxArrayString();
+}
+
+opencpn_plugin_18::opencpn_plugin_18(void *pmgr) : opencpn_plugin(pmgr) {}
+opencpn_plugin_18::~opencpn_plugin_18(void) {}
+bool opencpn_plugin_18::RenderOverlay(wxDC &dc, PlugIn_ViewPort *vp) {
+  return false;
+}
+bool opencpn_plugin_18::RenderGLOverlay(wxGLContext *pcontext,
+                                        PlugIn_ViewPort *vp) {
+  return false;
+}
+void opencpn_plugin_18::SetPluginMessage(wxString &message_id,
+                                         wxString &message_body) {}
+void opencpn_plugin_18::SetPositionFixEx(PlugIn_Position_Fix_Ex &pfix) {}
+
+//    The plugin API
+
+bool GetGlobalColor(wxString colorName, wxColour *pcolour) {
+  std::map<wxString, wxColour>::const_iterator it = s_Colours.find(colorName);
+  if (it == s_Colours.end()) return false;
+  *pcolour = it->second;
+  return true;
+}
+
+double OCPN_GetWinDIPScaleFactor() { return s_DIPScaleFactor; }
+
+wxString *GetpPrivateApplicationDataLocation() { return &s_DataDir; }
+
+wxString *GetpSharedDataLocation() { return &s_DataDir; }
+
+wxWindow *GetOCPNCanvasWindow() { return s_CanvasWindow; }
+
+wxString GetActiveStyleName() { return _T("traditional"); }
+
+float GetOCPNGUIToolScaleFactor_PlugIn() { return 1.0; }
+
+wxFont *OCPNGetFont(wxString TextElement, int default_size) {
+  static wxFont font = *wxNORMAL_FONT;
+  return &font;
+}
+
+wxBitmap GetBitmapFromSVGFile(wxString filename, unsigned int width,
+                              unsigned int height) {
+  return wxBitmap(width, height);
+}
+
+bool AddLocaleCatalog(wxString catalog) { return false; }
+
+void DimeWindow(wxWindow *win) {}
+
+int InsertPlugInToolSVG(wxString label, wxString SVGfile,
+                        wxString SVGfileRollover, wxString SVGfileToggled,
+                        wxItemKind kind, wxString shortHelp, wxString longHelp,
+                        wxObject *clientData, int position, int tool_sel,
+                        opencpn_plugin *pplugin) {
+  return -1;
+}
+
+void SetToolbarItemState(int item, bool toggle) {}
+
+void SendPluginMessage(wxString message_id, wxString message_body) {}
+
+bool DecodeSingleVDOMessage(const wxString &str, PlugIn_Position_Fix_Ex *pos,
+                            wxString *acc) {
+  return false;
+}
+
+std::vector<std::string> GetActivePriorityIdentifiers() {
+  return s_PriorityIdentifiers;
+}
+
+// The plugin only holds the listener and never uses it as an
+// ObservableListener, the core class. The returned pointer shares the
+// ownership of a HostShimListener, so it works whether the API headers
+// define ObservableListener or only declare it.
+std::shared_ptr<ObservableListener> GetListener(NMEA2000Id id, wxEventType ev,
+                                                wxEvtHandler *handler) {
+  std::shared_ptr<HostShimListener> listener =
+      std::make_shared<HostShimListener>(id.id, ev, handler);
+  return std::shared_ptr<ObservableListener>(
+      listener, reinterpret_cast<ObservableListener *>(listener.get()));
+}
+
+std::vector<uint8_t> GetN2000Payload(NMEA2000Id id, ObservedEvt ev) {
+  std::shared_ptr<const HostShimN2kMsg> msg =
+      std::static_pointer_cast<const HostShimN2kMsg>(ev.GetSharedPtr());
+  return msg->payload;
+}
+
+std::string GetN2000Source(NMEA2000Id id, ObservedEvt ev) {
+  std::shared_ptr<const HostShimN2kMsg> msg =
+      std::static_pointer_cast<const HostShimN2kMsg>(ev.GetSharedPtr());
+  return msg->source;
+}
+
+wxFileConfig *GetOCPNConfigObject(void) {
+  static wxFileConfig *config = NULL;
+  if (!config) {
+    wxStringInputStream empty(wxEmptyString);
+    config = new wxFileConfig(empty);
+  }
+  return config;
+}
+
+// NMi, mi, km, m, ft, fathoms, in, cm
+static const double s_NMiTo[] = {1.0,     1.15078, 1.852,   1852.0,
+                                 6076.12, 1012.69, 72913.4, 185200.0};
+static const wxChar *s_DistanceUnits[] = {_T("NMi"), _T("mi"), _T("km"),
+                                          _T("m"),   _T("ft"), _T("fathoms"),
+                                          _T("in"),  _T("cm")};
+
+double toUsrDistance_Plugin(double nm_distance, int unit) {
+  if (unit == -1) unit = s_DistanceUnit;
+  if (unit < 0 || unit > 7) return nm_distance;
+  return nm_distance * s_NMiTo[unit];
+}
+
+wxString getUsrDistanceUnit_Plugin(int unit) {
+  if (unit == -1) unit = s_DistanceUnit;
+  if (unit < 0 || unit > 7) return wxEmptyString;
+  return s_DistanceUnits[unit];
+}
+
+// kts, mph, km/h, m/s
+double toUsrSpeed_Plugin(double kts_speed, int unit) {
+  static const double factor[] = {1.0, 1.15078, 1.852, 0.514444};
+  if (unit == -1) unit = s_SpeedUnit;
+  if (unit < 0 || unit > 3) return kts_speed;
+  return kts_speed * factor[unit];
+}
+
+wxString getUsrSpeedUnit_Plugin(int unit) {
+  static const wxChar *units[] = {_T("kts"), _T("mph"), _T("km/h"), _T("m/s")};
+  if (unit == -1) unit = s_SpeedUnit;
+  if (unit < 0 || unit > 3) return wxEmptyString;
+  return units[unit];
+}
+
+// Celsius, Fahrenheit, Kelvin
+double toUsrTemp_Plugin(double cel_temp, int unit) {
+  if (unit == -1) unit = s_TemperatureUnit;
+  if (unit == 1) return cel_temp * 9.0 / 5.0 + 32.0;
+  if (unit == 2) return cel_temp + 273.15;
+  return cel_temp;
+}
+
+wxString getUsrTempUnit_Plugin(int unit) {
+  if (unit == -1) unit = s_TemperatureUnit;
+  if (unit == 1) return _T("F");
+  if (unit == 2) return _T("K");
+  return _T("C");
+}
+
+// Mercator sailing from (lat1, lon1) to (lat0, lon0), distance in NMi
+void DistanceBearingMercator_Plugin(double lat0, double lon0, double lat1,
+                                    double lon1, double *brg, double *dist) {
+  const double rad = M_PI / 180.0;
+  double dlon = lon0 - lon1;
+  if (dlon > 180.0) dlon -= 360.0;
+  if (dlon < -180.0) dlon += 360.0;
+  double dphi = log(tan(M_PI / 4 + lat0 * rad / 2) /
+                    tan(M_PI / 4 + lat1 * rad / 2));
+  double dlat = (lat0 - lat1) * rad;
+  double q = fabs(dphi) > 1e-12 ? dlat / dphi : cos(lat1 * rad);
+  double b = atan2(dlon * rad, dphi) / rad;
+  if (brg) *brg = b < 0 ? b + 360.0 : b;
+  if (dist)
+    *dist = sqrt(dlat * dlat + q * q * dlon * rad * dlon * rad) / rad * 60.0;
+}
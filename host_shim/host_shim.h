@@ -0,0 +1,75 @@
+/******************************************************************************
+ * host_shim.h
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Headless stand-in for the OpenCPN host
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+/**************************************************************************
+ * How to use:                                                            *
+ *                                                                        *
+ * The host shim library (cmake -DDASHBOARD_HOST_SHIM=ON) implements the  *
+ * plugin API functions the dashboard calls, so it can be built into a    *
+ * program without OpenCPN, e.g. a benchmark rendering the instruments    *
+ * into a wxMemoryDC. It provides GetGlobalColor() with a built-in day    *
+ * palette, the user unit conversions, DistanceBearingMercator_Plugin(),  *
+ * OCPN_GetWinDIPScaleFactor(), the data locations, an in-memory          *
+ * GetOCPNConfigObject(), the opencpn_plugin base classes and the NMEA    *
+ * 2000 listeners. The HostShim...() functions change what these return.  *
+ * The library contains dashboard_pi too. A program creates it with       *
+ * create_pi(), sets the canvas window, calls Init() and feeds it with    *
+ * SetNMEASentence() and HostShimPost(), as host_shim_smoke.cpp does.     *
+ * The globals of dashboard_pi.cpp (g_pFontTitle, ...) come with the      *
+ * library too, so a program using only the instruments sets them but     *
+ * must not define them.                                                  *
+ **************************************************************************
+ */
+#if !defined(HOST_SHIM_HEADER)
+#define HOST_SHIM_HEADER
+
+#include <wx/colour.h>
+#include <wx/string.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+class wxWindow;
+
+// Colour returned by GetGlobalColor(name), e.g. "DASHB"
+void HostShimSetColour(const wxString &name, const wxColour &colour);
+// Directory of GetpPrivateApplicationDataLocation() and
+// GetpSharedDataLocation(), default the system temp directory
+void HostShimSetDataDir(const wxString &dir);
+// Units used by the conversions for unit -1, see toUsrDistance_Plugin()
+void HostShimSetUnits(int distance, int speed, int temperature);
+void HostShimSetDIPScaleFactor(double factor);
+// Window returned by GetOCPNCanvasWindow(), the parent of the dashboards
+void HostShimSetCanvasWindow(wxWindow *canvas);
+// Result of GetActivePriorityIdentifiers(), default none
+void HostShimSetPriorityIdentifiers(const std::vector<std::string> &ids);
+// Sends an ObservedEvt to the GetListener() listeners of pgn, at once
+// and not queued like OpenCPN does. GetN2000Payload() returns payload,
+// so it must be laid out like the host does it (source address at 7).
+// Returns the number of listeners reached.
+int HostShimPost(int pgn, const std::vector<uint8_t> &payload,
+                 const std::string &source = "nmea2000");
+
+#endif
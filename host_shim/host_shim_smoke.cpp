@@ -0,0 +1,129 @@
+/******************************************************************************
+ * host_shim_smoke.cpp
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Runs the plugin once through the headless host shim
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+/**************************************************************************
+ * How to use:                                                            *
+ *                                                                        *
+ * Built with cmake -DDASHBOARD_HOST_SHIM=ON.                             *
+ *   xvfb-run ./dashboard_host_shim_smoke                                 *
+ * Creates dashboard_pi with create_pi(), calls Init(), posts a water     *
+ * depth PGN 128267 with HostShimPost() and calls DeInit(). It fails when *
+ * a step fails or nothing listens to the PGN. The configuration is the   *
+ * in-memory one of the shim, the data directory a new temporary one.     *
+ **************************************************************************
+ */
+
+#include <wx/wxprec.h>
+
+#ifndef WX_PRECOMP
+#include <wx/wx.h>
+#endif
+
+#include <wx/filename.h>
+
+#include <cstdio>
+#include <vector>
+
+#include "../../../include/ocpn_plugin.h"
+#include "host_shim.h"
+
+extern "C" opencpn_plugin *create_pi(void *ppimgr);
+extern "C" void destroy_pi(opencpn_plugin *p);
+
+// PGN 128267 laid out like OpenCPN delivers NMEA 2000 messages
+static const uint8_t s_Depth[] = {
+    0x93, 0x13,              // N2K message, length
+    0x03,                    // priority
+    0x0B, 0xF5, 0x01,        // PGN 128267, LSB first
+    0xFF,                    // destination, global
+    0x23,                    // source address
+    0x00, 0x00, 0x00, 0x00,  // time stamp
+    0x08,                    // data length
+    0x01,                    // SID
+    0xD2, 0x04, 0x00, 0x00,  // depth 12.34 m
+    0xF4, 0x01,              // offset 0.5 m
+    0xFF,                    // range not available
+    0x00};                   // checksum
+
+static int RunSmoke(void) {
+  // Never shown, the dashboards only need a parent
+  wxFrame *canvas =
+      new wxFrame(NULL, wxID_ANY, _T("dashboard_host_shim_smoke"));
+  HostShimSetCanvasWindow(canvas);
+
+  int result = 0;
+  opencpn_plugin *plugin = create_pi(NULL);
+  printf("Init: caps 0x%x\n", plugin->Init());
+
+  std::vector<uint8_t> depth(s_Depth, s_Depth + sizeof(s_Depth));
+  int listeners = HostShimPost(128267, depth);
+  printf("HostShimPost 128267: %d listener(s)\n", listeners);
+  if (listeners == 0) {
+    fprintf(stderr, "dashboard_host_shim_smoke: nothing listens to 128267\n");
+    result = 1;
+  }
+
+  bool deinit = plugin->DeInit();
+  printf("DeInit: %s\n", deinit ? "true" : "false");
+  if (!deinit) result = 1;
+  destroy_pi(plugin);
+
+  // The listeners go with the plugin, a post must not reach it any more
+  if (HostShimPost(128267, depth) != 0) {
+    fprintf(stderr,
+            "dashboard_host_shim_smoke: listener left after destroy_pi\n");
+    result = 1;
+  }
+
+  HostShimSetCanvasWindow(NULL);
+  canvas->Destroy();
+  return result;
+}
+
+int main(int argc, char **argv) {
+  wxApp::SetInstance(new wxApp());
+  if (!wxEntryStart(argc, argv) || !wxTheApp->CallOnInit()) {
+    fprintf(stderr,
+            "dashboard_host_shim_smoke: no display, run it with xvfb-run\n");
+    return 1;
+  }
+  // A unique name from a temporary file, replaced by the directory
+  wxString dataDir =
+      wxFileName::CreateTempFileName(_T("dashboard_host_shim_smoke"));
+  bool haveDir = !dataDir.IsEmpty() && wxRemoveFile(dataDir) &&
+                 wxFileName::Mkdir(dataDir);
+  int result = 1;
+  if (haveDir) {
+    HostShimSetDataDir(dataDir);
+    result = RunSmoke();
+  } else
+    fprintf(stderr,
+            "dashboard_host_shim_smoke: cannot create a temporary directory\n");
+  wxTheApp->OnExit();
+  wxEntryCleanup();
+  if (haveDir) wxFileName::Rmdir(dataDir, wxPATH_RMDIR_RECURSIVE);
+  printf("%s\n", result ? "FAILED" : "OK");
+  return result;
+}
@@ -45,6 +45,7 @@
 #define ALTITUDE_RECORD_COUNT 30
 
 #include "instrument.h"
+#include "ring_buffer.h"
 
 class DashboardInstrument_Altitude : public DashboardInstrument {
 public:
@@ -59,7 +60,7 @@ private:
 
 protected:
   const int    c_GridLines = 4;
-  double m_ArrayAltitude[ALTITUDE_RECORD_COUNT];   // FIFO
+  RingBuffer<double, ALTITUDE_RECORD_COUNT> m_ArrayAltitude;   // FIFO
   double m_MinAltitude;
   double m_MaxAltitude;
   double m_Range = c_GridLines;    // will change in 1 2 5 steps
@@ -43,9 +43,18 @@
 
 // Warn: div by 0 if count == 1
 #define BARO_RECORD_COUNT 2000
+// Nominal seconds between records, every third sentence at 1 Hz
+#define BARO_RECORD_INTERVAL 3
 
 #include "instrument.h"
 #include "dial.h"
+#include "trace_decimator.h"
+#include "history_tiers.h"
+#include "history_file.h"
+#include "sliding_minmax.h"
+
+// Series of the pressure history store
+enum { BH_PRESS, BH_SMOOTH_PRESS, BH_SERIES };
 
 class DashboardInstrument_BaroHistory : public DashboardInstrument {
 public:
@@ -65,11 +74,14 @@ private:
 
 protected:
   double alpha;
-  double m_ArrayBaroHistory[BARO_RECORD_COUNT];
-  double m_ArrayPressHistory[BARO_RECORD_COUNT];
-  double m_ExpSmoothArrayPressure[BARO_RECORD_COUNT];
-
-  wxDateTime::Tm m_ArrayRecTime[BARO_RECORD_COUNT];
+  HistoryTiers m_History;
+  int m_Tier;  // Tier drawn, chosen from the history span setting
+  HistoryFile m_HistoryFile;
+  // Decimated trace of BH_SMOOTH_PRESS
+  TraceDecimator m_SmoothPressTrace;
+  std::vector<wxPoint> m_TracePoints;
+  // Extremes of BH_PRESS
+  SlidingMinMax m_PressMinMax;
 
   double m_MaxPress;       //...in array
   double m_MinPress;       //...in array
@@ -94,8 +106,13 @@ protected:
   void DrawBackground(wxGCDC* dc);
   void DrawForeground(wxGCDC* dc);
   void SetMinMaxWindScale();
+  void SelectTier();
+  void RestoreHistory();
+  void SetMinMaxPress();
 
   void DrawWindSpeedScale(wxGCDC* dc);
+  void DrawTrace(wxGCDC* dc, TraceDecimator& trace, int series,
+                 double offset, double ratioH);
   // wxString GetWindDirStr(wxString WindDir);
 };
 
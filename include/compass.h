@@ -61,9 +61,14 @@ public:
   ~DashboardInstrument_Compass(void) {}
 
   void SetData(DASH_CAP, double, wxString);
+  void ResetCache(void) {
+    DashboardInstrument_Dial::ResetCache();
+    m_Rose.Reset();
+  }
 
 private:
 protected:
+  CompassRoseSprite m_Rose;
   void DrawBackground(wxGCDC* dc);
   void DrawForeground(wxGCDC* dc);
 };
@@ -70,6 +70,11 @@
 #include "baro_history.h"
 #include "from_ownship.h"
 #include "iirfilter.h"
+#include "watchdog.h"
+#include "priority_arbiter.h"
+#include "derived_data.h"
+#include "layout_snapshot.h"
+#include "startup_profile.h"
 #include <wx/clrpicker.h>
 #include <wx/statline.h>
 
@@ -87,6 +92,14 @@ class DashboardInstrumentContainer;
 #define gps_watchdog_timeout_ticks GetGlobalWatchdogTimoutSeconds()
 // SignalK motor & environ instr defaults 30 sec update frequency
 #define no_nav_watchdog_timeout_ticks 40
+// Watchdog table timeout meaning "follow the OCPN WD"
+#define WATCHDOG_GPS_TIMEOUT 0
+// Re-read the OCPN priority identifiers every n seconds
+#define PRIORITY_IDS_REFRESH_TICKS 10
+// Snapshot of the layout read from the config, see LayoutSnapshot
+#define LAYOUT_SNAPSHOT_FILE _T("layout.dat")
+// Coalesce config changes made within this many ticks into one save
+#define SAVE_CONFIG_DELAY_TICKS 3
 #define GEODESIC_RAD2DEG(r) ((r) * (180.0 / M_PI))
 #define MS2KNOTS(r) ((r) * (1.9438444924406))
 #define KELVIN2C(r) ((r) - (273.15))
@@ -105,6 +118,37 @@ class OCPNFontButton;
 
 WX_DEFINE_ARRAY(InstrumentProperties*, wxArrayOfInstrumentProperties);
 
+// Watchdog data groups, index into dashboard_pi::s_WatchdogTable
+enum {
+  WD_HDM,
+  WD_HDT,
+  WD_VAR,
+  WD_SAT_USED,
+  WD_SAT_STATUS,
+  WD_MWVA,
+  WD_MWVT,
+  WD_DPT,
+  WD_STW,
+  WD_WTP,
+  WD_RSA,
+  WD_VMG,
+  WD_VMGW,
+  WD_UTC,
+  WD_ATMP,
+  WD_WDN,
+  WD_MDA,
+  WD_PITCH,
+  WD_HEEL,
+  WD_ALT,
+  WD_LOG,
+  WD_TRLOG,
+  WD_HUM,
+  WD_ENGINE,
+  WD_ENGINE_DYNAMIC,
+  WD_TANK,
+  WD_LAST  // This should always be the last enum in this list
+};
+
 class EditDialog : public wxDialog
 {
 private:
@@ -160,6 +204,8 @@ public:
     m_Style = Style;
     m_bIsVisible = false;
     m_bIsDeleted = false;
+    m_bDirty = true;
+    m_iConfigGroup = 0;
   }
 
   ~DashboardWindowContainer() {
@@ -181,6 +227,11 @@ public:
   wxSize m_Size;
   long m_Style;
   wxArrayOfInstrumentProperties m_aInstrumentPropertyList;
+  // Config bookkeeping, see dashboard_pi::SaveConfig()
+  bool m_bDirty;         // The group must be rewritten
+  int m_iConfigGroup;    // n of the DashboardN group last written, 0 if none
+  wxPoint m_SavedPosition;
+  wxSize m_SavedSize;
 };
 
 class DashboardInstrumentContainer {
@@ -190,12 +241,17 @@ public:
     m_ID = id;
     m_pInstrument = instrument;
     m_cap_flag = capa;
+    m_pProperties = NULL;
+    m_bRebuild = false;
   }
   ~DashboardInstrumentContainer() { delete m_pInstrument; }
 
   DashboardInstrument *m_pInstrument;
   int m_ID;
   CapType m_cap_flag;
+  InstrumentProperties *m_pProperties;  // Created with, NULL for defaults
+  bool m_bRebuild;  // Properties changed in place, don't reuse
+  wxString m_CreateSettings;  // GetCreateSettings() when created
 };
 
 //    Dynamic arrays of pointers need explicit macros in wx261
@@ -240,10 +296,14 @@ public:
   void ShowPreferencesDialog(wxWindow *parent);
   void SetColorScheme(PI_ColorScheme cs);
   bool SaveConfig(void);
+  // Save later, so a burst of changes is written once
+  void ScheduleSaveConfig(void) { m_iSaveConfigTicks = SAVE_CONFIG_DELAY_TICKS; }
   void PopulateContextMenu(wxMenu *menu);
   void ShowDashboard(size_t id, bool visible);
   int GetToolbarItemId() { return m_toolbar_item_id; }
   int GetDashboardWindowShownCount();
+  // Caps whose watchdog expired without a value since, for new instruments
+  const CapType &GetStaleCaps(void) const { return m_StaleCaps; }
   void SetPluginMessage(wxString &message_id, wxString &message_body);
 
 private:
@@ -251,10 +311,18 @@ private:
   void LoadFont(wxFont **target, wxString native_info);
 
   void ApplyConfig(void);
+  void SaveDashboardGroup(wxFileConfig *pConf, DashboardWindowContainer *cont,
+                          int group);
+  void SaveInstrumentProperties(wxFileConfig *pConf,
+                                InstrumentProperties *Inst);
+  void DeleteStaleDashboardGroups(wxFileConfig *pConf, int count);
+  void WriteLayoutSnapshot(uint64_t hash);
+  bool ReadLayoutSnapshot(LayoutSnapshot &s, double scaler);
   void SendSentenceToAllInstruments(DASH_CAP st, double value, wxString unit);
   void SendSatInfoToAllInstruments(int cnt, int seq, wxString talk,
                                    SAT_INFO sats[4]);
   void SendUtcTimeToAllInstruments(wxDateTime value);
+  void SendStaleToAllInstruments(DASH_CAP st, bool stale);
   // Conversion utilities
   double Celsius2Fahrenheit(double temperature);
   double Fahrenheit2Celsius(double temperature);
@@ -408,6 +476,14 @@ private:
   std::string prioN2kPGNsat;
   std::string prio130306;
 
+  // Cached result of GetActivePriorityIdentifiers()
+  enum { PRIO_SRC_UNKNOWN, PRIO_SRC_NMEA0183, PRIO_SRC_SIGNALK, PRIO_SRC_NMEA2000 };
+  static int GetPrioritySource(const std::string &identifier);
+  void UpdatePriorityIdentifiers(void);
+  std::vector<std::string> m_PriorityIDs;
+  int m_SatPrioritySource;
+  int m_PriorityIDs_Refresh;
+
   wxString m_self;
 
   wxFileConfig *m_pconfig;
@@ -418,13 +494,14 @@ private:
   int m_hide_id;
 
   NMEA0183 m_NMEA0183;  // Used to parse NMEA Sentences
-  short mPriPosition, mPriCOGSOG, mPriHeadingM, mPriHeadingT;
-  short mPriVar, mPriDateTime, mPriAWA, mPriTWA, mPriDepth;
-  short mPriSTW, mPriWTP, mPriATMP, mPriWDN, mPriSatStatus;
-  short mPriMDA, mPriHUM;
-  // Prio: Pos from O, SK gnss.satellites, GGA sats in use, SK gnss
-  // satellitesinView, GSV sats in view
-  short mPriSatUsed, mPriAlt, mPriRSA, mPriPitchRoll;
+  // Source selection per data group, e.g. depth N2K=1, SignalK=3, DPT=4,
+  // DBT=5. Sat used: Pos from O, SK gnss.satellites, GGA sats in use, SK
+  // gnss satellitesinView, GSV sats in view
+  PriorityArbiter m_Priority;
+  void LoadPriorityOrder(wxFileConfig *pConf);
+  // True wind, magnetic COG and VMG to wind, calculated from the data sent
+  DerivedData m_Derived;
+  void PublishDerived(int output);
   double mVar;
   // FFU
   int mSatsInUse;
@@ -432,41 +509,33 @@ private:
   double mHdm;
   wxDateTime mUTCDateTime;
   int m_config_version;
+  bool m_bGlobalConfigDirty;  // The keys outside the DashboardN groups
+  int m_iSaveConfigTicks;     // Countdown of ScheduleSaveConfig(), 0 = idle
+  wxString m_sLayoutSalt;     // Defaults hashed with the config section
   wxString m_VDO_accumulator;
-  int mHDx_Watchdog;
-  int mHDT_Watchdog;
-  int mSatsUsed_Wdog;
-  int mSatStatus_Wdog;
-  int mVar_Watchdog;
-  int mMWVA_Watchdog;
-  int mMWVT_Watchdog;
-  int mDPT_DBT_Watchdog;
-  int mSTW_Watchdog;
-  int mWTP_Watchdog;
-  int mRSA_Watchdog;
-  int mVMG_Watchdog;
-  int mVMGW_Watchdog;
-  int mUTC_Watchdog;
-  int mATMP_Watchdog;
-  int mWDN_Watchdog;
-  int mMDA_Watchdog;
-  int mPITCH_Watchdog;
-  int mHEEL_Watchdog;
-  int mALT_Watchdog;
-  int mLOG_Watchdog;
-  int mTrLOG_Watchdog;
-  int mHUM_Watchdog;
+
+  // Watchdogs, one table entry per data group. Feeding a group moves its
+  // deadline in m_Watchdogs, Notify only handles the groups that expired.
+  struct WatchdogEntry {
+    int timeout;          // Seconds, or WATCHDOG_GPS_TIMEOUT
+    DASH_CAP caps[3];     // Caps blanked on timeout, OCPN_DBP_STC_LAST = none
+    const wxChar *unit;
+    int priority;         // PG_ group released, or -1
+    // Fire once on the stale transition and mark the caps of
+    // [rangeFirst, rangeEnd) stale instead of blanking them every period
+    bool transitionOnly;
+    DASH_CAP rangeFirst, rangeEnd;
+  };
+  static const WatchdogEntry s_WatchdogTable[WD_LAST];
+  WatchdogWheel m_Watchdogs;
+  std::vector<int> m_ExpiredWatchdogs;
+  void FeedWatchdog(int group);
+  void OnWatchdogExpired(int group);
+  CapType m_StaleCaps;
 
   iirfilter mSOGFilter;
   iirfilter mCOGFilter;
 
-  // Engine Dashboard Parts
-  // Watchdog timer, performs two functions, firstly refresh the dashboard every second,  
-    // and secondly, if no data is received, set instruments to zero (eg. Engine switched off)
-  wxDateTime engineWatchDog;
-  wxDateTime tankLevelWatchDog;
-  wxDateTime engineWatchDogDynamic;
-
   // Store the current engine hours for displaying in the Tachometer Dial
   double mainEngineHours;
   double portEngineHours;
@@ -513,6 +582,8 @@ public:
   wxChoice *m_pChoiceWindSpeedUnit;
   wxCheckBox *m_pUseTrueWinddata;
   wxChoice *m_pChoiceTempUnit;
+  wxSpinCtrl *m_pSpinWindHistorySpan;
+  wxSpinCtrl *m_pSpinBaroHistorySpan;
   // Engine
   wxChoice* m_pChoiceTemperatureUnit;
   wxChoice* m_pChoicePressureUnit;
@@ -580,6 +651,8 @@ public:
   ~DashboardWindow();
 
   void SetColorScheme(PI_ColorScheme cs);
+  void ResetInstrumentCaches(void);
+  unsigned long GetSuppressedRepaints(void);
   void SetSizerOrientation(int orient);
   int GetSizerOrientation();
   void OnSize(wxSizeEvent &evt);
@@ -587,12 +660,15 @@ public:
   void OnContextMenu(wxContextMenuEvent &evt);
   void OnContextMenuSelect(wxCommandEvent &evt);
 
+  bool Show(bool show = true);
   bool isInstrumentListEqual(const wxArrayInt &list);
   void SetInstrumentList(wxArrayInt list, wxArrayOfInstrumentProperties* InstrumentPropertyList);
+  void RebuildInstrument(const InstrumentProperties *Properties);
   void SendSentenceToAllInstruments(DASH_CAP st, double value, wxString unit);
   void SendSatInfoToAllInstruments(int cnt, int seq, wxString talk,
                                    SAT_INFO sats[4]);
   void SendUtcTimeToAllInstruments(wxDateTime value);
+  void SendStaleToAllInstruments(DASH_CAP st, bool stale);
   void ChangePaneOrientation(int orient);
   DashboardWindowContainer *m_Container;
 
@@ -602,6 +678,15 @@ private:
   // wx2.9      wxWrapSizer*          itemBoxSizer;
   wxBoxSizer *itemBoxSizer;
   wxArrayOfInstrument m_ArrayOfInstrument;
+  // Instrument list of a hidden window, built when it is shown first
+  bool m_bInstrumentsPending;
+  wxArrayInt m_PendingList;
+  wxArrayOfInstrumentProperties *m_PendingProperties;
+
+  DashboardInstrument *CreateInstrument(int id,
+                                        InstrumentProperties *Properties);
+  void BuildInstrumentList(const wxArrayInt &list,
+                           wxArrayOfInstrumentProperties *InstrumentPropertyList);
 
   wxButton *m_tButton;
 };
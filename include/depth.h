@@ -45,6 +45,7 @@
 #define DEPTH_RECORD_COUNT 30
 
 #include "instrument.h"
+#include "ring_buffer.h"
 
 class DashboardInstrument_Depth : public DashboardInstrument {
 public:
@@ -57,7 +58,7 @@ public:
 
 private:
 protected:
-  double m_ArrayDepth[DEPTH_RECORD_COUNT];
+  RingBuffer<double, DEPTH_RECORD_COUNT> m_ArrayDepth;
   double m_MaxDepth;
   double m_Depth;
   wxString m_DepthUnit;
@@ -0,0 +1,111 @@
+/******************************************************************************
+ * derived_data.h
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Derived quantities (true wind, magnetic COG, VMG to wind)
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+/**************************************************************************
+ * How to use:                                                            *
+ *                                                                        *
+ * Set() feeds one input value (angles in degrees, speeds in knots, NaN   *
+ * if unknown). Every Set() starts a new input epoch. Each output is a    *
+ * node of a small graph which depends on a set of inputs and is          *
+ * recomputed only when one of them did change its value. The sin/cos of  *
+ * the boat vector and of the apparent wind vector are cached in their    *
+ * own nodes and shared by the true wind and the VMG node.                *
+ * Take(output) returns true once for every epoch in which a trigger      *
+ * input of that output arrived, e.g. true wind is published when         *
+ * apparent wind arrives, not when only the heading changed. After Take() *
+ * the values are read with the Get...() methods, NaN when not available. *
+ **************************************************************************
+ */
+#if !defined(DERIVED_DATA_CLASS_HEADER)
+#define DERIVED_DATA_CLASS_HEADER
+
+// Inputs
+enum {
+  DD_HDT,  // True heading
+  DD_COG,  // True course over ground
+  DD_SOG,  // Speed over ground, knots
+  DD_VAR,  // Magnetic variation, East positive
+  DD_AWA,  // Apparent wind angle relative to the bow
+  DD_AWS,  // Apparent wind speed, knots
+  DD_TWA,  // Measured true wind angle relative to the bow
+  DD_INPUTS
+};
+
+// Outputs
+enum {
+  DD_OUT_TRUEWIND,      // TWA, TWD and TWS calculated from apparent wind
+  DD_OUT_TWD_MEASURED,  // TWD from measured TWA and heading
+  DD_OUT_MCOG,          // Magnetic COG
+  DD_OUT_VMGW,          // VMG to wind
+  DD_OUTPUTS
+};
+
+class DerivedData {
+public:
+  DerivedData();
+  ~DerivedData(){};
+
+  void Reset(void);  // All inputs unknown, nothing to publish
+  void Set(int input, double value);
+  double GetInput(int input) const { return m_in[input]; }
+  bool Take(int output);
+
+  double GetTwa(void) const { return m_twa; }  // -180..180, negative = port
+  double GetTws(void) const { return m_tws; }
+  double GetTwd(void) const { return m_twd; }
+  double GetTwdMeasured(void) const { return m_twdMeasured; }
+  double GetMcog(void) const { return m_mcog; }
+  double GetVmgw(void) const { return m_vmgw; }
+
+private:
+  bool Stale(unsigned long &computed, unsigned deps) const;
+  void UpdateBoat(void);
+  void UpdateApparent(void);
+  void UpdateTrueWind(void);
+  void UpdateTwdMeasured(void);
+  void UpdateMcog(void);
+
+  unsigned long m_epoch;
+  double m_in[DD_INPUTS];
+  unsigned long m_changed[DD_INPUTS];  // Epoch the value did last change
+  unsigned long m_seen[DD_INPUTS];     // Epoch the value did last arrive
+  unsigned long m_published[DD_OUTPUTS];
+
+  // Boat velocity vector, relative to head-up
+  unsigned long m_boatEpoch;
+  double m_bsx, m_bsy;
+  // Apparent wind vector, relative to head-up
+  unsigned long m_apparentEpoch;
+  double m_awx, m_awy;
+
+  unsigned long m_trueWindEpoch;
+  double m_twa, m_tws, m_twd, m_vmgw;
+  unsigned long m_twdMeasuredEpoch;
+  double m_twdMeasured;
+  unsigned long m_mcogEpoch;
+  double m_mcog;
+};
+
+#endif
@@ -95,6 +95,8 @@ public:
 
   wxSize GetSize(int orient, wxSize hint);
   void SetData(DASH_CAP, double, wxString);
+  void SetCapStale(DASH_CAP val, bool stale);
+  void ResetCache(void) { m_StaticLayer = wxNullBitmap; }
   void SetOptionMarker(double step, DialMarkerOption option, int offset) {
     m_MarkerStep = step;
     m_MarkerOption = option;
@@ -139,8 +141,19 @@ protected:
   double m_MarkerStep, m_LabelStep;
   DialLabelOption m_LabelOption;
   wxArrayString m_LabelArray;
+  // Background, frame, labels and markers, drawn again only if one of
+  // the values it was drawn for did change
+  wxBitmap m_StaticLayer;
+  wxSize m_StaticLayerSize;
+  int m_StaticLayerScheme;
+  int m_StaticLayerAngle;
+  int m_StaticLayerTitle;
+  // Labels and markers turn with m_AngleStart, keep them out of the layer
+  bool m_bRotatingScale;
 
   virtual void Draw(wxGCDC* dc);
+  virtual void CalculateGeometry(wxGCDC* dc);
+  void DrawStaticLayer(wxGCDC* dc);
   virtual void DrawFrame(wxGCDC* dc);
   virtual void DrawMarkers(wxGCDC* dc);
   virtual void DrawLabels(wxGCDC* dc);
@@ -153,6 +166,34 @@ protected:
 /* Shared functions */
 void DrawCompassRose(wxGCDC* dc, int cx, int cy, int radius, int startangle,
                      bool showlabels, InstrumentProperties* Properties);
+
+//+------------------------------------------------------------------------------
+//|
+//| CLASS:
+//|    CompassRoseSprite
+//|
+//| DESCRIPTION:
+//|    The compass rose drawn once by DrawCompassRose() into a bitmap, which
+//|    is then only rotated by the graphics context for every heading.
+//|    Drawn again when radius, labels or colour scheme did change.
+//|
+//+------------------------------------------------------------------------------
+class CompassRoseSprite {
+public:
+  CompassRoseSprite() : m_radius(-1), m_half(0), m_scheme(-1), m_showlabels(false) {}
+  ~CompassRoseSprite(void) {}
+
+  void Reset(void) { m_Bitmap = wxNullBitmap; }
+  void Draw(wxGCDC* dc, int cx, int cy, int radius, int startangle,
+            bool showlabels, InstrumentProperties* Properties);
+
+private:
+  wxBitmap m_Bitmap;
+  int m_radius;
+  int m_half;  // Center of the bitmap
+  int m_scheme;
+  bool m_showlabels;
+};
 void DrawBoat(wxGCDC* dc, int cx, int cy, int radius);
 
 #endif  // __Dial_H__
@@ -0,0 +1,94 @@
+/******************************************************************************
+ * history_file.h
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Persistent history file of the history instruments
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+
+/**************************************************************************
+ * How to use:                                                            *
+ *                                                                        *
+ * A HistoryFile mirrors the stores of a HistoryTiers in a file of fixed  *
+ * layout in the plugin data directory: a header, then for each tier one  *
+ * record per ring slot, at the same position as the slot in memory. A    *
+ * record is the sample time, the values of all columns and a CRC-32, so  *
+ * a record torn by a crash is detected and dropped.                      *
+ * Open() is called after the tiers were filled, it restores the newest   *
+ * samples which are still within the span of their tier in one read,     *
+ * then keeps the file open for writing. Append() is called with the      *
+ * result of HistoryTiers::Aggregate() and writes only the new slots,     *
+ * Clear() empties the file with the tiers. One instrument at a time      *
+ * writes a file, others just restore from it. When the writer is closed, *
+ * the next of them calling Append() takes the file over and writes all   *
+ * its samples.                                                           *
+ * The header holds a version, the sample interval, the layout and a tag, *
+ * e.g. the speed unit; a file not matching them is started over.         *
+ **************************************************************************
+ */
+#if !defined(HISTORY_FILE_CLASS_HEADER)
+#define HISTORY_FILE_CLASS_HEADER
+
+#include <wx/file.h>
+#include <wx/string.h>
+#include "history_tiers.h"
+
+#define HISTORY_FILE_VERSION 1
+
+class HistoryFile {
+public:
+  HistoryFile();
+  ~HistoryFile() { Close(); }
+
+  void Open(const wxString &name, HistoryTiers &tiers, int tag);
+  void Close(void);
+  void Append(const HistoryTiers &tiers, unsigned added);
+  void Clear(const HistoryTiers &tiers, int tag);
+  bool IsOpen(void) const { return m_file.IsOpened(); }
+
+private:
+  struct Header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t interval;
+    uint32_t series;
+    uint32_t tag;
+    uint32_t count[HT_TIERS];
+    uint32_t crc;  // Of the fields above
+  };
+
+  void MakeHeader(const HistoryTiers &tiers, int tag);
+  bool Claim(const HistoryTiers &tiers);
+  void PackRecord(const HistoryStore &store, int tier, int slot,
+                  char *rec) const;
+  void Restore(HistoryTiers &tiers, const std::vector<char> &data) const;
+  size_t RecordSize(int tier) const { return (m_columns[tier] + 2) * 4; }
+
+  wxFile m_file;
+  wxString m_path;  // Written by this or, while not open, another one
+  Header m_header;
+  int m_columns[HT_TIERS];
+  size_t m_base[HT_TIERS];  // File offset of the records of a tier
+  size_t m_size;            // of the whole file
+  std::vector<char> m_record;
+};
+
+#endif
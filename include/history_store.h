@@ -0,0 +1,97 @@
+/******************************************************************************
+ * history_store.h
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Compact sample storage of the history instruments
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+
+/**************************************************************************
+ * How to use:                                                            *
+ *                                                                        *
+ * A HistoryStore holds 'count' samples of several series which share    *
+ * one time axis. Index 0 is the oldest sample and count-1 the newest, as *
+ * in a RingBuffer. Each series is a float array of its own, and the      *
+ * times are uint32_t seconds since HISTORY_EPOCH, 0 if the slot holds no *
+ * sample. Push(time) drops the oldest sample of all series and appends a *
+ * new slot, whose values are then written with Set().                    *
+ * GetSeries() returns a view with operator[], for TraceDecimator and     *
+ * the like. Times are expanded to wxDateTime only to draw time labels.   *
+ **************************************************************************
+ */
+#if !defined(HISTORY_STORE_CLASS_HEADER)
+#define HISTORY_STORE_CLASS_HEADER
+
+#include <ctime>
+#include <stdint.h>
+#include <vector>
+
+#define HISTORY_EPOCH 1577836800  // 2020-01-01 00:00:00 UTC
+
+class HistoryStore {
+public:
+  HistoryStore(int series, int count);
+  ~HistoryStore(){};
+
+  class Series {
+  public:
+    Series(const HistoryStore *store, int series)
+        : m_store(store), m_series(series) {}
+    double operator[](int index) const { return m_store->Get(m_series, index); }
+
+  private:
+    const HistoryStore *m_store;
+    int m_series;
+  };
+
+  void Fill(float value);  // All series, and no times
+  void Push(time_t time);
+
+  int GetCount(void) const { return m_count; }
+  float Get(int series, int index) const {
+    return m_values[series * m_count + Slot(index)];
+  }
+  void Set(int series, int index, float value) {
+    m_values[series * m_count + Slot(index)] = value;
+  }
+  Series GetSeries(int series) const { return Series(this, series); }
+  // 0 if the slot holds no sample
+  time_t GetTime(int index) const {
+    uint32_t t = m_times[Slot(index)];
+    return t ? (time_t)t + HISTORY_EPOCH : 0;
+  }
+
+private:
+  friend class HistoryFile;  // Writes and restores the slots in place
+
+  int Slot(int index) const {
+    int slot = m_start + index;
+    return slot >= m_count ? slot - m_count : slot;
+  }
+
+  int m_series;
+  int m_count;
+  int m_start;  // Slot of the oldest sample
+  std::vector<float> m_values;  // m_count samples per series
+  std::vector<uint32_t> m_times;
+};
+
+#endif
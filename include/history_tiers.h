@@ -0,0 +1,100 @@
+/******************************************************************************
+ * history_tiers.h
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Multi-resolution history of the history instruments
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+
+/**************************************************************************
+ * How to use:                                                            *
+ *                                                                        *
+ * HistoryTiers keeps the same series in three HistoryStores: the full    *
+ * rate samples, 1 minute aggregates and 10 minute aggregates. Full() is  *
+ * written by the instrument like a plain HistoryStore, Aggregate() is    *
+ * called after each full rate sample and returns a bit per tier which    *
+ * got a new slot. A slot of an aggregate tier holds the min, max and     *
+ * mean of its series, Column(series, kind) is its index in that tier's   *
+ * store. A slot is closed when the first sample of a later period        *
+ * arrives, then it is merged into the next coarser tier.                 *
+ * SelectTier() returns the finest tier which covers a time span, so a    *
+ * long span is drawn from a few hundred slots instead of every sample.   *
+ **************************************************************************
+ */
+#if !defined(HISTORY_TIERS_CLASS_HEADER)
+#define HISTORY_TIERS_CLASS_HEADER
+
+#include "history_store.h"
+
+#define HISTORY_MINUTE_SLOTS 360     // 6 hours
+#define HISTORY_TEN_MINUTE_SLOTS 288  // 48 hours
+
+enum { HT_FULL, HT_MINUTE, HT_TEN_MINUTES, HT_TIERS };
+enum { HT_MIN, HT_MAX, HT_MEAN, HT_KINDS };
+
+class HistoryTiers {
+public:
+  // 'interval' is the nominal number of seconds between full rate samples
+  HistoryTiers(int series, int count, int interval);
+  ~HistoryTiers(){};
+
+  void Fill(float value);  // All tiers, and no times
+  HistoryStore &Full(void) { return m_tier[HT_FULL]; }
+  unsigned Aggregate(void);
+
+  const HistoryStore &GetTier(int tier) const { return m_tier[tier]; }
+  static int Column(int series, int kind) { return series * HT_KINDS + kind; }
+  // 'kind' is ignored for the full rate tier
+  HistoryStore::Series GetSeries(int tier, int series,
+                                 int kind = HT_MEAN) const {
+    return m_tier[tier].GetSeries(tier == HT_FULL ? series
+                                                  : Column(series, kind));
+  }
+  int GetSamples(int tier) const { return m_samples[tier]; }
+  int GetSpan(int tier) const;  // Seconds covered by a full tier
+  int SelectTier(int seconds) const;
+  // Extremes of a series over a tier, including the slots still open.
+  // False if there are no samples.
+  bool GetRange(int tier, int series, double &min, double &max) const;
+
+private:
+  friend class HistoryFile;  // Restores the tiers in place
+
+  struct Slot {
+    time_t time;  // Start of the period, the sample time in m_sample
+    int n;        // Full rate samples
+    std::vector<float> min, max;
+    std::vector<double> sum;
+  };
+
+  void Merge(Slot &slot, const Slot &in);
+  unsigned Add(int tier, const Slot &in);
+  void Close(int tier);
+
+  int m_series;
+  int m_interval;
+  std::vector<HistoryStore> m_tier;
+  int m_samples[HT_TIERS];
+  Slot m_open[HT_TIERS];  // Period being aggregated, unused for HT_FULL
+  Slot m_sample;          // Newest full rate sample
+};
+
+#endif
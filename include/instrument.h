@@ -150,46 +150,115 @@ using CapType = std::bitset<N_INSTRUMENTS>;
 
 wxColour GetColourSchemeBackgroundColour(wxColour co);
 wxColour GetColourSchemeFont(wxColour co);
+// GetTextExtent() with a process wide cache keyed on font and text, for
+// titles and templates only, not for data values
+void GetTextExtentCached(wxDC &dc, const wxString &text, int *w, int *h,
+                         const wxFont &font);
+void ResetTextExtentCache(void);
+
+// Global colour scheme colours used by the instruments
+enum {
+  DC_DASH1,
+  DC_DASH2,
+  DC_DASHB,
+  DC_DASHF,
+  DC_DASHG,
+  DC_DASHL,
+  DC_DASHN,
+  DC_DASHR,
+  DC_BLUE3,
+  DC_UBLCK,
+  DC_LAST  // This should always be the last enum in this list
+};
+// GetGlobalColor() of the current colour scheme, looked up once per change
+const wxColour &DashColour(int colour);
+
+class InstrumentProperties;
+class InstrumentStyle;
+
+// Colours of one instrument in the current colour scheme. Draw code reads
+// them instead of calling GetColourScheme...() or GetGlobalColor() per paint.
+// Without properties the palette follows the global fonts and colours.
+class InstrumentPalette {
+public:
+  InstrumentPalette() : m_Generation(0) {}
+  void Resolve(const InstrumentStyle *style);
+
+  wxColour m_DataBackground;
+  wxColour m_TitleBackground;
+  wxColour m_TitleFont;
+  wxColour m_DataFont;
+  wxColour m_LabelFont;
+  wxColour m_SmallFont;
+  wxColour m_ArrowFirst;
+  wxColour m_ArrowSecond;
+  wxBrush m_DataBackgroundBrush;
+  wxBrush m_TitleBackgroundBrush;
+  wxPen m_TitleBackgroundPen;
+  unsigned m_Generation;  // Resolved for this ResetInstrumentPalettes() call
+};
+const InstrumentPalette &GetInstrumentPalette(InstrumentProperties *Properties);
+// After colour scheme, font or instrument property changes
+void ResetInstrumentPalettes(void);
+
+// Fonts and colours of an instrument. Equal styles are interned into one
+// shared object which is never changed, so all instruments with the same
+// look use the same one. A change copies the style, modifies the copy and
+// interns that. The interned object also holds the palette of its colours.
+class InstrumentStyle {
+public:
+  bool operator==(const InstrumentStyle &style) const;
+  bool operator!=(const InstrumentStyle &style) const {
+    return !(*this == style);
+  }
+
+  // The shared copy of 'style', give it back with Release()
+  static const InstrumentStyle *Intern(const InstrumentStyle &style);
+  // Interned style of the global fonts and colours
+  static const InstrumentStyle *Default(void);
+  static void Release(const InstrumentStyle *style);
+  static size_t GetInternedCount(void);
+
+  wxFontData m_TitelFont;
+  wxColour m_TitlelBackgroundColour;
+  wxFontData m_DataFont;
+  wxColour m_DataBackgroundColour;
+  wxFontData m_LabelFont;
+  wxFontData m_SmallFont;
+  wxColour m_Arrow_First_Colour;
+  wxColour m_Arrow_Second_Colour;
+  mutable InstrumentPalette m_Palette;  // Cache, not part of the style
+};
 
 class InstrumentProperties {
 public:
-    InstrumentProperties() { SetDefault(); }
+    InstrumentProperties() : m_Style(NULL) { SetDefault(); }
     InstrumentProperties(int aInstrument, int Listplace) {
         m_aInstrument = aInstrument;
         m_Listplace = Listplace;
-        m_TitelFont = *(g_pFontTitle);
-        m_DataFont = *(g_pFontData);
-        m_LabelFont = *(g_pFontLabel);
-        m_SmallFont = *(g_pFontSmall);
-        GetGlobalColor(_T("DASHL"), &m_TitlelBackgroundColour);
-        GetGlobalColor(_T("DASHB"), &m_DataBackgroundColour);
-        GetGlobalColor(_T("DASHN"), &m_Arrow_First_Colour);
-        GetGlobalColor(_T("BLUE3"), &m_Arrow_Second_Colour);
+        m_bDirty = true;
+        m_Style = InstrumentStyle::Default();
     }
-    ~InstrumentProperties() {}
+    ~InstrumentProperties() { InstrumentStyle::Release(m_Style); }
     void SetDefault()
     {
         m_aInstrument = -1;
         m_Listplace = -1;
-        m_TitelFont = *(g_pFontTitle);
-        m_DataFont = *(g_pFontData);
-        m_LabelFont = *(g_pFontLabel);
-        m_SmallFont = *(g_pFontSmall);
-        GetGlobalColor(_T("DASHL"), &m_TitlelBackgroundColour);
-        GetGlobalColor(_T("DASHB"), &m_DataBackgroundColour);
-        GetGlobalColor(_T("DASHN"), &m_Arrow_First_Colour);
-        GetGlobalColor(_T("BLUE3"), &m_Arrow_Second_Colour);
+        m_bDirty = true;
+        const InstrumentStyle *style = InstrumentStyle::Default();
+        InstrumentStyle::Release(m_Style);
+        m_Style = style;
     };
+    const InstrumentStyle &Style() const { return *m_Style; }
+    void SetStyle(const InstrumentStyle &style);
     int m_aInstrument;
     int m_Listplace;
-    wxFontData m_TitelFont;
-    wxColour m_TitlelBackgroundColour;
-    wxFontData m_DataFont;
-    wxColour m_DataBackgroundColour;
-    wxFontData m_LabelFont;
-    wxFontData m_SmallFont;
-    wxColour m_Arrow_First_Colour;
-    wxColour m_Arrow_Second_Colour;
+    bool m_bDirty;  // Style not yet written to the config
+
+private:
+    InstrumentProperties(const InstrumentProperties &);
+    InstrumentProperties &operator=(const InstrumentProperties &);
+    const InstrumentStyle *m_Style;
 };
 
 class DashboardInstrument : public wxControl {
@@ -207,11 +276,23 @@ public:
   void MouseEvent(wxMouseEvent &event);
   void SetCapFlag(DASH_CAP val) { m_cap_flag.set(val); }
   bool HasCapFlag(DASH_CAP val) { return m_cap_flag.test(val); }
+  // Source of this cap has gone silent, show "stale" instead of old data
+  virtual void SetCapStale(DASH_CAP val, bool stale);
+  bool IsCapStale(DASH_CAP val) { return m_stale_flag.test(val); }
+  // Drop cached drawings, after colour scheme or property changes
+  virtual void ResetCache(void) {}
+  // SetData() calls which did not change the displayed text
+  unsigned long GetSuppressedRepaints() { return m_SuppressedRepaints; }
   int instrumentTypeId;
   InstrumentProperties *m_Properties;
 
 protected:
+  const InstrumentPalette &Palette() {
+    return GetInstrumentPalette(m_Properties);
+  }
   CapType m_cap_flag;
+  CapType m_stale_flag;
+  unsigned long m_SuppressedRepaints;
   int m_TitleHeight;
   wxString m_title;
   virtual void Draw(wxGCDC *dc) = 0;
@@ -228,12 +309,17 @@ public:
 
   wxSize GetSize(int orient, wxSize hint);
   void SetData(DASH_CAP st, double data, wxString unit);
+  void SetCapStale(DASH_CAP val, bool stale);
 
 protected:
   wxString m_data;
   wxString m_format;
   int m_DataHeight;
   InstrumentProperties* m_Properties;
+  // Input m_data was formatted from, m_bLastValid is false after "---"
+  double m_LastData;
+  wxString m_LastUnit;
+  bool m_bLastValid;
 
   void Draw(wxGCDC *dc);
 };
@@ -254,6 +340,9 @@ protected:
   wxString m_data2;
   DASH_CAP m_cap_flag1;
   DASH_CAP m_cap_flag2;
+  // Shown positions, in thousandths of a minute as toSDMM() displays them
+  long long m_Shown1;
+  long long m_Shown2;
   int m_DataHeight;
 
   void Draw(wxGCDC *dc);
@@ -267,12 +356,14 @@ public:
 
     wxSize GetSize(int orient, wxSize hint);
     void SetData(DASH_CAP st, double data, wxString unit);
+    void SetCapStale(DASH_CAP val, bool stale);
 
 protected:
     wxString          m_data;
     wxString          m_format;
     int               m_DataHeight;
     int 			  m_Value;
+    int               m_ShownValue;  // -1 when "---" is shown
 
     void Draw(wxGCDC* dc);
 };
@@ -0,0 +1,95 @@
+/******************************************************************************
+ * layout_snapshot.h
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Binary snapshot of the dashboard layout
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+
+/**************************************************************************
+ * How to use:                                                            *
+ *                                                                        *
+ * A LayoutSnapshot is a file in the plugin data directory holding the    *
+ * layout read from the config, with fonts and colours already decoded,   *
+ * so a restart does not need to read and parse each key again.           *
+ * The config stays the source of truth: the file is only used when its   *
+ * hash matches HashConfig() of the current config section, else the      *
+ * config is read as before and a new snapshot written.                   *
+ * Writing: Put...() the values, then Save(). Reading: Load() the file    *
+ * in one read, then Get...() the values in the same order. A Get past    *
+ * the end returns a default value and makes IsOk() false.                *
+ * LAYOUT_SNAPSHOT_VERSION must be raised when the order or the meaning   *
+ * of the values changes.                                                 *
+ **************************************************************************
+ */
+#if !defined(LAYOUT_SNAPSHOT_CLASS_HEADER)
+#define LAYOUT_SNAPSHOT_CLASS_HEADER
+
+#include <wx/colour.h>
+#include <wx/config.h>
+#include <wx/font.h>
+#include <wx/string.h>
+#include <stdint.h>
+#include <vector>
+
+#define LAYOUT_SNAPSHOT_VERSION 1
+
+class LayoutSnapshot {
+public:
+  LayoutSnapshot() : m_pos(0), m_ok(true) {}
+
+  // Hash of all entries below 'path' and of 'salt', e.g. the defaults
+  static uint64_t HashConfig(wxConfigBase *pConf, const wxString &path,
+                             const wxString &salt);
+
+  bool Load(const wxString &name, uint64_t hash);
+  bool Save(const wxString &name, uint64_t hash) const;
+  bool IsOk(void) const { return m_ok; }
+
+  void PutInt(int32_t value);
+  void PutDouble(double value);
+  void PutString(const wxString &value);
+  void PutColour(const wxColour &colour);
+  void PutFont(const wxFont &font);
+
+  int32_t GetInt(void);
+  double GetDouble(void);
+  wxString GetString(void);
+  wxColour GetColour(void);
+  wxFont GetFont(void);
+
+private:
+  struct Header {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t hash;  // Of the config section
+    uint64_t size;  // Of the values
+    uint64_t check; // Of the values
+  };
+
+  bool Get(void *value, size_t size);
+
+  std::vector<char> m_data;
+  size_t m_pos;
+  bool m_ok;
+};
+
+#endif
@@ -0,0 +1,118 @@
+/******************************************************************************
+ * priority_arbiter.h
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Source priority arbitration per data group
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+/**************************************************************************
+ * How to use:                                                            *
+ *                                                                        *
+ * Every data group (position, depth, heading ...) has its own set of     *
+ * sources, numbered 1..PRIORITY_SOURCES-1. By default the source number  *
+ * is also its rank, lower is better, e.g. for depth N2K=1, SignalK=3,    *
+ * DPT=4, DBT=5. A handler asks Accept(group, source) before doing any    *
+ * work and calls Won(group, source) after it has sent the data. The      *
+ * watchdog calls Release(group) when the winning source went silent, so  *
+ * any source is accepted again.                                          *
+ * SetOrder() overrides the ranks of a group with a per-boat order, the   *
+ * listed sources come first, all others keep their default order behind *
+ * them. Both decisions are a table lookup.                               *
+ * For every group the arbiter counts the wins per source and how often   *
+ * the winning source changed (flaps).                                    *
+ **************************************************************************
+ */
+#if !defined(PRIORITY_ARBITER_CLASS_HEADER)
+#define PRIORITY_ARBITER_CLASS_HEADER
+
+#include <string>
+#include <vector>
+
+// Data groups arbitrated independently
+enum {
+  PG_POSITION,
+  PG_COGSOG,
+  PG_HEADING_M,
+  PG_HEADING_T,
+  PG_VAR,
+  PG_DATETIME,
+  PG_AWA,
+  PG_TWA,
+  PG_WDN,
+  PG_DEPTH,
+  PG_STW,
+  PG_WTP,
+  PG_ATMP,
+  PG_MDA,
+  PG_HUM,
+  PG_SAT_STATUS,
+  PG_SAT_USED,
+  PG_ALT,
+  PG_RSA,
+  PG_PITCH_ROLL,
+  PG_VMGW,
+  PG_LAST  // This should always be the last enum in this list
+};
+
+#define PRIORITY_SOURCES 10  // Source numbers 1..9, 0 = no source
+#define PRIORITY_NONE 99     // Rank of a released group
+
+class PriorityArbiter {
+public:
+  PriorityArbiter();
+  ~PriorityArbiter(){};
+
+  void Reset(void);       // Release all groups, keep order and statistics
+  void ResetOrder(void);  // Back to the default ranks
+  bool SetOrder(int group, const std::vector<int> &sources);
+
+  bool Accept(int group, int source) const {
+    return m_rank[group][source] <= m_current[group];
+  }
+  bool IsActive(int group, int source) const {
+    return m_source[group] == source;
+  }
+  void Won(int group, int source);
+  void Release(int group) {
+    m_current[group] = PRIORITY_NONE;
+    m_source[group] = 0;
+  }
+
+  int GetRank(int group) const { return m_current[group]; }
+  int GetSource(int group) const { return m_source[group]; }
+  unsigned long GetWins(int group, int source) const {
+    return m_wins[group][source];
+  }
+  unsigned long GetFlaps(int group) const { return m_flaps[group]; }
+
+  static const char *GetGroupName(int group);
+  static int GetGroup(const std::string &name);  // -1 if unknown
+
+private:
+  short m_current[PG_LAST];  // Rank of the winning source
+  unsigned char m_source[PG_LAST];
+  unsigned char m_lastWinner[PG_LAST];
+  unsigned char m_rank[PG_LAST][PRIORITY_SOURCES];
+  unsigned long m_wins[PG_LAST][PRIORITY_SOURCES];
+  unsigned long m_flaps[PG_LAST];
+};
+
+#endif
@@ -0,0 +1,90 @@
+/******************************************************************************
+ * ring_buffer.h
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Fixed capacity ring buffer for instrument histories
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+
+/**************************************************************************
+ * How to use:                                                            *
+ *                                                                        *
+ * RingBuffer<T, N> is a window of always N entries, index 0 is the       *
+ * oldest and N-1 the newest, like the shifted arrays it replaces.        *
+ * Fill() sets all entries, e.g. to an "empty" marker. Push() drops the   *
+ * oldest entry and appends a new one by moving the start index, no data  *
+ * is copied. Iteration with begin()/end() runs from oldest to newest.    *
+ **************************************************************************
+ */
+#if !defined(RING_BUFFER_CLASS_HEADER)
+#define RING_BUFFER_CLASS_HEADER
+
+template <class T, int N>
+class RingBuffer {
+public:
+  RingBuffer() : m_start(0) {}
+
+  void Fill(const T &value) {
+    for (int i = 0; i < N; i++) m_data[i] = value;
+    m_start = 0;
+  }
+  void Push(const T &value) {
+    m_data[m_start] = value;
+    if (++m_start == N) m_start = 0;
+  }
+
+  T &operator[](int index) { return m_data[Slot(index)]; }
+  const T &operator[](int index) const { return m_data[Slot(index)]; }
+  T &Oldest(void) { return m_data[m_start]; }
+  T &Newest(void) { return m_data[Slot(N - 1)]; }
+  static int Size(void) { return N; }
+
+  class const_iterator {
+  public:
+    const_iterator(const RingBuffer *ring, int index)
+        : m_ring(ring), m_index(index) {}
+    const T &operator*() const { return (*m_ring)[m_index]; }
+    const_iterator &operator++() {
+      m_index++;
+      return *this;
+    }
+    bool operator!=(const const_iterator &other) const {
+      return m_index != other.m_index;
+    }
+
+  private:
+    const RingBuffer *m_ring;
+    int m_index;
+  };
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, N); }
+
+private:
+  int Slot(int index) const {
+    int slot = m_start + index;
+    return slot >= N ? slot - N : slot;
+  }
+
+  T m_data[N];
+  int m_start;  // Slot of the oldest entry
+};
+
+#endif
@@ -0,0 +1,65 @@
+/******************************************************************************
+ * sliding_minmax.h
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Minimum and maximum of the last N samples
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+
+/**************************************************************************
+ * How to use:                                                            *
+ *                                                                        *
+ * Push() every sample which goes into a history of 'count' samples,      *
+ * GetMin()/GetMax() are the extremes of the samples still in it.         *
+ * Two monotonic deques hold only the samples which can still become the  *
+ * minimum or maximum, so a push costs amortised O(1) instead of a scan   *
+ * of the whole history.                                                  *
+ **************************************************************************
+ */
+#if !defined(SLIDING_MINMAX_CLASS_HEADER)
+#define SLIDING_MINMAX_CLASS_HEADER
+
+#include <deque>
+
+class SlidingMinMax {
+public:
+  SlidingMinMax(int count);
+  ~SlidingMinMax(){};
+
+  void Reset(void);  // No samples
+  void Push(double value);
+  bool IsEmpty(void) const { return m_max.empty(); }
+  double GetMin(void) const { return m_min.front().value; }
+  double GetMax(void) const { return m_max.front().value; }
+
+private:
+  struct Sample {
+    long long seq;
+    double value;
+  };
+
+  int m_count;
+  long long m_total;  // Samples pushed since construction
+  std::deque<Sample> m_min;  // Ascending values, oldest first
+  std::deque<Sample> m_max;  // Descending values, oldest first
+};
+
+#endif
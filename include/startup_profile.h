@@ -0,0 +1,96 @@
+/******************************************************************************
+ * startup_profile.h
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Timing of the plugin start and of layout changes
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+/**************************************************************************
+ * How to use:                                                            *
+ *                                                                        *
+ * A StartupProfile records where the time of a cycle goes, e.g. Init or  *
+ * applying the preferences. Begin() starts a cycle, Add() adds the time  *
+ * since a start point to a named phase, phases of the same name are      *
+ * summed and counted (e.g. the creation of all instruments of a type).   *
+ * ProfileScope does that for a block. End() closes the cycle, Add() is   *
+ * ignored outside a cycle. Paint() is called by the instruments, the     *
+ * first paint after Begin() is added to the cycle, even after End().     *
+ * The cycle of Init and the last PROFILE_CYCLES - 1 others are kept.     *
+ **************************************************************************
+ */
+#if !defined(STARTUP_PROFILE_CLASS_HEADER)
+#define STARTUP_PROFILE_CLASS_HEADER
+
+#include <chrono>
+#include <vector>
+#include <wx/string.h>
+#include <wx/jsonval.h>
+
+#define PROFILE_CYCLES 5
+
+class StartupProfile {
+public:
+  typedef std::chrono::steady_clock Clock;
+
+  StartupProfile() : m_open(false), m_waitPaint(false) {}
+
+  void Begin(const wxString &cycle);
+  void Add(const wxString &phase, Clock::time_point start);
+  void End(void);
+  void Paint(Clock::time_point start);
+
+  void Log(void) const;  // To the OpenCPN log
+  wxJSONValue ToJSON(void) const;
+
+private:
+  struct Phase {
+    wxString name;
+    int count;
+    Clock::duration time;
+  };
+  struct Cycle {
+    wxString name;
+    Clock::time_point start;
+    std::vector<Phase> phases;
+  };
+
+  void AddTo(Cycle &cycle, const wxString &phase, Clock::duration time);
+
+  std::vector<Cycle> m_cycles;  // The current one is the last
+  bool m_open;
+  bool m_waitPaint;
+};
+
+// Adds the time until the end of the block to a phase
+class ProfileScope {
+public:
+  ProfileScope(StartupProfile &profile, const wxString &phase)
+      : m_profile(profile), m_phase(phase),
+        m_start(StartupProfile::Clock::now()) {}
+  ~ProfileScope() { m_profile.Add(m_phase, m_start); }
+
+private:
+  StartupProfile &m_profile;
+  wxString m_phase;
+  StartupProfile::Clock::time_point m_start;
+};
+
+#endif
@@ -0,0 +1,127 @@
+/******************************************************************************
+ * trace_decimator.h
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Min/max per pixel column decimation of history traces
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+
+/**************************************************************************
+ * How to use:                                                            *
+ *                                                                        *
+ * A history instrument keeps 'count' samples in a window, index 0 is the *
+ * oldest and count-1 the newest, one shift per sample. The decimator     *
+ * splits the samples into buckets of about one pixel column each and     *
+ * keeps only the minimum and maximum of every bucket, so a trace has at  *
+ * most two points per column however long the history is.               *
+ * Push(window) is called after the newest sample was stored at           *
+ * window[count-1], it updates the last bucket and drops the samples that *
+ * left the window. SetColumns() returns true when the plot width changed *
+ * the bucket size, then Rebuild() fills the buckets again. The buckets   *
+ * hold values, not pixels, so scale changes need no rebuild.             *
+ * SetCount() switches to a window of another length, e.g. another tier   *
+ * of a HistoryTiers, the next SetColumns() then asks for a Rebuild().    *
+ * 'window' is anything with operator[](int) returning the sample value.  *
+ **************************************************************************
+ */
+#if !defined(TRACE_DECIMATOR_CLASS_HEADER)
+#define TRACE_DECIMATOR_CLASS_HEADER
+
+#include <deque>
+#include <vector>
+#include <wx/gdicmn.h>
+
+class TraceDecimator {
+public:
+  TraceDecimator(int count);
+  ~TraceDecimator(){};
+
+  void Reset(void);  // History cleared, no samples
+  void SetCount(int count);
+  bool SetColumns(int columns);
+
+  template <class W>
+  void Push(const W &window) {
+    m_total++;
+    Add(m_total - 1, window[m_count - 1]);
+    Trim(window);
+  }
+
+  // 'samples' are the newest entries of the window
+  template <class W>
+  void Rebuild(const W &window, int samples) {
+    m_buckets.clear();
+    for (int i = m_count - samples; i < m_count; i++)
+      Add(m_total - m_count + i, window[i]);
+  }
+
+  // Pixels of the trace, oldest first. A sample at window index i is drawn
+  // at x0 + i * ratioW, y0 - (value - offset) * ratioH. Points outside
+  // top < y <= bottom are left out. Returns the number of points.
+  int GetPoints(std::vector<wxPoint> &points, double x0, double ratioW,
+                double y0, double offset, double ratioH, int top,
+                int bottom) const;
+
+private:
+  struct Bucket {
+    long long first;  // Sequence number of the first sample
+    int n;
+    long long minSeq, maxSeq;
+    double min, max;
+  };
+
+  void Add(long long seq, double value);
+
+  // The oldest bucket may have lost samples to the window, its extremes are
+  // looked up again from the samples still in it.
+  template <class W>
+  void Trim(const W &window) {
+    long long start = m_total - m_count;  // Sequence number of window[0]
+    while (!m_buckets.empty() &&
+           m_buckets.front().first + m_buckets.front().n <= start)
+      m_buckets.pop_front();
+    if (m_buckets.empty() || m_buckets.front().first >= start) return;
+    Bucket &b = m_buckets.front();
+    b.n -= (int)(start - b.first);
+    b.first = start;
+    if (b.minSeq >= start && b.maxSeq >= start) return;
+    b.minSeq = b.maxSeq = start;
+    b.min = b.max = window[0];
+    for (int i = 1; i < b.n; i++) {
+      double v = window[i];
+      if (v < b.min) {
+        b.min = v;
+        b.minSeq = start + i;
+      }
+      if (v > b.max) {
+        b.max = v;
+        b.maxSeq = start + i;
+      }
+    }
+  }
+
+  int m_count;            // Samples in the window
+  int m_bucket;           // Samples per bucket
+  long long m_total;      // Samples pushed since construction
+  std::deque<Bucket> m_buckets;
+};
+
+#endif
@@ -0,0 +1,78 @@
+/******************************************************************************
+ * watchdog.h
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Hashed timing wheel used to time out stale instrument data
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+/**************************************************************************
+ * How to use:                                                            *
+ *                                                                        *
+ * Create one WatchdogWheel with the number of entries (data groups) it   *
+ * has to handle. Arm() sets or moves the deadline of an entry, which is  *
+ * an O(1) unlink/link into the wheel slot of that deadline. Disarm()     *
+ * removes an entry from the wheel. Advance() is called from the 1 second *
+ * timer and returns only the entries whose deadline has passed; those    *
+ * entries are disarmed and have to be armed again by the caller.         *
+ * Deadlines are taken from std::chrono::steady_clock, so changing the    *
+ * system time (e.g. from GPS) does not fire or hold back any entry.      *
+ **************************************************************************
+ */
+#if !defined(WATCHDOG_CLASS_HEADER)
+#define WATCHDOG_CLASS_HEADER
+
+#include <chrono>
+#include <vector>
+
+class WatchdogWheel {
+public:
+  typedef std::chrono::steady_clock Clock;
+
+  WatchdogWheel(int entries = 0);
+  ~WatchdogWheel(){};
+
+  void Resize(int entries);           // Set number of entries, all disarmed
+  void Arm(int id, Clock::time_point deadline);
+  void Arm(int id, int seconds) { Arm(id, Clock::now() + std::chrono::seconds(seconds)); }
+  void Disarm(int id);
+  bool IsArmed(int id) const { return m_slot[id] >= 0; }
+  // Collect all entries expired at 'now' into 'expired' (cleared first)
+  void Advance(Clock::time_point now, std::vector<int>& expired);
+
+private:
+  // One slot per second, timeouts longer than the wheel wrap around and
+  // are skipped until their tick is reached.
+  static const int WHEEL_SLOTS = 64;
+
+  long long ToTick(Clock::time_point t) const;
+  void Link(int id, int slot);
+  void Unlink(int id);
+
+  Clock::time_point m_origin;
+  long long m_lastTick;
+  int m_head[WHEEL_SLOTS];
+  std::vector<int> m_next;
+  std::vector<int> m_prev;
+  std::vector<int> m_slot;       // -1 when disarmed
+  std::vector<long long> m_tick; // deadline tick of the entry
+};
+
+#endif
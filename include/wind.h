@@ -70,9 +70,14 @@ public:
                                   InstrumentProperties* Properties, DASH_CAP cap_flag);
 
   ~DashboardInstrument_WindCompass(void) {}
+  void ResetCache(void) {
+    DashboardInstrument_Dial::ResetCache();
+    m_Rose.Reset();
+  }
 
 private:
 protected:
+  CompassRoseSprite m_Rose;
   void DrawBackground(wxGCDC* dc);
 };
 
@@ -110,6 +115,7 @@ protected:
       m_ExtraValueOption1, m_ExtraValueOption2;
   void DrawBackground(wxGCDC* dc);
   virtual void Draw(wxGCDC* dc);
+  virtual void CalculateGeometry(wxGCDC* dc);
   virtual void DrawForeground(wxGCDC* dc);
   virtual void DrawData(wxGCDC* dc, double value, wxString unit,
                         wxString format, DialPositionOption position);
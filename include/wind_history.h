@@ -43,9 +43,18 @@
 
 // Warn: div by 0 if count == 1
 #define WIND_RECORD_COUNT 2000
+// Nominal seconds between records, every third sentence at 1 Hz
+#define WIND_RECORD_INTERVAL 3
 
 #include "instrument.h"
 #include "dial.h"
+#include "trace_decimator.h"
+#include "history_tiers.h"
+#include "history_file.h"
+#include "sliding_minmax.h"
+
+// Series of the wind history store
+enum { WH_DIR, WH_SPD, WH_SMOOTH_DIR, WH_SMOOTH_SPD, WH_SERIES };
 
 class DashboardInstrument_WindDirHistory : public DashboardInstrument {
 public:
@@ -63,11 +72,18 @@ private:
 
 protected:
   double alpha;
-  double m_ArrayWindDirHistory[WIND_RECORD_COUNT];
-  double m_ArrayWindSpdHistory[WIND_RECORD_COUNT];
-  double m_ExpSmoothArrayWindSpd[WIND_RECORD_COUNT];
-  double m_ExpSmoothArrayWindDir[WIND_RECORD_COUNT];
-  wxDateTime::Tm m_ArrayRecTime[WIND_RECORD_COUNT];
+  HistoryTiers m_History;
+  int m_Tier;  // Tier drawn, chosen from the history span setting
+  HistoryFile m_HistoryFile;
+  // Decimated traces of the WH_ series
+  TraceDecimator m_DirTrace;
+  TraceDecimator m_SpdTrace;
+  TraceDecimator m_SmoothDirTrace;
+  TraceDecimator m_SmoothSpdTrace;
+  std::vector<wxPoint> m_TracePoints;
+  // Extremes of WH_DIR and WH_SPD
+  SlidingMinMax m_DirMinMax;
+  SlidingMinMax m_SpdMinMax;
 
   double m_MaxWindDir;
   double m_MinWindDir;
@@ -95,9 +111,15 @@ protected:
   void Draw(wxGCDC* dc);
   void DrawBackground(wxGCDC* dc);
   void DrawForeground(wxGCDC* dc);
+  void SelectTier();
+  void RestoreHistory();
+  bool GetExtremes(const SlidingMinMax& minmax, int series, double& min,
+                   double& max);
   void SetMinMaxWindScale();
   void DrawWindDirScale(wxGCDC* dc);
   void DrawWindSpeedScale(wxGCDC* dc);
+  void DrawTrace(wxGCDC* dc, TraceDecimator& trace, int series,
+                 double offset, double ratioH);
   void ResetData();
   wxString GetWindDirStr(wxString WindDir);
 };
@@ -55,9 +55,7 @@ DashboardInstrument_Altitude::DashboardInstrument_Altitude(wxWindow* parent,
   m_Altitude = 0;
   m_AltitudeUnit = getUsrDistanceUnit_Plugin(g_iDashDepthUnit);
   m_Temp = _T("--");
-  for (int idx = 0; idx < ALTITUDE_RECORD_COUNT; idx++) {
-    m_ArrayAltitude[idx] = 0.0;
-  }
+  m_ArrayAltitude.Fill(0.0);
 }
 
 wxSize DashboardInstrument_Altitude::GetSize(int orient, wxSize hint) {
@@ -66,22 +64,22 @@ wxSize DashboardInstrument_Altitude::GetSize(int orient, wxSize hint) {
   wxFont f;
   if (m_Properties)
   {
-      f = m_Properties->m_TitelFont.GetChosenFont();
-      dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
-      f = m_Properties->m_DataFont.GetChosenFont();
-      dc.GetTextExtent("15.7 Feet", &w, &m_aDataHeight, 0, 0, &f);
-      f = m_Properties->m_LabelFont.GetChosenFont();
-      dc.GetTextExtent("20.8 C", &x_alabel, &y_alabel, 0, 0, &f);
+      f = m_Properties->Style().m_TitelFont.GetChosenFont();
+      GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
+      f = m_Properties->Style().m_DataFont.GetChosenFont();
+      GetTextExtentCached(dc, "15.7 Feet", &w, &m_aDataHeight, f);
+      f = m_Properties->Style().m_LabelFont.GetChosenFont();
+      GetTextExtentCached(dc, "20.8 C", &x_alabel, &y_alabel, f);
   }
   else
   {
       f = g_pFontTitle->GetChosenFont();
-      dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
+      GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
       f = g_pFontData->GetChosenFont();
-      dc.GetTextExtent("15.7 Feet", &w, &m_aDataHeight, 0, 0, &f);
+      GetTextExtentCached(dc, "15.7 Feet", &w, &m_aDataHeight, f);
       // Space for bottom(temp)text later.
       f = g_pFontLabel->GetChosenFont();
-      dc.GetTextExtent("20.8 C", &x_alabel, &y_alabel, 0, 0, &f);
+      GetTextExtentCached(dc, "20.8 C", &x_alabel, &y_alabel, f);
   }
   int y_total =
       //  Title         Alt. data       plot area     air-temp
@@ -101,13 +99,11 @@ void DashboardInstrument_Altitude::SetData(DASH_CAP st, double data,
     //printf("Altitude = %3.3f\n", m_Altitude); // debug output
 
     // save FLOPS by just accumulating the FIFO changes
-    m_meanAltitude += (m_Altitude - m_ArrayAltitude[0]) / ALTITUDE_RECORD_COUNT;
-    m_sum2Altitude += (m_Altitude*m_Altitude - m_ArrayAltitude[0]*m_ArrayAltitude[0]);
+    double oldest = m_ArrayAltitude.Oldest();
+    m_meanAltitude += (m_Altitude - oldest) / ALTITUDE_RECORD_COUNT;
+    m_sum2Altitude += (m_Altitude*m_Altitude - oldest*oldest);
     
-    for (int idx = 1; idx < ALTITUDE_RECORD_COUNT; idx++) {
-      m_ArrayAltitude[idx - 1] = m_ArrayAltitude[idx];      // shift FIFO
-    }
-    m_ArrayAltitude[ALTITUDE_RECORD_COUNT - 1] = m_Altitude;
+    m_ArrayAltitude.Push(m_Altitude);      // shift FIFO
     m_AltitudeUnit = unit;
   } else if (st == OCPN_DBP_STC_ATMP) {
     if (!std::isnan(data)) {
@@ -168,25 +164,22 @@ void DashboardInstrument_Altitude::DrawBackground(wxGCDC* dc) {
   wxColour cl;
   if (m_Properties)
   {
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_LabelFont.GetColour()));
+      dc->SetTextForeground(Palette().m_LabelFont);
   }
   else
   {
-      if (GetColourSchemeFont(g_pFontSmall->GetColour()) == GetColourSchemeFont(g_pFontLabel->GetColour()))
+      if (Palette().m_SmallFont == Palette().m_LabelFont)
       {
-          GetGlobalColor(_T("DASHL"), &cl);
+          cl = DashColour(DC_DASHL);
           dc->SetTextForeground(cl);
       }
       else
-          dc->SetTextForeground(GetColourSchemeFont(g_pFontLabel->GetColour()));
+          dc->SetTextForeground(Palette().m_LabelFont);
   }
 
   wxPen pen;
   pen.SetStyle(wxPENSTYLE_SOLID);
-  if (m_Properties)
-      cl = GetColourSchemeFont(m_Properties->m_SmallFont.GetColour());
-  else  
-      cl = GetColourSchemeFont(g_pFontSmall->GetColour());
+  cl = Palette().m_SmallFont;
   //GetGlobalColor(_T("DASHF"), &cl);
   pen.SetColour(cl);
   pen.SetWidth(1);
@@ -217,20 +210,20 @@ void DashboardInstrument_Altitude::DrawBackground(wxGCDC* dc) {
                a_plotup + a_plotheight * 3 / 4);
   if (m_Properties)
   {
-      dc->SetFont(m_Properties->m_SmallFont.GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_SmallFont.GetColour()));
+      dc->SetFont(m_Properties->Style().m_SmallFont.GetChosenFont());
+      dc->SetTextForeground(Palette().m_SmallFont);
   }
   else
   {
       dc->SetFont(g_pFontSmall->GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(g_pFontSmall->GetColour()));
+      dc->SetTextForeground(Palette().m_SmallFont);
   }
   double MaxAltitude =   -9999.0;
   double MinAltitude = 9999999.0;
   // evaluate buffered data
-  for (int idx = 0; idx < ALTITUDE_RECORD_COUNT; idx++) {
-    if      (m_ArrayAltitude[idx] > MaxAltitude) MaxAltitude = m_ArrayAltitude[idx];
-    else if (m_ArrayAltitude[idx] < MinAltitude) MinAltitude = m_ArrayAltitude[idx];
+  for (double altitude : m_ArrayAltitude) {
+    if      (altitude > MaxAltitude) MaxAltitude = altitude;
+    else if (altitude < MinAltitude) MinAltitude = altitude;
   }
 
   // calculate 1st and 2nd Moments
@@ -265,7 +258,7 @@ void DashboardInstrument_Altitude::DrawBackground(wxGCDC* dc) {
   int width, height;
   wxFont f;
   if (m_Properties)
-      f = m_Properties->m_SmallFont.GetChosenFont();
+      f = m_Properties->Style().m_SmallFont.GetChosenFont();
   else
       f = g_pFontSmall->GetChosenFont();
   dc->GetTextExtent(label, &width, &height, 0, 0, &f);
@@ -273,7 +266,7 @@ void DashboardInstrument_Altitude::DrawBackground(wxGCDC* dc) {
 
   label.Printf(_T("%.1f/ %8.0f ") + m_AltitudeUnit, m_Range/c_GridLines, m_MinAltitude);
   if (m_Properties)
-      f = m_Properties->m_SmallFont.GetChosenFont();
+      f = m_Properties->Style().m_SmallFont.GetChosenFont();
   else
       f = g_pFontSmall->GetChosenFont();
   dc->GetTextExtent(label, &width, &height, 0, 0, &f);
@@ -285,14 +278,14 @@ void DashboardInstrument_Altitude::DrawForeground(wxGCDC* dc) {
   wxColour cl;
   if (m_Properties)
   {
-      cl = GetColourSchemeFont(m_Properties->m_LabelFont.GetColour());
+      cl = Palette().m_LabelFont;
   }
   else
   {
-      if (GetColourSchemeFont(g_pFontSmall->GetColour()) == GetColourSchemeFont(g_pFontLabel->GetColour()))
-          GetGlobalColor(_T("DASH1"), &cl);
+      if (Palette().m_SmallFont == Palette().m_LabelFont)
+          cl = DashColour(DC_DASH1);
       else
-          cl = GetColourSchemeFont(g_pFontLabel->GetColour());
+          cl = Palette().m_LabelFont;
   }
   //GetGlobalColor(_T("DASH1"), &cl);
   wxBrush brush;
@@ -346,13 +339,13 @@ void DashboardInstrument_Altitude::DrawForeground(wxGCDC* dc) {
 #endif
   if (m_Properties)
   {
-      dc->SetFont(m_Properties->m_DataFont.GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_DataFont.GetColour()));
+      dc->SetFont(m_Properties->Style().m_DataFont.GetChosenFont());
+      dc->SetTextForeground(Palette().m_DataFont);
   }
   else
   {
       //GetGlobalColor(_T("DASHF"), &cl); 
-      dc->SetTextForeground(GetColourSchemeFont(g_pFontData->GetColour()));
+      dc->SetTextForeground(Palette().m_DataFont);
       dc->SetFont(g_pFontData->GetChosenFont());
   } 
   if (m_AltitudeUnit != _T("-")) {  // Watchdog
@@ -363,13 +356,13 @@ void DashboardInstrument_Altitude::DrawForeground(wxGCDC* dc) {
 
   // TODO: test display air temperature ID_DBP_I_ATMP
   if (m_Properties)
-      dc->SetFont(m_Properties->m_LabelFont.GetChosenFont());
+      dc->SetFont(m_Properties->Style().m_LabelFont.GetChosenFont());
   else
       dc->SetFont(g_pFontLabel->GetChosenFont());
   int width, height;
   wxFont f;
   if(m_Properties) {
-      f = m_Properties->m_LabelFont.GetChosenFont();
+      f = m_Properties->Style().m_LabelFont.GetChosenFont();
       dc->GetTextExtent(m_Temp, &width, &height, 0, 0, &f);
   } else {
       f = g_pFontLabel->GetChosenFont();
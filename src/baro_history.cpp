@@ -37,6 +37,8 @@
 #pragma hdrstop
 #endif
 
+extern int g_iDashBaroHistorySpan;
+
 
 //************************************************************************************************************************
 // History of barometic pressure
@@ -44,7 +46,11 @@
 
 DashboardInstrument_BaroHistory::DashboardInstrument_BaroHistory(
     wxWindow* parent, wxWindowID id, wxString title, InstrumentProperties* Properties)
-    : DashboardInstrument(parent, id, title, OCPN_DBP_STC_MDA, Properties) {
+    : DashboardInstrument(parent, id, title, OCPN_DBP_STC_MDA, Properties),
+      m_History(BH_SERIES, BARO_RECORD_COUNT, BARO_RECORD_INTERVAL),
+      m_Tier(HT_FULL),
+      m_SmoothPressTrace(BARO_RECORD_COUNT),
+      m_PressMinMax(BARO_RECORD_COUNT) {
   SetDrawSoloInPane(true);
 
   m_MaxPress = 0;
@@ -57,10 +63,10 @@ DashboardInstrument_BaroHistory::DashboardInstrument_BaroHistory(
   int w, h;
   wxFont f;
   if (m_Properties)
-      f = m_Properties->m_DataFont.GetChosenFont();
+      f = m_Properties->Style().m_DataFont.GetChosenFont();
   else
       f = g_pFontData->GetChosenFont();
-  dc.GetTextExtent("hPa----", &w, &h, 0, 0, &f);
+  GetTextExtentCached(dc, "hPa----", &w, &h, f);
   m_TopLineHeight = wxMax(30, h);
   m_SpdRecCnt = 0;
   m_SpdStartVal = -1;
@@ -69,12 +75,9 @@ DashboardInstrument_BaroHistory::DashboardInstrument_BaroHistory(
   m_SetNewData = 0;
   m_LeftLegend = 3;
   m_RightLegend = 20;
-  for (int idx = 0; idx < BARO_RECORD_COUNT; idx++) {
-    m_ArrayPressHistory[idx] = -1;
-    m_ExpSmoothArrayPressure[idx] = -1;
-    m_ArrayRecTime[idx] = wxDateTime::Now().GetTm();
-    m_ArrayRecTime[idx].year = 999;
-  }
+  m_History.Fill(-1);
+  m_HistoryFile.Open(_T("baro_history.dat"), m_History, 0);
+  RestoreHistory();
   alpha = 0.01;  // smoothing constant
   m_WindowRect = GetClientRect();
   m_DrawAreaRect = GetClientRect();
@@ -87,10 +90,10 @@ wxSize DashboardInstrument_BaroHistory::GetSize(int orient, wxSize hint) {
   int w;
   wxFont f;
   if (m_Properties)
-      f = m_Properties->m_TitelFont.GetChosenFont();
+      f = m_Properties->Style().m_TitelFont.GetChosenFont();
   else
       f = g_pFontTitle->GetChosenFont();
-  dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
+  GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
   if (orient == wxHORIZONTAL) {
     return wxSize(DefaultWidth, wxMax(m_TitleHeight + 140, hint.y));
   } else {
@@ -114,32 +117,25 @@ void DashboardInstrument_BaroHistory::SetData(DASH_CAP st, double data,
         m_IsRunning = true;
         m_SampleCount = m_SampleCount < BARO_RECORD_COUNT ? m_SampleCount + 1
           : BARO_RECORD_COUNT;
-        m_MaxPress = 0;
-        ;
-        // data shifting
-        for (int idx = 1; idx < BARO_RECORD_COUNT; idx++) {
-          if (BARO_RECORD_COUNT - m_SampleCount <= idx)
-            m_MaxPress = wxMax(m_ArrayPressHistory[idx - 1], m_MaxPress);
-          m_MinPress = wxMin(m_ArrayPressHistory[idx - 1], m_MinPress);
-          m_ArrayPressHistory[idx - 1] = m_ArrayPressHistory[idx];
-          m_ExpSmoothArrayPressure[idx - 1] = m_ExpSmoothArrayPressure[idx];
-          m_ArrayRecTime[idx - 1] = m_ArrayRecTime[idx];
-        }
-        m_ArrayPressHistory[BARO_RECORD_COUNT - 1] = m_Press;
+        HistoryStore& full = m_History.Full();
+        full.Push(wxDateTime::Now().GetTicks());
+        int last = BARO_RECORD_COUNT - 1;
+        full.Set(BH_PRESS, last, m_Press);
         if (m_SampleCount < 2) {
-          m_ArrayPressHistory[BARO_RECORD_COUNT - 2] = m_Press;
-          m_ExpSmoothArrayPressure[BARO_RECORD_COUNT - 2] = m_Press;
-        }
-        m_ExpSmoothArrayPressure[BARO_RECORD_COUNT - 1] =
-          alpha * m_ArrayPressHistory[BARO_RECORD_COUNT - 2] +
-          (1 - alpha) * m_ExpSmoothArrayPressure[BARO_RECORD_COUNT - 2];
-        m_ArrayRecTime[BARO_RECORD_COUNT - 1] = wxDateTime::Now().GetTm();
-        m_MaxPress = wxMax(m_Press, m_MaxPress);
-
-        m_MinPress = wxMin(m_MinPress, m_Press);
-        if (wxMin(m_Press, m_MinPress) == -1) {
-          m_MinPress = wxMin(m_Press, 1200);  // to make a OK inital value
+          full.Set(BH_PRESS, last - 1, m_Press);
+          full.Set(BH_SMOOTH_PRESS, last - 1, m_Press);
         }
+        full.Set(BH_SMOOTH_PRESS, last,
+          alpha * full.Get(BH_PRESS, last - 1) +
+          (1 - alpha) * full.Get(BH_SMOOTH_PRESS, last - 1));
+        unsigned added = m_History.Aggregate();
+        m_HistoryFile.Append(m_History, added);
+        // the trace follows the tier it draws
+        if (added & (1u << m_Tier))
+          m_SmoothPressTrace.Push(
+              m_History.GetSeries(m_Tier, BH_SMOOTH_PRESS));
+        m_PressMinMax.Push(m_Press);
+        SetMinMaxPress();
         // get the overall max min pressure
         m_TotalMaxPress = wxMax(m_Press, m_TotalMaxPress);
         m_TotalMinPress = wxMin(m_Press, m_TotalMinPress);
@@ -152,6 +148,7 @@ void DashboardInstrument_BaroHistory::SetData(DASH_CAP st, double data,
 }
 
 void DashboardInstrument_BaroHistory::Draw(wxGCDC* dc) {
+  SelectTier();
   m_WindowRect = GetClientRect();
   m_DrawAreaRect = GetClientRect();
   m_DrawAreaRect.SetHeight(m_WindowRect.height - m_TopLineHeight -
@@ -161,6 +158,73 @@ void DashboardInstrument_BaroHistory::Draw(wxGCDC* dc) {
   DrawForeground(dc);
 }
 
+//*********************************************************************************
+// draw one history array, at most two points per pixel column
+//*********************************************************************************
+void DashboardInstrument_BaroHistory::DrawTrace(wxGCDC* dc,
+                                                TraceDecimator& trace,
+                                                int series, double offset,
+                                                double ratioH) {
+  if (trace.SetColumns(m_DrawAreaRect.width))
+    trace.Rebuild(m_History.GetSeries(m_Tier, series),
+                  m_History.GetSamples(m_Tier));
+  int bottom = m_TopLineHeight + m_DrawAreaRect.height;
+  int n = trace.GetPoints(m_TracePoints, 3 + m_LeftLegend, m_ratioW, bottom,
+                          offset, ratioH, m_TopLineHeight, bottom);
+  if (n > 1) dc->DrawLines(n, &m_TracePoints[0]);
+}
+
+//*********************************************************************************
+// take over the samples restored from the history file
+//*********************************************************************************
+void DashboardInstrument_BaroHistory::RestoreHistory() {
+  // overall extremes of all restored tiers, for the scale. After a long
+  // break only the coarse tiers may still be within their span.
+  bool restored = false;
+  for (int t = HT_FULL; t < HT_TIERS; t++) {
+    double min, max;
+    if (!m_History.GetRange(t, BH_PRESS, min, max)) continue;
+    m_TotalMaxPress = wxMax(max, m_TotalMaxPress);
+    m_TotalMinPress = wxMin(min, m_TotalMinPress);
+    restored = true;
+  }
+  if (!restored) return;
+  m_SampleCount = m_History.GetSamples(HT_FULL);
+  const HistoryStore& full = m_History.GetTier(HT_FULL);
+  for (int i = BARO_RECORD_COUNT - m_SampleCount; i < BARO_RECORD_COUNT; i++)
+    m_PressMinMax.Push(full.Get(BH_PRESS, i));
+  // select the tier again, the trace is rebuilt on the next draw
+  m_Tier = -1;
+  SelectTier();
+}
+
+//*********************************************************************************
+// switch to the finest history tier which covers the configured span
+//*********************************************************************************
+void DashboardInstrument_BaroHistory::SelectTier() {
+  int tier = m_History.SelectTier(g_iDashBaroHistorySpan * 3600);
+  if (tier == m_Tier) return;
+  m_Tier = tier;
+  m_SmoothPressTrace.SetCount(m_History.GetTier(tier).GetCount());
+  SetMinMaxPress();
+}
+
+//*********************************************************************************
+// min and max pressure over the drawn tier, the full rate ones are at hand
+//*********************************************************************************
+void DashboardInstrument_BaroHistory::SetMinMaxPress() {
+  if (m_Tier != HT_FULL) {
+    m_History.GetRange(m_Tier, BH_PRESS, m_MinPress, m_MaxPress);
+  } else if (!m_PressMinMax.IsEmpty()) {
+    m_MaxPress = m_PressMinMax.GetMax();
+    m_MinPress = m_PressMinMax.GetMin();
+  } else {
+    // nothing at full rate yet, e.g. only the coarse tiers were restored
+    m_MaxPress = m_TotalMaxPress;
+    m_MinPress = m_TotalMinPress;
+  }
+}
+
 //*********************************************************************************
 // draw pressure scale
 //*********************************************************************************
@@ -171,12 +235,12 @@ void DashboardInstrument_BaroHistory::DrawWindSpeedScale(wxGCDC* dc) {
   cl = wxColour(61, 61, 204, 255);
   if (m_Properties)
   {
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_SmallFont.GetColour()));
-      dc->SetFont(m_Properties->m_SmallFont.GetChosenFont());
+      dc->SetTextForeground(Palette().m_SmallFont);
+      dc->SetFont(m_Properties->Style().m_SmallFont.GetChosenFont());
   }
   else
   {
-      dc->SetTextForeground(GetColourSchemeFont(g_pFontSmall->GetColour()));
+      dc->SetTextForeground(Palette().m_SmallFont);
       dc->SetFont(g_pFontSmall->GetChosenFont());
   }
   // round m_MaxPress up to the next hpa ...
@@ -217,13 +281,13 @@ void DashboardInstrument_BaroHistory::DrawWindSpeedScale(wxGCDC* dc) {
   }
   wxFont f;
   if (m_Properties)
-      f = m_Properties->m_SmallFont.GetChosenFont();
+      f = m_Properties->Style().m_SmallFont.GetChosenFont();
   else
       f = g_pFontSmall->GetChosenFont();
   dc->GetTextExtent(label1, &m_LeftLegend, &height, 0, 0, &f);
   dc->DrawText(label1, 4, (int)(m_TopLineHeight - height / 2));
   if (m_Properties)
-      f = m_Properties->m_SmallFont.GetChosenFont();
+      f = m_Properties->Style().m_SmallFont.GetChosenFont();
   else
       f = g_pFontSmall->GetChosenFont();
   dc->GetTextExtent(label2, &width, &height, 0, 0, &f);
@@ -231,7 +295,7 @@ void DashboardInstrument_BaroHistory::DrawWindSpeedScale(wxGCDC* dc) {
                (int)(m_TopLineHeight + m_DrawAreaRect.height / 4 - height / 2));
   m_LeftLegend = wxMax(width, m_LeftLegend);
   if (m_Properties)
-      f = m_Properties->m_SmallFont.GetChosenFont();
+      f = m_Properties->Style().m_SmallFont.GetChosenFont();
   else
       f = g_pFontSmall->GetChosenFont();
   dc->GetTextExtent(label3, &width, &height, 0, 0, &f);
@@ -239,7 +303,7 @@ void DashboardInstrument_BaroHistory::DrawWindSpeedScale(wxGCDC* dc) {
                (int)(m_TopLineHeight + m_DrawAreaRect.height / 2 - height / 2));
   m_LeftLegend = wxMax(width, m_LeftLegend);
   if (m_Properties)
-      f = m_Properties->m_SmallFont.GetChosenFont();
+      f = m_Properties->Style().m_SmallFont.GetChosenFont();
   else
       f = g_pFontSmall->GetChosenFont();
   dc->GetTextExtent(label4, &width, &height, 0, 0, &f);
@@ -248,7 +312,7 @@ void DashboardInstrument_BaroHistory::DrawWindSpeedScale(wxGCDC* dc) {
       (int)(m_TopLineHeight + m_DrawAreaRect.height * 0.75 - height / 2));
   m_LeftLegend = wxMax(width, m_LeftLegend);
   if (m_Properties)
-      f = m_Properties->m_SmallFont.GetChosenFont();
+      f = m_Properties->Style().m_SmallFont.GetChosenFont();
   else
       f = g_pFontSmall->GetChosenFont();
   dc->GetTextExtent(label5, &width, &height, 0, 0, &f);
@@ -274,7 +338,7 @@ void DashboardInstrument_BaroHistory::DrawBackground(wxGCDC* dc) {
   //---------------------------------------------------------------------------------
   // horizontal lines
   //---------------------------------------------------------------------------------
-  GetGlobalColor(_T("UBLCK"), &cl);
+  cl = DashColour(DC_UBLCK);
   pen.SetColour(cl);
   dc->SetPen(pen);
   dc->DrawLine(m_LeftLegend + 3, m_TopLineHeight,
@@ -322,20 +386,20 @@ void DashboardInstrument_BaroHistory::DrawForeground(wxGCDC* dc) {
   wxFont f;
   if (m_Properties)
   {
-      dc->SetFont(m_Properties->m_DataFont.GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_DataFont.GetColour()));
+      dc->SetFont(m_Properties->Style().m_DataFont.GetChosenFont());
+      dc->SetTextForeground(Palette().m_DataFont);
   }
   else
   {
       dc->SetFont(g_pFontData->GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(g_pFontData->GetColour()));
+      dc->SetTextForeground(Palette().m_DataFont);
   }
   if (!std::isnan(m_Press))
     WindSpeed = wxString::Format(_T("hPa %3.1f  "), m_Press);
   else
     WindSpeed = wxString::Format(_T("hPa ---  "));
   if (m_Properties)
-      f = m_Properties->m_DataFont.GetChosenFont();
+      f = m_Properties->Style().m_DataFont.GetChosenFont();
   else
       f = g_pFontData->GetChosenFont();
   dc->GetTextExtent(WindSpeed, &degw, &degh, 0, 0, &f);
@@ -343,35 +407,37 @@ void DashboardInstrument_BaroHistory::DrawForeground(wxGCDC* dc) {
   dc->DrawText(WindSpeed, m_LeftLegend + 3, 1);
   if (m_Properties)
   {
-      dc->SetFont(m_Properties->m_LabelFont.GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_LabelFont.GetColour()));
+      dc->SetFont(m_Properties->Style().m_LabelFont.GetChosenFont());
+      dc->SetTextForeground(Palette().m_LabelFont);
   }
   else
   {
       dc->SetFont(g_pFontLabel->GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(g_pFontLabel->GetColour()));
+      dc->SetTextForeground(Palette().m_LabelFont);
   }
   int labelw, labelh;
   if (m_Properties)
-      f = m_Properties->m_LabelFont.GetChosenFont();
+      f = m_Properties->Style().m_LabelFont.GetChosenFont();
   else
       f = g_pFontLabel->GetChosenFont();
   dc->GetTextExtent(WindSpeed, &labelw, &labelh, 0, 0, &f);
   // determine the time range of the available data (=oldest data value)
   int i = 0;
-  while (m_ArrayRecTime[i].year == 999 && i < BARO_RECORD_COUNT - 1) i++;
-  if (i == BARO_RECORD_COUNT - 1) {
+  const HistoryStore& visible = m_History.GetTier(m_Tier);
+  int count = visible.GetCount();
+  while (visible.GetTime(i) == 0 && i < count - 1) i++;
+  if (i == count - 1) {
     min = 0;
     hour = 0;
 
   } else {
-    wxDateTime localTime(m_ArrayRecTime[i]);
+    wxDateTime localTime(visible.GetTime(i));
     min = localTime.GetMinute();
     hour = localTime.GetHour();
   }
   m_DrawAreaRect.SetWidth(m_WindowRect.width - 3 - m_LeftLegend -
     m_RightLegend);
-  m_ratioW = double(m_DrawAreaRect.width) / (BARO_RECORD_COUNT - 1);
+  m_ratioW = double(m_DrawAreaRect.width) / (count - 1);
 
   dc->DrawText(wxString::Format(
                    _(" Max %.1f since %02d:%02d  Overall Max %.1f Min %.1f "),
@@ -383,31 +449,12 @@ void DashboardInstrument_BaroHistory::DrawForeground(wxGCDC* dc) {
   dc->SetPen(pen);
   ratioH = (double)m_DrawAreaRect.height / (double)m_MaxPressScale;
 
-  wxPoint pointsSpd[BARO_RECORD_COUNT + 2];
-  wxPoint bdDraw[BARO_RECORD_COUNT + 2];
-  int ls = 0;
-  bdDraw[ls].x = 1 * m_ratioW + 3 + m_LeftLegend;
-  bdDraw[ls].y = m_TopLineHeight + m_DrawAreaRect.height -
-    ((m_ArrayPressHistory[1] - (double)m_TotalMinPress + 18) * ratioH);
-
   //---------------------------------------------------------------------------------
   // live pressure data
   //---------------------------------------------------------------------------------
-
-  for (int idx = 1; idx < BARO_RECORD_COUNT; idx++) {
-    pointsSpd[idx].x = idx * m_ratioW + 3 + m_LeftLegend;
-    // Print the smoothed value to avoid jumps in the single line.
-    pointsSpd[idx].y = m_TopLineHeight + m_DrawAreaRect.height -
-        ((m_ExpSmoothArrayPressure[idx] - m_TotalMinPress + 18.0) * ratioH);
-    if (BARO_RECORD_COUNT - m_SampleCount <= idx &&
-      pointsSpd[idx].y > m_TopLineHeight &&
-      pointsSpd[idx].y <= m_TopLineHeight + m_DrawAreaRect.height) {
-      bdDraw[ls] = pointsSpd[idx];
-      ls++;
-    }
-  }
-  if (ls > 1)
-    dc->DrawLines(ls, bdDraw);
+  // Print the smoothed value to avoid jumps in the single line.
+  DrawTrace(dc, m_SmoothPressTrace, BH_SMOOTH_PRESS, m_TotalMinPress - 18.0,
+            ratioH);
 
   //---------------------------------------------------------------------------------
   // exponential smoothing of barometric pressure
@@ -434,22 +481,25 @@ void DashboardInstrument_BaroHistory::DrawForeground(wxGCDC* dc) {
 
   */
   //---------------------------------------------------------------------------------
-  // Draw vertical timelines every 15 minutes
+  // Draw vertical timelines every 15 minutes, hourly or every 6 hours
   //---------------------------------------------------------------------------------
-  GetGlobalColor("DASHL", &col);
+  col = DashColour(DC_DASHL);
   pen.SetColour(col);
   pen.SetStyle(wxPENSTYLE_DOT);
   dc->SetPen(pen);
   dc->SetTextForeground(col);
   dc->SetFont((g_pFontSmall->GetChosenFont()));
+  static const int step[HT_TIERS] = {15, 60, 360};  // minutes
   int done = -1;
   wxPoint pointTime;
-  for (int idx = 0; idx < BARO_RECORD_COUNT; idx++) {
-    if (m_ArrayRecTime[idx].year != 999) {
-      wxDateTime localTime(m_ArrayRecTime[idx]);
+  for (int idx = 0; idx < count; idx++) {
+    time_t recTime = visible.GetTime(idx);
+    if (recTime) {
+      wxDateTime localTime(recTime);
       hour = localTime.GetHour();
       min = localTime.GetMinute();
-      if ((hour * 100 + min) != done && (min == 0 || min % 15 == 0)) {
+      if ((hour * 100 + min) != done &&
+          ((hour * 60 + min) % step[m_Tier] == 0)) {
         pointTime.x = idx * m_ratioW + 3 + m_LeftLegend;
         dc->DrawLine(pointTime.x, m_TopLineHeight + 1, pointTime.x,
                      (m_TopLineHeight + m_DrawAreaRect.height + 1));
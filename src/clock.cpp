@@ -59,9 +59,9 @@ wxSize DashboardInstrument_Clock::GetSize(int orient, wxSize hint) {
   wxClientDC dc(this);
   int w;
   wxFont f = g_pFontTitle->GetChosenFont();
-  dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
+  GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
   f = g_pFontData->GetChosenFont();
-  dc.GetTextExtent(_T("00:00:00 UTC"), &w, &m_DataHeight, 0, 0, &f);
+  GetTextExtentCached(dc, _T("00:00:00 UTC"), &w, &m_DataHeight, f);
 
   if (orient == wxHORIZONTAL) {
     return wxSize(DefaultWidth, wxMax(m_TitleHeight + m_DataHeight, hint.y));
@@ -133,7 +133,7 @@ wxSize DashboardInstrument_Moon::GetSize(int orient, wxSize hint) {
   wxClientDC dc(this);
   int w;
   wxFont f = g_pFontTitle->GetChosenFont();
-  dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
+  GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
 
   if (orient == wxHORIZONTAL) {
     return wxSize(DefaultWidth,
@@ -158,7 +158,7 @@ void DashboardInstrument_Moon::Draw(wxGCDC *dc) {
   wxColour cl0, cl1, cl2;
 
   dc->SetPen(*wxTRANSPARENT_PEN);
-  GetGlobalColor(_T("DASHL"), &cl0);
+  cl0 = DashColour(DC_DASHL);
   dc->SetBrush(cl0);
   wxPoint points[3];
   points[0].x = 5;
@@ -175,9 +175,9 @@ void DashboardInstrument_Moon::Draw(wxGCDC *dc) {
   /* Moon phases are seen upside-down on the southern hemisphere */
   int startangle = (m_hemisphere == _("N") ? -90 : 90);
 
-  GetGlobalColor(_T("DASH2"), &cl0);
-  GetGlobalColor(_T("DASH1"), &cl1);
-  GetGlobalColor(_T("DASHF"), &cl2);
+  cl0 = DashColour(DC_DASH2);
+  cl1 = DashColour(DC_DASH1);
+  cl2 = DashColour(DC_DASHF);
 
   dc->SetBrush(cl0);
   dc->DrawCircle(x, y, m_radius);
@@ -309,9 +309,9 @@ wxSize DashboardInstrument_Sun::GetSize(int orient, wxSize hint) {
   wxClientDC dc(this);
   int w;
   wxFont f = g_pFontTitle->GetChosenFont();
-  dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
+  GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
   f = g_pFontData->GetChosenFont();
-  dc.GetTextExtent(_T("00:00:00 UTC"), &w, &m_DataHeight, 0, 0, &f);
+  GetTextExtentCached(dc, _T("00:00:00 UTC"), &w, &m_DataHeight, f);
 
   if (orient == wxHORIZONTAL) {
     return wxSize(DefaultWidth,
@@ -326,7 +326,7 @@ void DashboardInstrument_Sun::Draw(wxGCDC *dc) {
   wxColour cl;
 
   dc->SetFont((g_pFontData->GetChosenFont()));
-  GetGlobalColor(_T("DASHF"), &cl);
+  cl = DashColour(DC_DASHF);
   dc->SetTextForeground(cl);
 
   dc->DrawText(m_sunrise, 10, m_TitleHeight);
@@ -50,6 +50,8 @@ DashboardInstrument_Compass::DashboardInstrument_Compass(wxWindow* parent,
   SetOptionMarker(5, DIAL_MARKER_SIMPLE, 2);
   SetOptionLabel(20, DIAL_LABEL_ROTATED);
   SetOptionMainValue(_T("%.0f"), DIAL_POSITION_INSIDE);
+  // SetData() turns the scale with the heading
+  m_bRotatingScale = true;
 }
 
 void DashboardInstrument_Compass::SetData(DASH_CAP st, double data,
@@ -74,7 +76,7 @@ void DashboardInstrument_Compass::SetData(DASH_CAP st, double data,
 void DashboardInstrument_Compass::DrawBackground(wxGCDC* dc) {
   DrawBoat(dc, m_cx, m_cy, m_radius);
   if (!m_gpsWD)  // Don't draw if no GPS
-    DrawCompassRose(dc, m_cx, m_cy, 0.7 * m_radius, m_AngleStart, true, m_Properties);
+    m_Rose.Draw(dc, m_cx, m_cy, 0.7 * m_radius, m_AngleStart, true, m_Properties);
 }
 
 void DashboardInstrument_Compass::DrawForeground(wxGCDC* dc) {
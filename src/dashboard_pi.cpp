@@ -37,6 +37,7 @@
 // xw 2.8
 #include <wx/filename.h>
 #include <wx/fontdlg.h>
+#include <wx/tokenzr.h>
 
 #include <typeinfo>
 #include "dashboard_pi.h"
@@ -66,6 +67,9 @@ wxFontData g_USFontData;
 wxFontData g_USFontLabel;
 wxFontData g_USFontSmall;
 
+// Where the time of Init and of applying the preferences goes
+StartupProfile g_StartupProfile;
+
 // Preferences, Units and Max Values
 int g_iDashTachometerMax;
 int g_iDashTemperatureUnit;
@@ -89,9 +93,9 @@ int g_iDashDistanceUnit;
 int g_iDashWindSpeedUnit;
 int g_iUTCOffset;
 double g_dDashDBTOffset;
+int g_iDashWindHistorySpan;  // Hours
+int g_iDashBaroHistorySpan;  // Hours
 bool g_bDBtrueWindGround;
-double g_dHDT;
-double g_dSOG, g_dCOG;
 int g_iDashTempUnit;
 int g_dashPrefWidth, g_dashPrefHeight;
 
@@ -263,292 +267,854 @@ enum {
                      // instruments :-)
 };
 
+// Icon of an instrument in the preferences list, index in its image list
+enum {
+  INSTRUMENT_ICON_SINGLE,
+  INSTRUMENT_ICON_DIAL,
+  INSTRUMENT_ICON_ENGINE,
+  INSTRUMENT_ICON_GAUGE
+};
+
+struct InstrumentDescriptor;
+typedef DashboardInstrument *(*InstrumentFactory)(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc);
+
+// All the dashboard knows about one instrument id. The generic factories
+// build their instrument from 'cap' and 'format', the others hard-code their
+// dial options and leave them OCPN_DBP_STC_LAST and NULL.
+struct InstrumentDescriptor {
+  int id;
+  const char *caption;  // Untranslated, see getInstrumentCaption()
+  int icon;
+  bool obsolete;             // Kept for old configs, not offered any more
+  InstrumentFactory create;  // NULL if there is no instrument for the id
+  DASH_CAP cap;
+  const char *format;
+};
+
+/* options
+ ID_DBP_D_SOG: config max value, show STW optional
+ ID_DBP_D_COG:  +SOG +HDG? +BRG?
+ ID_DBP_D_AWS: config max value. Two arrows for AWS+TWS?
+ ID_DBP_D_VMG: config max value
+ ID_DBP_I_DPT: config unit (meter, feet, fathoms)
+ ID_DBP_D_DPT: show temp optional
+ // compass: use COG or HDG
+ // velocity range
+ // rudder range
+
+ */
+static DashboardInstrument *CreateSingle(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_Single(parent, wxID_ANY, caption, Properties,
+                                        desc.cap, desc.format);
+}
+
+static DashboardInstrument *CreateBlock(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_Block(parent, wxID_ANY, caption, Properties,
+                                       desc.cap, desc.format);
+}
+
+static DashboardInstrument *Create_I_POS(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_Position(
+      parent, wxID_ANY, caption, Properties);
+}
+
+static DashboardInstrument *Create_D_SOG(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(
+      parent, wxID_ANY, caption, Properties, OCPN_DBP_STC_SOG, 0,
+      g_iDashSpeedMax);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionLabel(g_iDashSpeedMax / 20 + 1, DIAL_LABEL_HORIZONTAL);
+  //(DashboardInstrument_Dial *)instrument->SetOptionMarker(0.1,
+  //DIAL_MARKER_SIMPLE, 5);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionMarker(0.5, DIAL_MARKER_SIMPLE, 2);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionExtraValue(OCPN_DBP_STC_STW, _T("STW\n%.2f"),
+                            DIAL_POSITION_BOTTOMLEFT);
+  return instrument;
+}
+
+static DashboardInstrument *Create_D_COG(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Compass(
+      parent, wxID_ANY, caption, Properties, OCPN_DBP_STC_COG);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionMarker(5, DIAL_MARKER_SIMPLE, 2);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionLabel(30, DIAL_LABEL_ROTATED);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionExtraValue(OCPN_DBP_STC_SOG, _T("SOG\n%.2f"),
+                            DIAL_POSITION_BOTTOMLEFT);
+  return instrument;
+}
+
+static DashboardInstrument *Create_D_HDT(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Compass(
+      parent, wxID_ANY, caption, Properties, OCPN_DBP_STC_HDT);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionMarker(5, DIAL_MARKER_SIMPLE, 2);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionLabel(30, DIAL_LABEL_ROTATED);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionExtraValue(OCPN_DBP_STC_STW, _T("STW\n%.1f"),
+                            DIAL_POSITION_BOTTOMLEFT);
+  return instrument;
+}
+
+static DashboardInstrument *Create_D_AW(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Wind(
+      parent, wxID_ANY, caption, Properties, OCPN_DBP_STC_AWA);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionMainValue(_T("%.0f"), DIAL_POSITION_BOTTOMLEFT);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionExtraValue(OCPN_DBP_STC_AWS, _T("%.1f"),
+                            DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_D_AWS(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(
+      parent, wxID_ANY, caption, Properties, OCPN_DBP_STC_AWS, 0, 45);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionLabel(5, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionMarker(1, DIAL_MARKER_SIMPLE, 5);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionMainValue(_T("A %.1f"), DIAL_POSITION_BOTTOMLEFT);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionExtraValue(OCPN_DBP_STC_TWS, _T("T %.1f"),
+                            DIAL_POSITION_BOTTOMRIGHT);
+  return instrument;
+}
+
+// True Wind angle +-180 degr on boat axis
+static DashboardInstrument *Create_D_TW(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_TrueWindAngle(
+      parent, wxID_ANY, caption, Properties, OCPN_DBP_STC_TWA);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionMainValue(_T("%.0f"), DIAL_POSITION_BOTTOMLEFT);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionExtraValue(OCPN_DBP_STC_TWS, _T("%.1f"),
+                            DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+// App/True Wind angle +-180 degr on boat axis
+static DashboardInstrument *Create_D_AWA_TWA(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_AppTrueWindAngle(
+      parent, wxID_ANY, caption, Properties, OCPN_DBP_STC_AWA);
+  ((DashboardInstrument_Dial *)instrument)->SetCapFlag(OCPN_DBP_STC_TWA);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionMainValue(_T("%.0f"), DIAL_POSITION_NONE);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionExtraValue(OCPN_DBP_STC_TWS, _T("%.1f"),
+                            DIAL_POSITION_NONE);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionExtraValue(OCPN_DBP_STC_AWS, _T("%.1f"),
+                            DIAL_POSITION_NONE);
+  return instrument;
+}
+
+// True Wind direction
+static DashboardInstrument *Create_D_TWD(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_WindCompass(
+      parent, wxID_ANY, caption, Properties, OCPN_DBP_STC_TWD);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionMainValue(_T("%.0f"), DIAL_POSITION_BOTTOMLEFT);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionExtraValue(OCPN_DBP_STC_TWS2, _T("%.1f"),
+                            DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_D_ALTI(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_Altitude(
+      parent, wxID_ANY, caption, Properties);
+}
+
+static DashboardInstrument *Create_D_DPT(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_Depth(parent, wxID_ANY, caption, Properties);
+}
+
+// barometric pressure
+static DashboardInstrument *Create_D_MDA(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(
+      parent, wxID_ANY, caption, Properties, OCPN_DBP_STC_MDA, 938,
+      1088);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionLabel(15, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionMarker(7.5, DIAL_MARKER_SIMPLE, 1);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionMainValue(_T("%5.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_D_VMG(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(
+      parent, wxID_ANY, caption, Properties, OCPN_DBP_STC_VMG, 0,
+      g_iDashSpeedMax);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionLabel(1, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionMarker(0.5, DIAL_MARKER_SIMPLE, 2);
+  ((DashboardInstrument_Dial *)instrument)
+      ->SetOptionExtraValue(OCPN_DBP_STC_SOG, _T("SOG\n%.1f"),
+                            DIAL_POSITION_BOTTOMLEFT);
+  return instrument;
+}
+
+static DashboardInstrument *Create_D_RSA(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_RudderAngle(
+      parent, wxID_ANY, caption, Properties);
+}
+
+static DashboardInstrument *Create_D_GPS(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_GPS(parent, wxID_ANY, caption, Properties);
+}
+
+static DashboardInstrument *Create_I_PTR(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_Position(
+      parent, wxID_ANY, caption, Properties, OCPN_DBP_STC_PLA,
+      OCPN_DBP_STC_PLO);
+}
+
+static DashboardInstrument *Create_I_GPSUTC(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_Clock(parent, wxID_ANY, caption, Properties);
+}
+
+static DashboardInstrument *Create_I_SUN(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_Sun(parent, wxID_ANY, caption, Properties);
+}
+
+static DashboardInstrument *Create_D_MON(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_Moon(parent, wxID_ANY, caption, Properties);
+}
+
+static DashboardInstrument *Create_D_WDH(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_WindDirHistory(
+      parent, wxID_ANY, caption, Properties);
+}
+
+static DashboardInstrument *Create_D_BPH(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_BaroHistory(
+      parent, wxID_ANY, caption, Properties);
+}
+
+static DashboardInstrument *Create_I_FOS(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_FromOwnship(
+      parent, wxID_ANY, caption, Properties);
+}
+
+// any clock display with "LCL" in the format string is converted from
+// UTC to local TZ
+static DashboardInstrument *Create_I_SUNLCL(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_Sun(
+      parent, wxID_ANY, caption, Properties, _T("%02i:%02i:%02i LCL"));
+}
+
+static DashboardInstrument *Create_I_GPSLCL(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_Clock(
+      parent, wxID_ANY, caption, Properties, OCPN_DBP_STC_CLK,
+      _T("%02i:%02i:%02i LCL"));
+}
+
+static DashboardInstrument *Create_I_CPULCL(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  return new DashboardInstrument_CPUClock(
+      parent, wxID_ANY, caption, Properties, _T("%02i:%02i:%02i LCL"));
+}
+
+static DashboardInstrument *Create_D_STW_COG(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_SpeedometerSOGSTW(
+      parent, wxID_ANY, caption, Properties, OCPN_DBP_STC_SOG, 0,
+      g_iDashSpeedMax);
+  ((DashboardInstrument_Dial*)instrument)
+      ->SetOptionLabel(g_iDashSpeedMax / 20 + 1, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)
+      ->SetOptionMarker(0.5, DIAL_MARKER_SIMPLE, 2);
+  ((DashboardInstrument_Dial*)instrument)
+      ->SetOptionMainValue(_T("SOG\n%.1f"), DIAL_POSITION_BOTTOMLEFT);
+  ((DashboardInstrument_Dial*)instrument)
+      ->SetOptionExtraValue(OCPN_DBP_STC_STW, _T("   STW\n%.1f"),
+          DIAL_POSITION_BOTTOMRIGHT);
+  return instrument;
+}
+
+// Engine Dashboard
+static DashboardInstrument *Create_MAIN_ENGINE_RPM(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_MAIN_ENGINE_RPM, 0, g_iDashTachometerMax);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(1000, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.2f"), DIAL_POSITION_NONE);
+  // ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(200, DIAL_MARKER_SIMPLE, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(200, DIAL_MARKER_WARNING_HIGH, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionExtraValue(OCPN_DBP_STC_MAIN_ENGINE_HOURS, _T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_PORT_ENGINE_RPM(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_PORT_ENGINE_RPM, 0, g_iDashTachometerMax);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(1000, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.2f"), DIAL_POSITION_NONE);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(200, DIAL_MARKER_SIMPLE, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionExtraValue(OCPN_DBP_STC_PORT_ENGINE_HOURS, _T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_STBD_ENGINE_RPM(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_STBD_ENGINE_RPM, 0, g_iDashTachometerMax);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(1000, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.2f"), DIAL_POSITION_NONE);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(200, DIAL_MARKER_SIMPLE, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionExtraValue(OCPN_DBP_STC_STBD_ENGINE_HOURS, _T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_MAIN_ENGINE_OIL(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_MAIN_ENGINE_OIL, 0, g_iDashPressureUnit == PRESSURE_BAR ? 5 : 80);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashPressureUnit == PRESSURE_BAR ? 1 : 20, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashPressureUnit == PRESSURE_BAR ? 0.5 : 10, DIAL_MARKER_SIMPLE, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_PORT_ENGINE_OIL(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_PORT_ENGINE_OIL, 0, g_iDashPressureUnit == PRESSURE_BAR ? 5 : 80);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashPressureUnit == PRESSURE_BAR ? 1 : 20, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashPressureUnit == PRESSURE_BAR ? 0.5 : 10, DIAL_MARKER_SIMPLE, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_STBD_ENGINE_OIL(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_STBD_ENGINE_OIL, 0, g_iDashPressureUnit == PRESSURE_BAR ? 5 : 80);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashPressureUnit == PRESSURE_BAR ? 1 : 20, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashPressureUnit == PRESSURE_BAR ? 0.5 : 10, DIAL_MARKER_SIMPLE, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_MAIN_ENGINE_WATER(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_MAIN_ENGINE_WATER, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 40 : 80, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 120 : 250);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 10 : 30, DIAL_LABEL_HORIZONTAL);
+  //((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 5 : 15, DIAL_MARKER_SIMPLE, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 5 : 15, DIAL_MARKER_WARNING_HIGH, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_PORT_ENGINE_WATER(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_PORT_ENGINE_WATER, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 40 : 80, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 120 : 250);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 10 : 30, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 5 : 15, DIAL_MARKER_WARNING_HIGH, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_STBD_ENGINE_WATER(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_STBD_ENGINE_WATER, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 40 : 80, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 120 : 250);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 10 : 30, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 5 : 15, DIAL_MARKER_WARNING_HIGH, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_MAIN_ENGINE_EXHAUST(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_MAIN_ENGINE_EXHAUST, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 0 : 40, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 80 : 190);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 10 : 30, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 5 : 15, DIAL_MARKER_SIMPLE, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_PORT_ENGINE_EXHAUST(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_PORT_ENGINE_EXHAUST, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 0 : 40, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 80 : 190);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 10 : 30, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 5 : 15, DIAL_MARKER_SIMPLE, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_STBD_ENGINE_EXHAUST(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_STBD_ENGINE_EXHAUST, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 0 : 40, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 80 : 190);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 10 : 30, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 5 : 15, DIAL_MARKER_SIMPLE, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_MAIN_ENGINE_VOLTS(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_MAIN_ENGINE_VOLTS, twentyFourVolts ? 18 : 8, twentyFourVolts ? 32 : 16);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(2, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(1, DIAL_MARKER_SIMPLE, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_PORT_ENGINE_VOLTS(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_PORT_ENGINE_VOLTS, twentyFourVolts ? 18 : 8, twentyFourVolts ? 32 : 16);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(2, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(1, DIAL_MARKER_SIMPLE, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_STBD_ENGINE_VOLTS(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_STBD_ENGINE_VOLTS, twentyFourVolts ? 18 : 8, twentyFourVolts ? 32 : 16);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(2, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(1, DIAL_MARKER_SIMPLE, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_FUEL_TANK_01(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_TANK_LEVEL_FUEL_01, 0, 100);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_LOW, 1);
+  return instrument;
+}
+
+static DashboardInstrument *Create_WATER_TANK_01(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_TANK_LEVEL_WATER_01, 0, 100);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_LOW, 1);
+  return instrument;
+}
+
+static DashboardInstrument *Create_FUEL_TANK_02(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_TANK_LEVEL_FUEL_02, 0, 100);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_LOW, 1);
+  return instrument;
+}
+
+static DashboardInstrument *Create_WATER_TANK_02(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_TANK_LEVEL_WATER_02, 0, 100);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_LOW, 1);
+  return instrument;
+}
+
+static DashboardInstrument *Create_WATER_TANK_03(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_TANK_LEVEL_WATER_03, 0, 100);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_LOW, 1);
+  return instrument;
+}
+
+static DashboardInstrument *Create_OIL_TANK(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_TANK_LEVEL_OIL, 0, 100);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_LOW, 1);
+  return instrument;
+}
+
+static DashboardInstrument *Create_LIVEWELL_TANK(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_TANK_LEVEL_LIVEWELL, 0, 100);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_LOW, 1);
+  return instrument;
+}
+
+static DashboardInstrument *Create_GREY_TANK(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_TANK_LEVEL_GREY, 0, 100);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_HIGH, 1);
+  return instrument;
+}
+
+static DashboardInstrument *Create_BLACK_TANK(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY,
+      caption, Properties, OCPN_DBP_STC_TANK_LEVEL_BLACK, 0, 100);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_HIGH, 1);
+  return instrument;
+}
+
+static DashboardInstrument *Create_START_BATTERY_VOLTS(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY, caption, Properties,
+      OCPN_DBP_STC_START_BATTERY_VOLTS, twentyFourVolts ? 18 : 8, twentyFourVolts ? 32 : 16);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(2, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.2f"), DIAL_POSITION_NONE);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(1, DIAL_MARKER_GREEN_MID, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionExtraValue(OCPN_DBP_STC_START_BATTERY_AMPS, _T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_HOUSE_BATTERY_VOLTS(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_Speedometer(parent, wxID_ANY, caption, Properties,
+      OCPN_DBP_STC_HOUSE_BATTERY_VOLTS, twentyFourVolts ? 18 : 8, twentyFourVolts ? 32 : 16);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(2, DIAL_LABEL_HORIZONTAL);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.2f"), DIAL_POSITION_NONE);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(1, DIAL_MARKER_GREEN_MID, 1);
+  ((DashboardInstrument_Dial*)instrument)->SetOptionExtraValue(OCPN_DBP_STC_HOUSE_BATTERY_AMPS, _T("%.1f"), DIAL_POSITION_INSIDE);
+  return instrument;
+}
+
+static DashboardInstrument *Create_RSA(
+    wxWindow *parent, const wxString &caption,
+    InstrumentProperties *Properties, const InstrumentDescriptor &desc) {
+  DashboardInstrument *instrument = new DashboardInstrument_RudderAngle(parent, wxID_ANY, caption, Properties);
+  ((DashboardInstrument_RudderAngle*)instrument)->SetOptionMarker(5, DIAL_MARKER_REDGREEN, 2);
+  wxString labels[] = { _T("40"), _T("30"), _T("20"), _T("10"), _T("0"), _T("10"), _T("20"), _T("30"), _T("40") };
+  ((DashboardInstrument_RudderAngle*)instrument)->SetOptionLabel(10, DIAL_LABEL_HORIZONTAL, wxArrayString(9, labels));
+  return instrument;
+}
+
+// One entry per id, in the order of the enum above. Adding an instrument
+// is an id at the end of the enum and its entry at the end of this table.
+static constexpr InstrumentDescriptor s_Instruments[] = {
+    {ID_DBP_I_POS, wxTRANSLATE("Position"), INSTRUMENT_ICON_SINGLE,
+     false, Create_I_POS, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_SOG, wxTRANSLATE("SOG"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_SOG, "%5.1f"},
+    {ID_DBP_D_SOG, wxTRANSLATE("Speedometer"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_SOG, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_COG, wxTRANSLATE("COG"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_COG, "%03.0f"},
+    {ID_DBP_D_COG, wxTRANSLATE("GNSS Compass"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_COG, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_STW, wxTRANSLATE("STW"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_STW, "%.1f"},
+    // TODO: Option True or Magnetic
+    {ID_DBP_I_HDT, wxTRANSLATE("True HDG"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_HDT, "%03.0f"},
+    {ID_DBP_D_AW, wxTRANSLATE("App. Wind Angle & Speed"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_AW, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_D_AWA, wxTRANSLATE("App. Wind Angle & Speed"), INSTRUMENT_ICON_DIAL,
+     true, Create_D_AW, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_AWS, wxTRANSLATE("App. Wind Speed"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_AWS, "%.1f"},
+    {ID_DBP_D_AWS, wxTRANSLATE("App. Wind Speed"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_AWS, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_D_TW, wxTRANSLATE("True Wind Angle & Speed"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_TW, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_DPT, wxTRANSLATE("Depth"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_DPT, "%5.2f"},
+    {ID_DBP_D_DPT, wxTRANSLATE("Depth"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_DPT, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_TMP, wxTRANSLATE("Water Temp."), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_TMP, "%2.1f"},
+    {ID_DBP_I_VMG, wxTRANSLATE("VMG"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_VMG, "%5.1f"},
+    {ID_DBP_D_VMG, wxTRANSLATE("VMG"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_VMG, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_RSA, wxTRANSLATE("Rudder Angle"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_RSA, "%5.0f"},
+    {ID_DBP_D_RSA, wxTRANSLATE("Rudder Angle"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_RSA, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_SAT, wxTRANSLATE("GNSS in use"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_SAT, "%5.0f"},
+    {ID_DBP_D_GPS, wxTRANSLATE("GNSS Status"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_GPS, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_PTR, wxTRANSLATE("Cursor"), INSTRUMENT_ICON_SINGLE,
+     false, Create_I_PTR, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_GPSUTC, wxTRANSLATE("GNSS Clock"), INSTRUMENT_ICON_SINGLE,
+     false, Create_I_GPSUTC, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_SUN, wxTRANSLATE("Sunrise/Sunset"), INSTRUMENT_ICON_SINGLE,
+     false, Create_I_SUN, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_D_MON, wxTRANSLATE("Moon phase"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_MON, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_ATMP, wxTRANSLATE("Air Temp."), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_ATMP, "%2.1f"},
+    {ID_DBP_I_AWA, wxTRANSLATE("App. Wind Angle"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_AWA, "%3.0f"},
+    {ID_DBP_I_TWA, wxTRANSLATE("True Wind Angle"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_TWA, "%5.0f"},
+    {ID_DBP_I_TWD, wxTRANSLATE("True Wind Direction"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_TWD, "%3.0f"},
+    {ID_DBP_I_TWS, wxTRANSLATE("True Wind Speed"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_TWS, "%2.1f"},
+    {ID_DBP_D_TWD, wxTRANSLATE("True Wind Dir. & Speed"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_TWD, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_HDM, wxTRANSLATE("Mag HDG"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_HDM, "%03.0f"},
+    {ID_DBP_D_HDT, wxTRANSLATE("True Compass"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_HDT, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_D_WDH, wxTRANSLATE("Wind history"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_WDH, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_VLW1, wxTRANSLATE("Trip Log"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_VLW1, "%2.1f"},
+    {ID_DBP_I_VLW2, wxTRANSLATE("Sum Log"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_VLW2, "%2.1f"},
+    {ID_DBP_D_MDA, wxTRANSLATE("Barometric pressure"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_MDA, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_MDA, wxTRANSLATE("Barometric pressure"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_MDA, "%5.1f"},
+    {ID_DBP_D_BPH, wxTRANSLATE("Barometric history"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_BPH, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_FOS, wxTRANSLATE("From Ownship"), INSTRUMENT_ICON_SINGLE,
+     false, Create_I_FOS, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_M_COG, wxTRANSLATE("Mag COG"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_MCOG, "%03.0f"},
+    {ID_DBP_I_PITCH, wxTRANSLATE("Pitch"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_PITCH, "%2.1f"},
+    {ID_DBP_I_HEEL, wxTRANSLATE("Heel"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_HEEL, "%2.1f"},
+    {ID_DBP_D_AWA_TWA, wxTRANSLATE("App & True Wind Angle"),
+     INSTRUMENT_ICON_DIAL, false, Create_D_AWA_TWA, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_GPSLCL, wxTRANSLATE("Local GNSS Clock"), INSTRUMENT_ICON_SINGLE,
+     false, Create_I_GPSLCL, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_CPULCL, wxTRANSLATE("Local CPU Clock"), INSTRUMENT_ICON_SINGLE,
+     false, Create_I_CPULCL, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_SUNLCL, wxTRANSLATE("Local Sunrise/Sunset"),
+     INSTRUMENT_ICON_SINGLE, false, Create_I_SUNLCL, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_ALTI, wxTRANSLATE("Altitude"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_ALTI, "%6.1f"},
+    {ID_DBP_D_ALTI, wxTRANSLATE("Altitude Trace"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_ALTI, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_I_VMGW, wxTRANSLATE("VMG Wind"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_VMGW, "%2.1f"},
+    {ID_DBP_I_HUM, wxTRANSLATE("Humidity"), INSTRUMENT_ICON_SINGLE,
+     false, CreateSingle, OCPN_DBP_STC_HUM, "%3.0f"},
+    {ID_DBP_D_STW_COG, wxTRANSLATE("STW and SOG"), INSTRUMENT_ICON_DIAL,
+     false, Create_D_STW_COG, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_MAIN_ENGINE_RPM, wxTRANSLATE("Engine RPM"), INSTRUMENT_ICON_ENGINE,
+     false, Create_MAIN_ENGINE_RPM, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_PORT_ENGINE_RPM, wxTRANSLATE("Port RPM"), INSTRUMENT_ICON_ENGINE,
+     false, Create_PORT_ENGINE_RPM, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_STBD_ENGINE_RPM, wxTRANSLATE("Stbd RPM"), INSTRUMENT_ICON_ENGINE,
+     false, Create_STBD_ENGINE_RPM, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_MAIN_ENGINE_OIL, wxTRANSLATE("Engine Oil Pressure"),
+     INSTRUMENT_ICON_ENGINE, false, Create_MAIN_ENGINE_OIL,
+     OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_PORT_ENGINE_OIL, wxTRANSLATE("Port Oil Pressure"),
+     INSTRUMENT_ICON_ENGINE, false, Create_PORT_ENGINE_OIL,
+     OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_STBD_ENGINE_OIL, wxTRANSLATE("Stbd Oil Pressure"),
+     INSTRUMENT_ICON_ENGINE, false, Create_STBD_ENGINE_OIL,
+     OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_MAIN_ENGINE_WATER, wxTRANSLATE("Engine Water Temperature"),
+     INSTRUMENT_ICON_ENGINE, false, Create_MAIN_ENGINE_WATER,
+     OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_PORT_ENGINE_WATER, wxTRANSLATE("Port Water Temperature"),
+     INSTRUMENT_ICON_ENGINE, false, Create_PORT_ENGINE_WATER,
+     OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_STBD_ENGINE_WATER, wxTRANSLATE("Stbd Water Temperature"),
+     INSTRUMENT_ICON_ENGINE, false, Create_STBD_ENGINE_WATER,
+     OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_MAIN_ENGINE_VOLTS, wxTRANSLATE("Engine Alternator Voltage"),
+     INSTRUMENT_ICON_ENGINE, false, Create_MAIN_ENGINE_VOLTS,
+     OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_PORT_ENGINE_VOLTS, wxTRANSLATE("Port Alternator Voltage"),
+     INSTRUMENT_ICON_ENGINE, false, Create_PORT_ENGINE_VOLTS,
+     OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_STBD_ENGINE_VOLTS, wxTRANSLATE("Stbd Alternator Voltage"),
+     INSTRUMENT_ICON_ENGINE, false, Create_STBD_ENGINE_VOLTS,
+     OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_MAIN_ENGINE_EXHAUST, wxTRANSLATE("Engine Exhaust Temperature"),
+     INSTRUMENT_ICON_ENGINE, false, Create_MAIN_ENGINE_EXHAUST,
+     OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_PORT_ENGINE_EXHAUST, wxTRANSLATE("Port Exhaust Temperature"),
+     INSTRUMENT_ICON_ENGINE, false, Create_PORT_ENGINE_EXHAUST,
+     OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_STBD_ENGINE_EXHAUST, wxTRANSLATE("Stbd Exhaust Temperature"),
+     INSTRUMENT_ICON_ENGINE, false, Create_STBD_ENGINE_EXHAUST,
+     OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_FUEL_TANK_01, wxTRANSLATE("Fuel 1"), INSTRUMENT_ICON_ENGINE,
+     false, Create_FUEL_TANK_01, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_WATER_TANK_01, wxTRANSLATE("Water 1"), INSTRUMENT_ICON_ENGINE,
+     false, Create_WATER_TANK_01, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_OIL_TANK, wxTRANSLATE("Oil"), INSTRUMENT_ICON_ENGINE,
+     false, Create_OIL_TANK, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_LIVEWELL_TANK, wxTRANSLATE("Live Well"), INSTRUMENT_ICON_ENGINE,
+     false, Create_LIVEWELL_TANK, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_GREY_TANK, wxTRANSLATE("Grey Waste"), INSTRUMENT_ICON_ENGINE,
+     false, Create_GREY_TANK, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_BLACK_TANK, wxTRANSLATE("Black Waste"), INSTRUMENT_ICON_ENGINE,
+     false, Create_BLACK_TANK, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_RSA, wxTRANSLATE("Rudder Angle"), INSTRUMENT_ICON_ENGINE,
+     false, Create_RSA, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_START_BATTERY_VOLTS, wxTRANSLATE("Start Battery Voltage"),
+     INSTRUMENT_ICON_ENGINE, false, Create_START_BATTERY_VOLTS,
+     OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_START_BATTERY_AMPS, wxTRANSLATE("Start Battery Current"),
+     INSTRUMENT_ICON_ENGINE, false, NULL, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_HOUSE_BATTERY_VOLTS, wxTRANSLATE("House Battery Voltage"),
+     INSTRUMENT_ICON_ENGINE, false, Create_HOUSE_BATTERY_VOLTS,
+     OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_HOUSE_BATTERY_AMPS, wxTRANSLATE("House Battery Current"),
+     INSTRUMENT_ICON_ENGINE, false, NULL, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_FUEL_TANK_02, wxTRANSLATE("Fuel 2"), INSTRUMENT_ICON_ENGINE,
+     false, Create_FUEL_TANK_02, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_WATER_TANK_02, wxTRANSLATE("Water 2"), INSTRUMENT_ICON_ENGINE,
+     false, Create_WATER_TANK_02, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_WATER_TANK_03, wxTRANSLATE("Water 3"), INSTRUMENT_ICON_ENGINE,
+     false, Create_WATER_TANK_03, OCPN_DBP_STC_LAST, NULL},
+    {ID_DBP_FUEL_TANK_GAUGE_01, wxTRANSLATE("Fuel 1"), INSTRUMENT_ICON_GAUGE,
+     false, CreateBlock, OCPN_DBP_STC_TANK_LEVEL_FUEL_GAUGE_01, "%s"},
+    {ID_DBP_FUEL_TANK_GAUGE_02, wxTRANSLATE("Fuel 2"), INSTRUMENT_ICON_GAUGE,
+     false, CreateBlock, OCPN_DBP_STC_TANK_LEVEL_FUEL_GAUGE_02, "%s"},
+    {ID_DBP_WATER_TANK_GAUGE_01, wxTRANSLATE("Water 1"), INSTRUMENT_ICON_GAUGE,
+     false, CreateBlock, OCPN_DBP_STC_TANK_LEVEL_WATER_GAUGE_01, "%s"},
+    {ID_DBP_WATER_TANK_GAUGE_02, wxTRANSLATE("Water 2"), INSTRUMENT_ICON_GAUGE,
+     false, CreateBlock, OCPN_DBP_STC_TANK_LEVEL_WATER_GAUGE_02, "%s"},
+    {ID_DBP_WATER_TANK_GAUGE_03, wxTRANSLATE("Water 3"), INSTRUMENT_ICON_GAUGE,
+     false, CreateBlock, OCPN_DBP_STC_TANK_LEVEL_WATER_GAUGE_03, "%s"},
+};
+
+static_assert(sizeof(s_Instruments) / sizeof(s_Instruments[0]) ==
+                  ID_DBP_LAST_ENTRY,
+              "s_Instruments needs one entry per instrument id");
+
+static constexpr bool IsInEnumOrder(int i) {
+  return i == ID_DBP_LAST_ENTRY ||
+         (s_Instruments[i].id == i && IsInEnumOrder(i + 1));
+}
+static_assert(IsInEnumOrder(0), "s_Instruments must follow the ID_DBP_ enum");
+
+static const InstrumentDescriptor *GetInstrumentDescriptor(unsigned int id) {
+  if (id >= ID_DBP_LAST_ENTRY) return NULL;
+  return &s_Instruments[id];
+}
+
 bool IsObsolete(int id) {
-  switch (id) {
-    case ID_DBP_D_AWA:
-      return true;
-    default:
-      return false;
-  }
+  const InstrumentDescriptor *desc = GetInstrumentDescriptor(id);
+  return desc && desc->obsolete;
 }
 
 wxString getInstrumentCaption(unsigned int id) {
-  switch (id) {
-    case ID_DBP_I_POS:
-      return _("Position");
-    case ID_DBP_I_SOG:
-      return _("SOG");
-    case ID_DBP_D_SOG:
-      return _("Speedometer");
-    case ID_DBP_I_COG:
-      return _("COG");
-    case ID_DBP_M_COG:
-      return _("Mag COG");
-    case ID_DBP_D_COG:
-      return _("GNSS Compass");
-    case ID_DBP_D_HDT:
-      return _("True Compass");
-    case ID_DBP_I_STW:
-      return _("STW");
-    case ID_DBP_I_HDT:
-      return _("True HDG");
-    case ID_DBP_I_HDM:
-      return _("Mag HDG");
-    case ID_DBP_D_AW:
-    case ID_DBP_D_AWA:
-      return _("App. Wind Angle & Speed");
-    case ID_DBP_D_AWA_TWA:
-      return _("App & True Wind Angle");
-    case ID_DBP_I_AWS:
-      return _("App. Wind Speed");
-    case ID_DBP_D_AWS:
-      return _("App. Wind Speed");
-    case ID_DBP_D_TW:
-      return _("True Wind Angle & Speed");
-    case ID_DBP_I_ALTI:
-      return _("Altitude");
-    case ID_DBP_D_ALTI:
-      return _("Altitude Trace");
-    case ID_DBP_I_DPT:
-      return _("Depth");
-    case ID_DBP_D_DPT:
-      return _("Depth");
-    case ID_DBP_D_MDA:
-      return _("Barometric pressure");
-    case ID_DBP_I_MDA:
-      return _("Barometric pressure");
-    case ID_DBP_I_TMP:
-      return _("Water Temp.");
-    case ID_DBP_I_ATMP:
-      return _("Air Temp.");
-    case ID_DBP_I_AWA:
-      return _("App. Wind Angle");
-    case ID_DBP_I_TWA:
-      return _("True Wind Angle");
-    case ID_DBP_I_TWD:
-      return _("True Wind Direction");
-    case ID_DBP_I_TWS:
-      return _("True Wind Speed");
-    case ID_DBP_D_TWD:
-      return _("True Wind Dir. & Speed");
-    case ID_DBP_I_VMG:
-      return _("VMG");
-    case ID_DBP_D_VMG:
-      return _("VMG");
-    case ID_DBP_I_VMGW:
-      return _("VMG Wind");
-    case ID_DBP_I_RSA:
-      return _("Rudder Angle");
-    case ID_DBP_D_RSA:
-      return _("Rudder Angle");
-    case ID_DBP_I_SAT:
-      return _("GNSS in use");
-    case ID_DBP_D_GPS:
-      return _("GNSS Status");
-    case ID_DBP_I_PTR:
-      return _("Cursor");
-    case ID_DBP_I_GPSUTC:
-      return _("GNSS Clock");
-    case ID_DBP_I_SUN:
-      return _("Sunrise/Sunset");
-    case ID_DBP_D_MON:
-      return _("Moon phase");
-    case ID_DBP_D_WDH:
-      return _("Wind history");
-    case ID_DBP_D_BPH:
-      return _("Barometric history");
-    case ID_DBP_I_VLW1:
-      return _("Trip Log");
-    case ID_DBP_I_VLW2:
-      return _("Sum Log");
-    case ID_DBP_I_FOS:
-      return _("From Ownship");
-    case ID_DBP_I_PITCH:
-      return _("Pitch");
-    case ID_DBP_I_HEEL:
-      return _("Heel");
-    case ID_DBP_I_GPSLCL:
-      return _("Local GNSS Clock");
-    case ID_DBP_I_CPULCL:
-      return _("Local CPU Clock");
-    case ID_DBP_I_SUNLCL:
-      return _("Local Sunrise/Sunset");
-    case ID_DBP_I_HUM:
-        return _("Humidity");
-    case ID_DBP_D_STW_COG:
-        return _("STW and SOG");
-    // Engine Dashboard
-    case ID_DBP_MAIN_ENGINE_RPM:
-        return _("Engine RPM");
-    case ID_DBP_PORT_ENGINE_RPM:
-        return _("Port RPM");
-    case ID_DBP_STBD_ENGINE_RPM:
-        return _("Stbd RPM");
-    case ID_DBP_MAIN_ENGINE_OIL:
-        return _("Engine Oil Pressure");
-    case ID_DBP_PORT_ENGINE_OIL:
-        return _("Port Oil Pressure");
-    case ID_DBP_STBD_ENGINE_OIL:
-        return _("Stbd Oil Pressure");
-    case ID_DBP_MAIN_ENGINE_WATER:
-        return _("Engine Water Temperature");
-    case ID_DBP_PORT_ENGINE_WATER:
-        return _("Port Water Temperature");
-    case ID_DBP_STBD_ENGINE_WATER:
-        return _("Stbd Water Temperature");
-    case ID_DBP_MAIN_ENGINE_EXHAUST:
-        return _("Engine Exhaust Temperature");
-    case ID_DBP_PORT_ENGINE_EXHAUST:
-        return _("Port Exhaust Temperature");
-    case ID_DBP_STBD_ENGINE_EXHAUST:
-        return _("Stbd Exhaust Temperature");
-    case ID_DBP_MAIN_ENGINE_VOLTS:
-        return _("Engine Alternator Voltage");
-    case ID_DBP_PORT_ENGINE_VOLTS:
-        return _("Port Alternator Voltage");
-    case ID_DBP_STBD_ENGINE_VOLTS:
-        return _("Stbd Alternator Voltage");
-    case ID_DBP_FUEL_TANK_01:
-    case ID_DBP_FUEL_TANK_GAUGE_01:
-        return _("Fuel 1");
-    case ID_DBP_FUEL_TANK_02:
-    case ID_DBP_FUEL_TANK_GAUGE_02:
-        return _("Fuel 2");
-    case ID_DBP_WATER_TANK_01:
-    case ID_DBP_WATER_TANK_GAUGE_01:
-        return _("Water 1");
-    case ID_DBP_WATER_TANK_02:
-    case ID_DBP_WATER_TANK_GAUGE_02:
-        return _("Water 2");
-    case ID_DBP_WATER_TANK_03:
-    case ID_DBP_WATER_TANK_GAUGE_03:
-        return _("Water 3");
-    case ID_DBP_OIL_TANK:
-        return _("Oil");
-    case ID_DBP_LIVEWELL_TANK:
-        return _("Live Well");
-    case ID_DBP_GREY_TANK:
-        return _("Grey Waste");
-    case ID_DBP_BLACK_TANK:
-        return _("Black Waste");
-    case ID_DBP_RSA:
-        return _("Rudder Angle");
-    case ID_DBP_START_BATTERY_VOLTS:
-        return _("Start Battery Voltage");
-    case ID_DBP_HOUSE_BATTERY_VOLTS:
-        return _("House Battery Voltage");
-    case ID_DBP_START_BATTERY_AMPS:
-        return _("Start Battery Current");
-    case ID_DBP_HOUSE_BATTERY_AMPS:
-        return _("House Battery Current");
-  }
-  return _T("");
+  const InstrumentDescriptor *desc = GetInstrumentDescriptor(id);
+  if (!desc) return _T("");
+  return wxGetTranslation(desc->caption);
 }
 
 void getListItemForInstrument(wxListItem &item, unsigned int id) {
+  const InstrumentDescriptor *desc = GetInstrumentDescriptor(id);
   item.SetData(id);
   item.SetText(getInstrumentCaption(id));
-  switch (id) {
-    case ID_DBP_I_POS:
-    case ID_DBP_I_SOG:
-    case ID_DBP_I_COG:
-    case ID_DBP_M_COG:
-    case ID_DBP_I_STW:
-    case ID_DBP_I_HDT:
-    case ID_DBP_I_HDM:
-    case ID_DBP_I_AWS:
-    case ID_DBP_I_DPT:
-    case ID_DBP_I_MDA:
-    case ID_DBP_I_TMP:
-    case ID_DBP_I_ATMP:
-    case ID_DBP_I_TWA:
-    case ID_DBP_I_TWD:
-    case ID_DBP_I_TWS:
-    case ID_DBP_I_AWA:
-    case ID_DBP_I_VMG:
-    case ID_DBP_I_VMGW:
-    case ID_DBP_I_RSA:
-    case ID_DBP_I_SAT:
-    case ID_DBP_I_PTR:
-    case ID_DBP_I_GPSUTC:
-    case ID_DBP_I_GPSLCL:
-    case ID_DBP_I_CPULCL:
-    case ID_DBP_I_SUN:
-    case ID_DBP_I_SUNLCL:
-    case ID_DBP_I_VLW1:
-    case ID_DBP_I_VLW2:
-    case ID_DBP_I_FOS:
-    case ID_DBP_I_PITCH:
-    case ID_DBP_I_HEEL:
-    case ID_DBP_I_ALTI:
-    case ID_DBP_I_HUM:
-      item.SetImage(0);
-      break;
-    case ID_DBP_D_SOG:
-    case ID_DBP_D_COG:
-    case ID_DBP_D_AW:
-    case ID_DBP_D_AWA:
-    case ID_DBP_D_AWS:
-    case ID_DBP_D_TW:
-    case ID_DBP_D_AWA_TWA:
-    case ID_DBP_D_TWD:
-    case ID_DBP_D_DPT:
-    case ID_DBP_D_MDA:
-    case ID_DBP_D_VMG:
-    case ID_DBP_D_RSA:
-    case ID_DBP_D_GPS:
-    case ID_DBP_D_HDT:
-    case ID_DBP_D_MON:
-    case ID_DBP_D_WDH:
-    case ID_DBP_D_BPH:
-    case ID_DBP_D_ALTI:
-    case ID_DBP_D_STW_COG:
-      item.SetImage(1);
-      break;
-    // Engine Dashboard
-    case ID_DBP_MAIN_ENGINE_RPM:
-    case ID_DBP_PORT_ENGINE_RPM:
-    case ID_DBP_STBD_ENGINE_RPM:
-    case ID_DBP_MAIN_ENGINE_OIL:
-    case ID_DBP_PORT_ENGINE_OIL:
-    case ID_DBP_STBD_ENGINE_OIL:
-    case ID_DBP_MAIN_ENGINE_EXHAUST:
-    case ID_DBP_PORT_ENGINE_EXHAUST:
-    case ID_DBP_STBD_ENGINE_EXHAUST:
-    case ID_DBP_MAIN_ENGINE_WATER:
-    case ID_DBP_PORT_ENGINE_WATER:
-    case ID_DBP_STBD_ENGINE_WATER:
-    case ID_DBP_MAIN_ENGINE_VOLTS:
-    case ID_DBP_PORT_ENGINE_VOLTS:
-    case ID_DBP_STBD_ENGINE_VOLTS:
-    case ID_DBP_FUEL_TANK_01:
-    case ID_DBP_FUEL_TANK_02:
-    case ID_DBP_WATER_TANK_01:
-    case ID_DBP_WATER_TANK_02:
-    case ID_DBP_WATER_TANK_03:
-    case ID_DBP_OIL_TANK:
-    case ID_DBP_LIVEWELL_TANK:
-    case ID_DBP_GREY_TANK:
-    case ID_DBP_BLACK_TANK:
-    case ID_DBP_RSA:
-    case ID_DBP_HOUSE_BATTERY_VOLTS:
-    case ID_DBP_START_BATTERY_VOLTS:
-    case ID_DBP_HOUSE_BATTERY_AMPS:
-    case ID_DBP_START_BATTERY_AMPS:
-        item.SetImage(2);
-        break;
-    case ID_DBP_FUEL_TANK_GAUGE_01:
-    case ID_DBP_FUEL_TANK_GAUGE_02:
-    case ID_DBP_WATER_TANK_GAUGE_01:
-    case ID_DBP_WATER_TANK_GAUGE_02:
-    case ID_DBP_WATER_TANK_GAUGE_03:
-        // BUG BUG Should create a SVG image for a gauge
-        item.SetImage(3);
-        break;
-    default:
-        item.SetImage(0);
-        break;
-  }
+  item.SetImage(desc ? desc->icon : INSTRUMENT_ICON_SINGLE);
 }
 
 /*  These two function were taken from gpxdocument.cpp */
@@ -586,54 +1152,22 @@ dashboard_pi::~dashboard_pi(void) {
 }
 
 int dashboard_pi::Init(void) {
+  g_StartupProfile.Begin(_T("Init"));
   AddLocaleCatalog(_T("opencpn-dashboard_pi"));
 
   m_ShowDashboards = true;
   mVar = NAN;
-  mPriPosition = 99;
-  mPriCOGSOG = 99;
-  mPriHeadingT = 99;  // True heading
-  mPriHeadingM = 99;  // Magnetic heading
-  mPriVar = 99;
-  mPriDateTime = 99;
-  mPriAWA = 99;  // Relative wind
-  mPriTWA = 99;  // True wind
-  mPriWDN = 99;  // True hist. wind
-  mPriDepth = 99;
-  mPriSTW = 99;
-  mPriWTP = 99;  // Water temp
-  mPriATMP = 99; // Air temp
-  mPriSatStatus = 99;
-  mPriSatUsed = 99;
+  m_Priority.Reset();
+  m_Derived.Reset();
+  m_SatPrioritySource = PRIO_SRC_UNKNOWN;
+  m_PriorityIDs_Refresh = 0;
   mSatsInView = 0;
-  mPriAlt = 99;
-  mPriRSA = 99;  //Rudder angle
-  mPriPitchRoll = 99; //Pitch and roll
-  mPriHUM = 99;  // Humidity
   m_config_version = -1;
-  mHDx_Watchdog = 2;
-  mHDT_Watchdog = 2;
-  mSatsUsed_Wdog = 2;
-  mSatStatus_Wdog = 2;
-  mVar_Watchdog = 2;
-  mMWVA_Watchdog = 2;
-  mMWVT_Watchdog = 2;
-  mDPT_DBT_Watchdog = 2; // Depth
-  mSTW_Watchdog = 2;
-  mWTP_Watchdog = 2;
-  mRSA_Watchdog = 2;
-  mVMG_Watchdog = 2;
-  mVMGW_Watchdog = 2;
-  mUTC_Watchdog = 2;
-  mATMP_Watchdog = 2;
-  mWDN_Watchdog = 2;
-  mMDA_Watchdog = 2;
-  mPITCH_Watchdog = 2;
-  mHEEL_Watchdog = 2;
-  mALT_Watchdog = 2;
-  mLOG_Watchdog = 2;
-  mTrLOG_Watchdog = 2;
-  mHUM_Watchdog = 2;
+  m_bGlobalConfigDirty = false;
+  m_iSaveConfigTicks = 0;
+  // Let all watchdogs blank their instruments 2 seconds after start
+  m_Watchdogs.Resize(WD_LAST);
+  for (int i = 0; i < WD_LAST; i++) m_Watchdogs.Arm(i, 2);
 
   g_pFontTitle = new wxFontData();
   g_pFontTitle->SetChosenFont(wxFont(10, wxFONTFAMILY_SWISS, wxFONTSTYLE_ITALIC, wxFONTWEIGHT_NORMAL));
@@ -656,7 +1190,9 @@ int dashboard_pi::Init(void) {
   m_pconfig = GetOCPNConfigObject();
 
   //    And load the configuration items
+  StartupProfile::Clock::time_point start = StartupProfile::Clock::now();
   LoadConfig();
+  g_StartupProfile.Add(_T("LoadConfig"), start);
 
   //    This PlugIn needs a toolbar icon
   //    m_toolbar_item_id = InsertPlugInTool( _T(""), _img_dashboard,
@@ -681,9 +1217,11 @@ int dashboard_pi::Init(void) {
     rolloverIcon = _T("");
   }
 
+  start = StartupProfile::Clock::now();
   m_toolbar_item_id = InsertPlugInToolSVG(
       _T(""), normalIcon, rolloverIcon, toggledIcon, wxITEM_CHECK,
       _("Dashboard"), _T(""), NULL, DASHBOARD_TOOL_POSITION, 0, this);
+  g_StartupProfile.Add(_T("InsertPlugInToolSVG"), start);
 
   ApplyConfig();
   for (size_t i = 0; i < m_ArrayOfDashboardWindow.GetCount(); i++) {
@@ -698,6 +1236,7 @@ int dashboard_pi::Init(void) {
 
   // initialize NavMsg listeners
   //-----------------------------
+  start = StartupProfile::Clock::now();
 
   // Rudder data PGN 127245
   wxDEFINE_EVENT(EVT_N2K_127245, ObservedEvt);
@@ -812,16 +1351,10 @@ int dashboard_pi::Init(void) {
   Bind(EVT_N2K_127508, [&](ObservedEvt ev) {
       HandleN2K_127508(ev);
       });
-
-  // Initialize the watchdog timers
-  // Engine watchdog zeros tachometer, oil pressure & engine temperature if no RPM's received
-  // Tank level watchdog zeroes tanks if no tank level data is received
-  engineWatchDog = wxDateTime::Now() - wxTimeSpan::Seconds(5);
-  tankLevelWatchDog = wxDateTime::Now() - wxTimeSpan::Seconds(5);
-  engineWatchDogDynamic = wxDateTime::Now() - wxTimeSpan::Seconds(5);
-
+  g_StartupProfile.Add(_T("Listener registration"), start);
 
   Start(1000, wxTIMER_CONTINUOUS);
+  g_StartupProfile.End();
 
   return (WANTS_CURSOR_LATLON | WANTS_TOOLBAR_CALLBACK | INSTALLS_TOOLBAR_TOOL |
           WANTS_PREFERENCES | WANTS_CONFIG | WANTS_NMEA_SENTENCES |
@@ -830,6 +1363,19 @@ int dashboard_pi::Init(void) {
 
 bool dashboard_pi::DeInit(void) {
   SaveConfig();
+
+  // Which source won each data group and how often it changed
+  for (int g = 0; g < PG_LAST; g++) {
+    wxString wins;
+    for (int src = 1; src < PRIORITY_SOURCES; src++) {
+      if (m_Priority.GetWins(g, src))
+        wins += wxString::Format(_T(" %d:%lu"), src, m_Priority.GetWins(g, src));
+    }
+    if (!wins.IsEmpty())
+      wxLogMessage(_T("Dashboard: Source priority %s, wins%s, flaps %lu"),
+                   PriorityArbiter::GetGroupName(g), wins,
+                   m_Priority.GetFlaps(g));
+  }
   if (IsRunning())  // Timer started?
     Stop();         // Stop timer
 
@@ -837,6 +1383,10 @@ bool dashboard_pi::DeInit(void) {
     DashboardWindow *dashboard_window =
         m_ArrayOfDashboardWindow.Item(i)->m_pDashboardWindow;
     if (dashboard_window) {
+      if (dashboard_window->GetSuppressedRepaints())
+        wxLogMessage(_T("Dashboard: %s, %lu repaints without visible change suppressed"),
+                     m_ArrayOfDashboardWindow.Item(i)->m_sCaption,
+                     dashboard_window->GetSuppressedRepaints());
       dashboard_window->Close();
       dashboard_window->Destroy();
       delete dashboard_window;
@@ -875,37 +1425,6 @@ double GetJsonDouble(wxJSONValue &value) {
 void dashboard_pi::Notify() {
   SendUtcTimeToAllInstruments(mUTCDateTime);
 
-  // Engine Dashboard Parts
-  // BUG BUG Consider using OCPN_DBP_STC as the for loop constraints
-
-  if (wxDateTime::Now() > (engineWatchDog + wxTimeSpan::Seconds(5))) {
-      // Zero the engine instruments
-      // We go from zero to ID_DBP_FUEL_TANK_01 + 3, because there are three additional values
-      // in OCPN_DBP_STC_... (instrument.h) for the engine hours, which 
-      // do not have their own gauge, but populate the engine rpm gauges
-      // OCPN_DBP_STC_MAIN_ENGINE_RPM = 34 bis OCPN_DBP_STC_TANK_LEVEL_FUEL_01 = 52
-      for (int i = (DASH_CAP)OCPN_DBP_STC_MAIN_ENGINE_RPM; i < (DASH_CAP)OCPN_DBP_STC_MAIN_ENGINE_OIL; i++) {
-          SendSentenceToAllInstruments((DASH_CAP)i, 0.0f, "");
-      }
-  }
-
-  if (wxDateTime::Now() > (engineWatchDogDynamic + wxTimeSpan::Seconds(5))) {
-     for (int i = (DASH_CAP)OCPN_DBP_STC_MAIN_ENGINE_OIL; i < (DASH_CAP)OCPN_DBP_STC_TANK_LEVEL_FUEL_01; i++) {
-             SendSentenceToAllInstruments((DASH_CAP)i, 0.0f, "");
-     }
-  }
-    if (wxDateTime::Now() > (tankLevelWatchDog + wxTimeSpan::Seconds(5))) {
-      // Zero the tank instruments
-      // We go from ID_DBP_FUEL_TANK_01 + 3 to IDP_LAST_ENTRY + 3, 
-      // because there are three additional values
-      // in OCPN_DBP_STC_... (instrument.h) for the engine hours, which 
-      // do not have their own gauge, but populate the engine rpm gauges
-      // OCPN_DBP_STC_LAST = 71
-      for (int i = (DASH_CAP)OCPN_DBP_STC_TANK_LEVEL_FUEL_01; i < (DASH_CAP)OCPN_DBP_STC_LAST; i++) { // Because RSA is double
-          SendSentenceToAllInstruments((DASH_CAP)i, 0.0f, "");
-      }
-  }
-  
   for (size_t i = 0; i < m_ArrayOfDashboardWindow.GetCount(); i++) {
     DashboardWindow *dashboard_window =
         m_ArrayOfDashboardWindow.Item(i)->m_pDashboardWindow;
@@ -923,177 +1442,220 @@ void dashboard_pi::Notify() {
 #endif
     }
   }
-  //  Manage the watchdogs
-
-  mHDx_Watchdog--;
-  if (mHDx_Watchdog <= 0) {
-    mHdm = NAN;
-    mPriHeadingM = 99;
-    SendSentenceToAllInstruments(OCPN_DBP_STC_HDM, mHdm, _T("\u00B0"));
-    mHDx_Watchdog = gps_watchdog_timeout_ticks;
-  }
+  //  Manage the watchdogs, including the engine and tank watchdogs which
+  //  mark their instruments stale (eg. Engine switched off)
+  m_Watchdogs.Advance(WatchdogWheel::Clock::now(), m_ExpiredWatchdogs);
+  for (size_t i = 0; i < m_ExpiredWatchdogs.size(); i++)
+    OnWatchdogExpired(m_ExpiredWatchdogs[i]);
 
-  mHDT_Watchdog--;
-  if (mHDT_Watchdog <= 0) {
-    mPriHeadingT = 99;
-    SendSentenceToAllInstruments(OCPN_DBP_STC_HDT, NAN, _T("\u00B0T"));
-    mHDT_Watchdog = gps_watchdog_timeout_ticks;
-  }
+  if (m_iSaveConfigTicks > 0 && --m_iSaveConfigTicks == 0) SaveConfig();
 
-  mVar_Watchdog--;
-  if (mVar_Watchdog <= 0) {
-    mVar = NAN;
-    mPriVar = 99;
-    SendSentenceToAllInstruments(OCPN_DBP_STC_HMV, NAN, _T("\u00B0T"));
-    mVar_Watchdog = gps_watchdog_timeout_ticks;
+  // Set Satellite Status data from the same source as OCPN use for position
+  if (--m_PriorityIDs_Refresh <= 0) UpdatePriorityIdentifiers();
+  int satSource = 0;
+  switch (m_SatPrioritySource) {
+    case PRIO_SRC_NMEA0183:
+      satSource = 3; // GSV
+      break;
+    case PRIO_SRC_SIGNALK:
+      satSource = 2; // SignalK
+      break;
+    case PRIO_SRC_NMEA2000:
+      satSource = 1; // N2k
+      break;
+    default:
+      break;
   }
+  // A win only when the source is selected, not on every tick
+  if (satSource && !m_Priority.IsActive(PG_SAT_STATUS, satSource))
+    m_Priority.Won(PG_SAT_STATUS, satSource);
+}
 
-  mSatsUsed_Wdog--;
-  if (mSatsUsed_Wdog <= 0) {
-    mPriSatUsed = 99;
-    mSatsInUse = 0;
-    SendSentenceToAllInstruments(OCPN_DBP_STC_SAT, NAN, _T(""));
-    mSatsUsed_Wdog = gps_watchdog_timeout_ticks;
-  }
+int dashboard_pi::GetPrioritySource(const std::string &identifier) {
+  if (identifier.find("nmea0183") != std::string::npos)
+    return PRIO_SRC_NMEA0183;
+  else if (identifier.find("SignalK") != std::string::npos)
+    return PRIO_SRC_SIGNALK;
+  else if (identifier.find("nmea2000") != std::string::npos)
+    return PRIO_SRC_NMEA2000;
+  return PRIO_SRC_UNKNOWN;
+}
 
-  mSatStatus_Wdog--;
-  if (mSatStatus_Wdog <= 0) {
-    SAT_INFO sats[4];
-    for (int i = 0; i < 4; i++) {
-      sats[i].SatNumber = 0;
-      sats[i].SignalToNoiseRatio = 0;
-    }
-    SendSatInfoToAllInstruments(0, 1, wxEmptyString, sats);
-    SendSatInfoToAllInstruments(0, 2, wxEmptyString, sats);
-    SendSatInfoToAllInstruments(0, 3, wxEmptyString, sats);
-    mPriSatStatus = 99;
-    mSatStatus_Wdog = gps_watchdog_timeout_ticks;
-  }
-  // Set Satellite Status data from the same source as OCPN use for position
-  // Get the identifiers
+// The OCPN priorities change rarely, so only look at them every
+// PRIORITY_IDS_REFRESH_TICKS and parse them only when they did change.
+void dashboard_pi::UpdatePriorityIdentifiers(void) {
+  m_PriorityIDs_Refresh = PRIORITY_IDS_REFRESH_TICKS;
   std::vector<std::string> PriorityIDs = GetActivePriorityIdentifiers();
+  if (PriorityIDs == m_PriorityIDs) return;
+  m_PriorityIDs.swap(PriorityIDs);
+
   // Get current satellite priority identifier = item 4
-  std::string satID = PriorityIDs[4];
-  if (satID.find("nmea0183") != std::string::npos)
-    mPriSatStatus = 3; // GSV
-  else if (satID.find("SignalK") != std::string::npos)
-    mPriSatStatus = 2; // SignalK
-  else if (satID.find("nmea2000") != std::string::npos) {
-    prioN2kPGNsat = satID;
-    mPriSatStatus = 1; // N2k
+  m_SatPrioritySource = PRIO_SRC_UNKNOWN;
+  if (m_PriorityIDs.size() > 4) {
+    const std::string &satID = m_PriorityIDs[4];
+    m_SatPrioritySource = GetPrioritySource(satID);
+    if (m_SatPrioritySource == PRIO_SRC_NMEA2000) prioN2kPGNsat = satID;
   }
+}
 
-  mMWVA_Watchdog--;
-  if (mMWVA_Watchdog <= 0) {
-    SendSentenceToAllInstruments(OCPN_DBP_STC_AWA, NAN, _T("-"));
-    SendSentenceToAllInstruments(OCPN_DBP_STC_AWS, NAN, _T("-"));
-    mPriAWA = 99;
-    mMWVA_Watchdog = gps_watchdog_timeout_ticks;
-  }
+// Watchdog table, in the order of the WD_ enum
+const dashboard_pi::WatchdogEntry dashboard_pi::s_WatchdogTable[WD_LAST] = {
+    // WD_HDM
+    {WATCHDOG_GPS_TIMEOUT,
+     {OCPN_DBP_STC_HDM, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("\u00B0"), PG_HEADING_M},
+    // WD_HDT
+    {WATCHDOG_GPS_TIMEOUT,
+     {OCPN_DBP_STC_HDT, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("\u00B0T"), PG_HEADING_T},
+    // WD_VAR
+    {WATCHDOG_GPS_TIMEOUT,
+     {OCPN_DBP_STC_HMV, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("\u00B0T"), PG_VAR},
+    // WD_SAT_USED
+    {WATCHDOG_GPS_TIMEOUT,
+     {OCPN_DBP_STC_SAT, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T(""), PG_SAT_USED},
+    // WD_SAT_STATUS, sat info is cleared in OnWatchdogExpired()
+    {WATCHDOG_GPS_TIMEOUT,
+     {OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T(""), PG_SAT_STATUS},
+    // WD_MWVA
+    {WATCHDOG_GPS_TIMEOUT,
+     {OCPN_DBP_STC_AWA, OCPN_DBP_STC_AWS, OCPN_DBP_STC_LAST},
+     _T("-"), PG_AWA},
+    // WD_MWVT
+    {WATCHDOG_GPS_TIMEOUT,
+     {OCPN_DBP_STC_TWA, OCPN_DBP_STC_TWS, OCPN_DBP_STC_TWS2},
+     _T("-"), PG_TWA},
+    // WD_DPT
+    {WATCHDOG_GPS_TIMEOUT,
+     {OCPN_DBP_STC_DPT, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("-"), PG_DEPTH},
+    // WD_STW
+    {WATCHDOG_GPS_TIMEOUT,
+     {OCPN_DBP_STC_STW, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("-"), PG_STW},
+    // WD_WTP
+    {no_nav_watchdog_timeout_ticks,
+     {OCPN_DBP_STC_TMP, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("-"), PG_WTP},
+    // WD_RSA
+    {WATCHDOG_GPS_TIMEOUT,
+     {OCPN_DBP_STC_RSA, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("-"), PG_RSA},
+    // WD_VMG
+    {WATCHDOG_GPS_TIMEOUT,
+     {OCPN_DBP_STC_VMG, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("-"), -1},
+    // WD_VMGW
+    {WATCHDOG_GPS_TIMEOUT,
+     {OCPN_DBP_STC_VMGW, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("-"), PG_VMGW},
+    // WD_UTC
+    {WATCHDOG_GPS_TIMEOUT,
+     {OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T(""), PG_DATETIME},
+    // WD_ATMP
+    {no_nav_watchdog_timeout_ticks,
+     {OCPN_DBP_STC_ATMP, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("-"), PG_ATMP},
+    // WD_WDN
+    {no_nav_watchdog_timeout_ticks,
+     {OCPN_DBP_STC_TWD, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("-"), PG_WDN},
+    // WD_MDA
+    {no_nav_watchdog_timeout_ticks,
+     {OCPN_DBP_STC_MDA, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("-"), PG_MDA},
+    // WD_PITCH
+    {WATCHDOG_GPS_TIMEOUT,
+     {OCPN_DBP_STC_PITCH, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("-"), PG_PITCH_ROLL},
+    // WD_HEEL
+    {WATCHDOG_GPS_TIMEOUT,
+     {OCPN_DBP_STC_HEEL, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("-"), PG_PITCH_ROLL},
+    // WD_ALT
+    {WATCHDOG_GPS_TIMEOUT,
+     {OCPN_DBP_STC_ALTI, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("-"), PG_ALT},
+    // WD_LOG
+    {no_nav_watchdog_timeout_ticks,
+     {OCPN_DBP_STC_VLW2, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("-"), -1},
+    // WD_TRLOG
+    {no_nav_watchdog_timeout_ticks,
+     {OCPN_DBP_STC_VLW1, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("-"), -1},
+    // WD_HUM
+    {no_nav_watchdog_timeout_ticks,
+     {OCPN_DBP_STC_HUM, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T("-"), PG_HUM},
+    // WD_ENGINE, RPM
+    {5, {OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T(""), -1, true,
+     OCPN_DBP_STC_MAIN_ENGINE_RPM, OCPN_DBP_STC_MAIN_ENGINE_OIL},
+    // WD_ENGINE_DYNAMIC, oil, exhaust, water, volts and hours
+    {5, {OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T(""), -1, true,
+     OCPN_DBP_STC_MAIN_ENGINE_OIL, OCPN_DBP_STC_TANK_LEVEL_FUEL_01},
+    // WD_TANK, tanks and batteries
+    {5, {OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST, OCPN_DBP_STC_LAST},
+     _T(""), -1, true,
+     OCPN_DBP_STC_TANK_LEVEL_FUEL_01, OCPN_DBP_STC_LAST},
+};
 
-  mMWVT_Watchdog--;
-  if (mMWVT_Watchdog <= 0) {
-    SendSentenceToAllInstruments(OCPN_DBP_STC_TWA, NAN, _T("-"));
-    SendSentenceToAllInstruments(OCPN_DBP_STC_TWS, NAN, _T("-"));
-    SendSentenceToAllInstruments(OCPN_DBP_STC_TWS2, NAN, _T("-"));
-    mPriTWA = 99;
-    mMWVT_Watchdog = gps_watchdog_timeout_ticks;
-  }
+void dashboard_pi::FeedWatchdog(int group) {
+  int timeout = s_WatchdogTable[group].timeout;
+  if (timeout == WATCHDOG_GPS_TIMEOUT) timeout = gps_watchdog_timeout_ticks;
+  m_Watchdogs.Arm(group, timeout);
+}
 
-  mDPT_DBT_Watchdog--;
-  if (mDPT_DBT_Watchdog <= 0) {
-    mPriDepth = 99;
-    SendSentenceToAllInstruments(OCPN_DBP_STC_DPT, NAN, _T("-"));
-    mDPT_DBT_Watchdog = gps_watchdog_timeout_ticks;
-  }
+void dashboard_pi::OnWatchdogExpired(int group) {
+  const WatchdogEntry &wd = s_WatchdogTable[group];
+  if (wd.priority >= 0) m_Priority.Release(wd.priority);
 
-  mSTW_Watchdog--;
-  if (mSTW_Watchdog <= 0) {
-    mPriSTW = 99;
-    SendSentenceToAllInstruments(OCPN_DBP_STC_STW, NAN, _T("-"));
-    mSTW_Watchdog = gps_watchdog_timeout_ticks;
+  if (wd.transitionOnly) {
+    // Stays stale until the next value of the cap, no re-arm here
+    for (int i = wd.rangeFirst; i < wd.rangeEnd; i++)
+      SendStaleToAllInstruments((DASH_CAP)i, true);
+    return;
   }
 
-  mWTP_Watchdog--;
-  if (mWTP_Watchdog <= 0) {
-    mPriWTP = 99;
-    SendSentenceToAllInstruments(OCPN_DBP_STC_TMP, NAN, "-");
-    mWTP_Watchdog = no_nav_watchdog_timeout_ticks;
-  }
-  mRSA_Watchdog--;
-  if (mRSA_Watchdog <= 0) {
-    mPriRSA = 99;
-    SendSentenceToAllInstruments(OCPN_DBP_STC_RSA, NAN, "-");
-    mRSA_Watchdog = gps_watchdog_timeout_ticks;
-  }
-  mVMG_Watchdog--;
-  if (mVMG_Watchdog <= 0) {
-    SendSentenceToAllInstruments(OCPN_DBP_STC_VMG, NAN, "-");
-    mVMG_Watchdog = gps_watchdog_timeout_ticks;
-  }
-  mVMGW_Watchdog--;
-  if (mVMGW_Watchdog <= 0) {
-    SendSentenceToAllInstruments(OCPN_DBP_STC_VMGW, NAN, "-");
-    mVMGW_Watchdog = gps_watchdog_timeout_ticks;
-  }
-  mUTC_Watchdog--;
-  if (mUTC_Watchdog <= 0) {
-    mPriDateTime = 99;
-    mUTC_Watchdog = gps_watchdog_timeout_ticks;
-  }
-  mATMP_Watchdog--;
-  if (mATMP_Watchdog <= 0) {
-    SendSentenceToAllInstruments(OCPN_DBP_STC_ATMP, NAN, "-");
-    mPriATMP = 99;
-    mATMP_Watchdog = gps_watchdog_timeout_ticks;
-  }
-  mWDN_Watchdog--;
-  if (mWDN_Watchdog <= 0) {
-    SendSentenceToAllInstruments(OCPN_DBP_STC_TWD, NAN, _T("-"));
-    mPriWDN = 99;
-    mWDN_Watchdog = no_nav_watchdog_timeout_ticks;
-  }
-  mMDA_Watchdog--;
-  if (mMDA_Watchdog <= 0) {
-    SendSentenceToAllInstruments(OCPN_DBP_STC_MDA, NAN, _T("-"));
-    mPriMDA = 99;
-    mMDA_Watchdog = gps_watchdog_timeout_ticks;
-  }
-  mPITCH_Watchdog--;
-  if (mPITCH_Watchdog <= 0) {
-    mPriPitchRoll = 99;
-    SendSentenceToAllInstruments(OCPN_DBP_STC_PITCH, NAN, _T("-"));
-    mPITCH_Watchdog = gps_watchdog_timeout_ticks;
-  }
-  mHEEL_Watchdog--;
-  if (mHEEL_Watchdog <= 0) {
-    mPriPitchRoll = 99;
-    SendSentenceToAllInstruments(OCPN_DBP_STC_HEEL, NAN, _T("-"));
-    mHEEL_Watchdog = gps_watchdog_timeout_ticks;
-  }
-  mALT_Watchdog--;
-  if (mALT_Watchdog <= 0) {
-    mPriAlt = 99;
-    SendSentenceToAllInstruments(OCPN_DBP_STC_ALTI, NAN, _T("-"));
-    mALT_Watchdog = gps_watchdog_timeout_ticks;
+  // Values held by the plugin itself
+  switch (group) {
+    case WD_HDM:
+      mHdm = NAN;
+      break;
+    case WD_VAR:
+      mVar = NAN;
+      break;
+    case WD_SAT_USED:
+      mSatsInUse = 0;
+      break;
+    case WD_SAT_STATUS: {
+      // OCPN may have switched the position source, look at it next tick
+      m_PriorityIDs_Refresh = 0;
+      SAT_INFO sats[4];
+      for (int i = 0; i < 4; i++) {
+        sats[i].SatNumber = 0;
+        sats[i].SignalToNoiseRatio = 0;
+      }
+      SendSatInfoToAllInstruments(0, 1, wxEmptyString, sats);
+      SendSatInfoToAllInstruments(0, 2, wxEmptyString, sats);
+      SendSatInfoToAllInstruments(0, 3, wxEmptyString, sats);
+      break;
+    }
+    default:
+      break;
   }
 
-  mLOG_Watchdog--;
-  if (mLOG_Watchdog <= 0) {
-    SendSentenceToAllInstruments(OCPN_DBP_STC_VLW2, NAN, _T("-"));
-    mLOG_Watchdog = no_nav_watchdog_timeout_ticks;
-  }
-  mTrLOG_Watchdog--;
-  if (mTrLOG_Watchdog <= 0) {
-    SendSentenceToAllInstruments(OCPN_DBP_STC_VLW1, NAN, _T("-"));
-    mTrLOG_Watchdog = no_nav_watchdog_timeout_ticks;
-  }
-  mHUM_Watchdog--;
-  if (mHUM_Watchdog <= 0) {
-      mPriHUM = 99;
-      SendSentenceToAllInstruments(OCPN_DBP_STC_HUM, NAN, _T("-"));
-      mHUM_Watchdog = no_nav_watchdog_timeout_ticks;
-  }
+  for (int i = 0; i < 3 && wd.caps[i] != OCPN_DBP_STC_LAST; i++)
+    SendSentenceToAllInstruments(wd.caps[i], NAN, wd.unit);
+
+  // Keep blanking every timeout period until data is back
+  FeedWatchdog(group);
 }
 
 int dashboard_pi::GetAPIVersionMajor() { return MY_API_VERSION_MAJOR; }
@@ -1137,20 +1699,70 @@ double dashboard_pi::Psi2Pascal(double pressure) {
 
 void dashboard_pi::SendSentenceToAllInstruments(DASH_CAP st, double value,
                                                 wxString unit) {
+  if (m_StaleCaps.test(st) && !std::isnan(value))
+    SendStaleToAllInstruments(st, false);
   for (size_t i = 0; i < m_ArrayOfDashboardWindow.GetCount(); i++) {
     DashboardWindow *dashboard_window =
         m_ArrayOfDashboardWindow.Item(i)->m_pDashboardWindow;
     if (dashboard_window)
       dashboard_window->SendSentenceToAllInstruments(st, value, unit);
   }
-  if (st == OCPN_DBP_STC_HDT) {
-    g_dHDT = value;
-  }
-  if (st == OCPN_DBP_STC_SOG) {
-    g_dSOG = value;
+  // Inputs of the derived data. SOG is sent in user units, the filter
+  // holds it in knots.
+  switch (st) {
+    case OCPN_DBP_STC_HDT:
+      m_Derived.Set(DD_HDT, value);
+      break;
+    case OCPN_DBP_STC_SOG:
+      m_Derived.Set(DD_SOG, std::isnan(value) ? NAN : mSOGFilter.get());
+      break;
+    case OCPN_DBP_STC_COG:
+      m_Derived.Set(DD_COG, value);
+      PublishDerived(DD_OUT_MCOG);
+      break;
+    case OCPN_DBP_STC_HMV:
+      m_Derived.Set(DD_VAR, value);
+      break;
+    default:
+      break;
   }
-  if (st == OCPN_DBP_STC_COG) {
-    g_dCOG = value;
+}
+
+void dashboard_pi::PublishDerived(int output) {
+  if (!m_Derived.Take(output)) return;
+  switch (output) {
+    case DD_OUT_TRUEWIND: {
+      if (std::isnan(m_Derived.GetTws())) break;
+      double twa = m_Derived.GetTwa();
+      if (twa < 0)
+        SendSentenceToAllInstruments(OCPN_DBP_STC_TWA, -twa, _T("\u00B0L"));
+      else
+        SendSentenceToAllInstruments(OCPN_DBP_STC_TWA, twa, _T("\u00B0R"));
+      SendSentenceToAllInstruments(OCPN_DBP_STC_TWD, m_Derived.GetTwd(),
+                                   _T("\u00B0"));
+      double tws = toUsrSpeed_Plugin(m_Derived.GetTws(), g_iDashWindSpeedUnit);
+      SendSentenceToAllInstruments(OCPN_DBP_STC_TWS, tws,
+                                   getUsrSpeedUnit_Plugin(g_iDashWindSpeedUnit));
+      SendSentenceToAllInstruments(OCPN_DBP_STC_TWS2, tws,
+                                   getUsrSpeedUnit_Plugin(g_iDashWindSpeedUnit));
+      break;
+    }
+    case DD_OUT_MCOG:
+      // Sent also if the variation is unknown, to clear the instrument
+      SendSentenceToAllInstruments(OCPN_DBP_STC_MCOG, m_Derived.GetMcog(),
+                                   _T("\u00B0M"));
+      break;
+    case DD_OUT_VMGW:
+      // Only if no VMG is received from SignalK
+      if (std::isnan(m_Derived.GetVmgw()) || !m_Priority.Accept(PG_VMGW, 2))
+        break;
+      SendSentenceToAllInstruments(
+          OCPN_DBP_STC_VMGW,
+          toUsrSpeed_Plugin(m_Derived.GetVmgw(), g_iDashSpeedUnit),
+          getUsrSpeedUnit_Plugin(g_iDashSpeedUnit));
+      m_Priority.Won(PG_VMGW, 2);
+      FeedWatchdog(WD_VMGW);
+      break;
   }
 }
 
@@ -1162,6 +1774,16 @@ void dashboard_pi::SendUtcTimeToAllInstruments(wxDateTime value) {
   }
 }
 
+void dashboard_pi::SendStaleToAllInstruments(DASH_CAP st, bool stale) {
+  m_StaleCaps.set(st, stale);
+  for (size_t i = 0; i < m_ArrayOfDashboardWindow.GetCount(); i++) {
+    DashboardWindow *dashboard_window =
+        m_ArrayOfDashboardWindow.Item(i)->m_pDashboardWindow;
+    if (dashboard_window)
+      dashboard_window->SendStaleToAllInstruments(st, stale);
+  }
+}
+
 void dashboard_pi::SendSatInfoToAllInstruments(int cnt, int seq, wxString talk,
                                                SAT_INFO sats[4]) {
   for (size_t i = 0; i < m_ArrayOfDashboardWindow.GetCount(); i++) {
@@ -1178,7 +1800,7 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
 
   if (m_NMEA0183.PreParse()) {
     if (m_NMEA0183.LastSentenceIDReceived == _T("DBT")) {        
-      if (mPriDepth >= 5) {
+      if (m_Priority.Accept(PG_DEPTH, 5)) {
         if (m_NMEA0183.Parse()) {
           /*
            double m_NMEA0183.Dbt.DepthFeet;
@@ -1198,15 +1820,15 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                 OCPN_DBP_STC_DPT,
                 toUsrDistance_Plugin(depth / 1852.0, g_iDashDepthUnit),
                 getUsrDistanceUnit_Plugin(g_iDashDepthUnit));
-            mPriDepth = 5;
-            mDPT_DBT_Watchdog = gps_watchdog_timeout_ticks;
+            m_Priority.Won(PG_DEPTH, 5);
+            FeedWatchdog(WD_DPT);
             return;
           }
         }        
       }
     }
     if (m_NMEA0183.LastSentenceIDReceived == _T("DPT")) {
-      if (mPriDepth >= 4) {
+      if (m_Priority.Accept(PG_DEPTH, 4)) {
         if (m_NMEA0183.Parse()) {
           /*
            double m_NMEA0183.Dpt.DepthMeters
@@ -1222,8 +1844,8 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                 OCPN_DBP_STC_DPT,
                 toUsrDistance_Plugin(depth / 1852.0, g_iDashDepthUnit),
                 getUsrDistanceUnit_Plugin(g_iDashDepthUnit));
-            mPriDepth = 4;
-            mDPT_DBT_Watchdog = gps_watchdog_timeout_ticks;
+            m_Priority.Won(PG_DEPTH, 4);
+            FeedWatchdog(WD_DPT);
             return;
           }
         }
@@ -1232,11 +1854,11 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
     // TODO: GBS - GPS Satellite fault detection
     if (m_NMEA0183.LastSentenceIDReceived == _T("GGA")) {
       if (0)  // debug output
-        printf("GGA mPriPosition=%d mPriSatUsed=%d \tnSat=%d alt=%3.2f\n",
-                mPriPosition, mPriSatUsed,
+        printf("GGA PriPosition=%d PriSatUsed=%d \tnSat=%d alt=%3.2f\n",
+                m_Priority.GetRank(PG_POSITION), m_Priority.GetRank(PG_SAT_USED),
                 m_NMEA0183.Gga.NumberOfSatellitesInUse,
                 m_NMEA0183.Gga.AntennaAltitudeMeters);
-      if (mPriAlt >= 3 && (mPriPosition >= 1 || mPriSatUsed >= 1)) {
+      if (m_Priority.Accept(PG_ALT, 3) && (m_Priority.Accept(PG_POSITION, 1) || m_Priority.Accept(PG_SAT_USED, 1))) {
         if (m_NMEA0183.Parse()) {
           if (m_NMEA0183.Gga.GPSQuality > 0 &&
               m_NMEA0183.Gga.NumberOfSatellitesInUse >= 5) {
@@ -1244,16 +1866,16 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
             // typically less accurate than lon and lat.
             double alt = m_NMEA0183.Gga.AntennaAltitudeMeters;
             SendSentenceToAllInstruments(OCPN_DBP_STC_ALTI, alt, _T("m"));
-            mPriAlt = 3;
-            mALT_Watchdog = gps_watchdog_timeout_ticks;
+            m_Priority.Won(PG_ALT, 3);
+            FeedWatchdog(WD_ALT);
           }
         }
       }
-      if (mPriPosition >= 4 || mPriSatUsed >= 3) {
+      if (m_Priority.Accept(PG_POSITION, 4) || m_Priority.Accept(PG_SAT_USED, 3)) {
         if (m_NMEA0183.Parse()) {
           if (m_NMEA0183.Gga.GPSQuality > 0) {
-            if (mPriPosition >= 4) {
-              mPriPosition = 4;
+            if (m_Priority.Accept(PG_POSITION, 4)) {
+              m_Priority.Won(PG_POSITION, 4);
               double lat, lon;
               float llt = m_NMEA0183.Gga.Position.Latitude.Latitude;
               int lat_deg_int = (int)(llt / 100);
@@ -1272,16 +1894,16 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
               if (m_NMEA0183.Gga.Position.Longitude.Easting == West) lon = -lon;
               SendSentenceToAllInstruments(OCPN_DBP_STC_LON, lon, _T("SDMM"));
             }
-            if (mPriSatUsed >= 3) {
+            if (m_Priority.Accept(PG_SAT_USED, 3)) {
               mSatsInUse = m_NMEA0183.Gga.NumberOfSatellitesInUse;
               SendSentenceToAllInstruments( OCPN_DBP_STC_SAT, mSatsInUse, _T (""));
-              mPriSatUsed = 3;
-              mSatsUsed_Wdog = gps_watchdog_timeout_ticks;
+              m_Priority.Won(PG_SAT_USED, 3);
+              FeedWatchdog(WD_SAT_USED);
             }
 
-            // if( mPriDateTime >= 4 ) {
+            // if( m_Priority.Accept(PG_DATETIME, 4) ) {
             //    // Not in use, we need the date too.
-            //    //mPriDateTime = 4;
+            //    //m_Priority.Won(PG_DATETIME, 4);
             //    //mUTCDateTime.ParseFormat( m_NMEA0183.Gga.UTCTime.c_str(),
             //    _T("%H%M%S") );
             //}
@@ -1291,7 +1913,7 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
       return;
     }
     if (m_NMEA0183.LastSentenceIDReceived == _T("GLL")) {
-      if (mPriPosition >= 3) {
+      if (m_Priority.Accept(PG_POSITION, 3)) {
         if (m_NMEA0183.Parse()) {
           if (m_NMEA0183.Gll.IsDataValid == NTrue) {
             double lat, lon;
@@ -1311,12 +1933,12 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
             if (m_NMEA0183.Gll.Position.Longitude.Easting == West) lon = -lon;
             SendSentenceToAllInstruments(OCPN_DBP_STC_LON, lon, _T("SDMM"));
             return;
-            mPriPosition = 3;
+            m_Priority.Won(PG_POSITION, 3);
           }
 
-          // if( mPriDateTime >= 5 ) {
+          // if( m_Priority.Accept(PG_DATETIME, 5) ) {
           //    // Not in use, we need the date too.
-          //    //mPriDateTime = 5;
+          //    //m_Priority.Won(PG_DATETIME, 5);
           //    //mUTCDateTime.ParseFormat( m_NMEA0183.Gll.UTCTime.c_str(),
           //    _T("%H%M%S") );
           //}
@@ -1324,41 +1946,41 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
       }
     }
     if (m_NMEA0183.LastSentenceIDReceived == _T("GSV")) {
-      if (mPriSatStatus >= 3 || mPriSatUsed >= 5) {
+      if (m_Priority.Accept(PG_SAT_STATUS, 3) || m_Priority.Accept(PG_SAT_USED, 5)) {
         if (m_NMEA0183.Parse()) {
           if (m_NMEA0183.Gsv.MessageNumber == 1) {
             // NMEA0183 recommend to not repeat SatsInView
             // in subsequent messages
             mSatsInView = m_NMEA0183.Gsv.SatsInView;
 
-            if (mPriSatUsed >= 5) {
+            if (m_Priority.Accept(PG_SAT_USED, 5)) {
               SendSentenceToAllInstruments(OCPN_DBP_STC_SAT,
                                            m_NMEA0183.Gsv.SatsInView, _T (""));
-              mPriSatUsed = 5;
-              mSatsUsed_Wdog = gps_watchdog_timeout_ticks;
+              m_Priority.Won(PG_SAT_USED, 5);
+              FeedWatchdog(WD_SAT_USED);
             }
           }
 
-          if (mPriSatStatus >= 3) {
+          if (m_Priority.Accept(PG_SAT_STATUS, 3)) {
             SendSatInfoToAllInstruments(
                 mSatsInView, m_NMEA0183.Gsv.MessageNumber,
                 m_NMEA0183.TalkerID, m_NMEA0183.Gsv.SatInfo);
-            mPriSatStatus = 3;
-            mSatStatus_Wdog = gps_watchdog_timeout_ticks;
+            m_Priority.Won(PG_SAT_STATUS, 3);
+            FeedWatchdog(WD_SAT_STATUS);
           }
         }
         return;
       }
     }if (m_NMEA0183.LastSentenceIDReceived == _T("HDG")) {
-      if (mPriVar >= 3 || mPriHeadingM >= 3 || mPriHeadingT >= 7) {
+      if (m_Priority.Accept(PG_VAR, 3) || m_Priority.Accept(PG_HEADING_M, 3) || m_Priority.Accept(PG_HEADING_T, 7)) {
         if (m_NMEA0183.Parse()) {
-          if (mPriVar >= 3) {
+          if (m_Priority.Accept(PG_VAR, 3)) {
             // Any device sending VAR=0.0 can be assumed to not really know
             // what the actual variation is, so in this case we use WMM if
             // available
             if ((!std::isnan(m_NMEA0183.Hdg.MagneticVariationDegrees)) &&
                 0.0 != m_NMEA0183.Hdg.MagneticVariationDegrees) {
-              mPriVar = 3;
+              m_Priority.Won(PG_VAR, 3);
               if (m_NMEA0183.Hdg.MagneticVariationDirection == East)
                 mVar = m_NMEA0183.Hdg.MagneticVariationDegrees;
               else if (m_NMEA0183.Hdg.MagneticVariationDirection == West)
@@ -1367,22 +1989,22 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                                            _T("\u00B0"));
             }
           }
-          if (mPriHeadingM >= 3) {
+          if (m_Priority.Accept(PG_HEADING_M, 3)) {
             if (!std::isnan(m_NMEA0183.Hdg.MagneticSensorHeadingDegrees)) {
-              mPriHeadingM = 3;
+              m_Priority.Won(PG_HEADING_M, 3);
               mHdm = m_NMEA0183.Hdg.MagneticSensorHeadingDegrees;
               SendSentenceToAllInstruments(OCPN_DBP_STC_HDM, mHdm,
                                            _T("\u00B0"));
             }
           }
           if (!std::isnan(m_NMEA0183.Hdg.MagneticSensorHeadingDegrees))
-            mHDx_Watchdog = gps_watchdog_timeout_ticks;
+            FeedWatchdog(WD_HDM);
 
           //      If Variation is available, no higher priority HDT is
           //      available, then calculate and propagate calculated HDT
           if (!std::isnan(m_NMEA0183.Hdg.MagneticSensorHeadingDegrees)) {
-            if (!std::isnan(mVar) && (mPriHeadingT >= 7)) {
-              mPriHeadingT = 7;
+            if (!std::isnan(mVar) && (m_Priority.Accept(PG_HEADING_T, 7))) {
+              m_Priority.Won(PG_HEADING_T, 7);
               double heading = mHdm + mVar;
               if (heading < 0)
                 heading += 360;
@@ -1390,7 +2012,7 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                 heading -= 360;
               SendSentenceToAllInstruments(OCPN_DBP_STC_HDT, heading,
                                            _T("\u00B0"));
-              mHDT_Watchdog = gps_watchdog_timeout_ticks;
+              FeedWatchdog(WD_HDT);
             }
           }
         }
@@ -1398,23 +2020,23 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
       }
     }
     if (m_NMEA0183.LastSentenceIDReceived == _T("HDM")) {
-      if (mPriHeadingM >= 4 || mPriHeadingT >= 5) {
+      if (m_Priority.Accept(PG_HEADING_M, 4) || m_Priority.Accept(PG_HEADING_T, 5)) {
         if (m_NMEA0183.Parse()) {
-          if (mPriHeadingM >= 4) {
+          if (m_Priority.Accept(PG_HEADING_M, 4)) {
             if (!std::isnan(m_NMEA0183.Hdm.DegreesMagnetic)) {
-              mPriHeadingM = 4;
+              m_Priority.Won(PG_HEADING_M, 4);
               mHdm = m_NMEA0183.Hdm.DegreesMagnetic;
               SendSentenceToAllInstruments(OCPN_DBP_STC_HDM, mHdm,
                                            _T("\u00B0M"));
-              mHDx_Watchdog = gps_watchdog_timeout_ticks;
+              FeedWatchdog(WD_HDM);
             }
           }
 
           //      If Variation is available, no higher priority HDT is
           //      available, then calculate and propagate calculated HDT
           if (!std::isnan(m_NMEA0183.Hdm.DegreesMagnetic)) {
-            if (!std::isnan(mVar) && (mPriHeadingT >= 5)) {
-              mPriHeadingT = 5;
+            if (!std::isnan(mVar) && (m_Priority.Accept(PG_HEADING_T, 5))) {
+              m_Priority.Won(PG_HEADING_T, 5);
               double heading = mHdm + mVar;
               if (heading < 0)
                 heading += 360;
@@ -1422,7 +2044,7 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                 heading -= 360;
               SendSentenceToAllInstruments(OCPN_DBP_STC_HDT, heading,
                                            _T("\u00B0"));
-              mHDT_Watchdog = gps_watchdog_timeout_ticks;
+              FeedWatchdog(WD_HDT);
             }
           }
         }
@@ -1430,13 +2052,13 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
       }
     }
     if (m_NMEA0183.LastSentenceIDReceived == _T("HDT")) {
-      if (mPriHeadingT >= 3) {
+      if (m_Priority.Accept(PG_HEADING_T, 3)) {
         if (m_NMEA0183.Parse()) {
           if (!std::isnan(m_NMEA0183.Hdt.DegreesTrue)) {
             SendSentenceToAllInstruments(
                 OCPN_DBP_STC_HDT, m_NMEA0183.Hdt.DegreesTrue, _T("\u00B0T"));
-            mPriHeadingT = 3;
-            mHDT_Watchdog = gps_watchdog_timeout_ticks;
+            m_Priority.Won(PG_HEADING_T, 3);
+            FeedWatchdog(WD_HDT);
             return;
           }
         }
@@ -1444,20 +2066,20 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
     }
     if (m_NMEA0183.LastSentenceIDReceived ==
                _T("MTA")) {  // Air temperature
-      if (mPriATMP >= 3) {
+      if (m_Priority.Accept(PG_ATMP, 3)) {
         if (m_NMEA0183.Parse()) {
-          mPriATMP = 3;
+          m_Priority.Won(PG_ATMP, 3);
           SendSentenceToAllInstruments(
               OCPN_DBP_STC_ATMP,
               toUsrTemp_Plugin(m_NMEA0183.Mta.Temperature, g_iDashTempUnit),
               getUsrTempUnit_Plugin(g_iDashTempUnit));
-          mATMP_Watchdog = gps_watchdog_timeout_ticks;
+          FeedWatchdog(WD_ATMP);
           return;
         }
       }
     }
     if (m_NMEA0183.LastSentenceIDReceived == _T("MDA") &&
-           (mPriMDA >= 5 || mPriATMP >= 5 || mPriHUM >= 4)) {
+           (m_Priority.Accept(PG_MDA, 5) || m_Priority.Accept(PG_ATMP, 5) || m_Priority.Accept(PG_HUM, 4))) {
         //    Barometric pressure  || HUmidity || Air temp) {  // Barometric pressure
       if (m_NMEA0183.Parse()) {
         // TODO make posibilyti to select between Bar or InchHg
@@ -1465,44 +2087,44 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
          double   m_NMEA0183.Mda.Pressure;
          wxString m_NMEA0183.Mda.UnitOfMeasurement;
          */
-          if (mPriMDA >= 5 && m_NMEA0183.Mda.Pressure > .8 &&
+          if (m_Priority.Accept(PG_MDA, 5) && m_NMEA0183.Mda.Pressure > .8 &&
               m_NMEA0183.Mda.Pressure < 1.1) {
               SendSentenceToAllInstruments(OCPN_DBP_STC_MDA,
                   m_NMEA0183.Mda.Pressure * 1000, _T("hPa"));
-              mPriMDA = 5;
-          mMDA_Watchdog = no_nav_watchdog_timeout_ticks;
+              m_Priority.Won(PG_MDA, 5);
+          FeedWatchdog(WD_MDA);
         }
-        if (mPriATMP >= 5) {
+        if (m_Priority.Accept(PG_ATMP, 5)) {
           double airtemp = m_NMEA0183.Mda.AirTemp;
           if (!std::isnan(airtemp) && airtemp < 999.0) {
             SendSentenceToAllInstruments(
               OCPN_DBP_STC_ATMP,
               toUsrTemp_Plugin(airtemp, g_iDashTempUnit),
               getUsrTempUnit_Plugin(g_iDashTempUnit));
-            mATMP_Watchdog = no_nav_watchdog_timeout_ticks;
-            mPriATMP = 5;
+            FeedWatchdog(WD_ATMP);
+            m_Priority.Won(PG_ATMP, 5);
           }
         }
-        if (mPriHUM >= 4) {
+        if (m_Priority.Accept(PG_HUM, 4)) {
             double humidity = m_NMEA0183.Mda.Humidity;
             if (!std::isnan(humidity)) {
                 SendSentenceToAllInstruments(OCPN_DBP_STC_HUM, humidity, "%");
-                mHUM_Watchdog = no_nav_watchdog_timeout_ticks;
-                mPriHUM = 4;
+                FeedWatchdog(WD_HUM);
+                m_Priority.Won(PG_HUM, 4);
             }
         }
       }
       return;
     }
     if (m_NMEA0183.LastSentenceIDReceived == _T("MTW")) {
-      if (mPriWTP >= 4) {
+      if (m_Priority.Accept(PG_WTP, 4)) {
         if (m_NMEA0183.Parse()) {
-          mPriWTP = 4;
+          m_Priority.Won(PG_WTP, 4);
           SendSentenceToAllInstruments(
               OCPN_DBP_STC_TMP,
               toUsrTemp_Plugin(m_NMEA0183.Mtw.Temperature, g_iDashTempUnit),
               getUsrTempUnit_Plugin(g_iDashTempUnit));
-          mWTP_Watchdog = no_nav_watchdog_timeout_ticks;
+          FeedWatchdog(WD_WTP);
           return;
         }
       }
@@ -1518,20 +2140,20 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
             toUsrDistance_Plugin(m_NMEA0183.Vlw.TripMileage,
                                  g_iDashDistanceUnit),
             getUsrDistanceUnit_Plugin(g_iDashDistanceUnit));
-        mTrLOG_Watchdog = no_nav_watchdog_timeout_ticks;
+        FeedWatchdog(WD_TRLOG);
 
         SendSentenceToAllInstruments(
             OCPN_DBP_STC_VLW2,
             toUsrDistance_Plugin(m_NMEA0183.Vlw.TotalMileage,
                                  g_iDashDistanceUnit),
             getUsrDistanceUnit_Plugin(g_iDashDistanceUnit));
-        mLOG_Watchdog = no_nav_watchdog_timeout_ticks;
+        FeedWatchdog(WD_LOG);
         return;
       }
     }
     // NMEA 0183 standard Wind Direction and Speed, with respect to north.
     if (m_NMEA0183.LastSentenceIDReceived == _T("MWD")) {
-      if (mPriWDN >= 6) {
+      if (m_Priority.Accept(PG_WDN, 6)) {
         if (m_NMEA0183.Parse()) {
           // Option for True vs Magnetic
           wxString windunit;
@@ -1539,9 +2161,9 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
               // if WindAngleTrue is available, use it ...
               SendSentenceToAllInstruments(OCPN_DBP_STC_TWD,
                   m_NMEA0183.Mwd.WindAngleTrue, _T("\u00B0"));
-              mPriWDN = 6;
+              m_Priority.Won(PG_WDN, 6);
             // MWD can be seldom updated by the sensor. Set prolonged watchdog
-            mWDN_Watchdog = no_nav_watchdog_timeout_ticks;
+            FeedWatchdog(WD_WDN);
           } else if (!std::isnan(m_NMEA0183.Mwd.WindAngleMagnetic)) {
             // Make it true and use if variation is available
               if (!std::isnan(mVar)) {
@@ -1555,8 +2177,8 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                   }
                   SendSentenceToAllInstruments(OCPN_DBP_STC_TWD, twd,
                       _T("\u00B0"));
-                  mPriWDN = 6;
-                  mWDN_Watchdog = no_nav_watchdog_timeout_ticks;
+                  m_Priority.Won(PG_WDN, 6);
+                  FeedWatchdog(WD_WDN);
               }
           }
           SendSentenceToAllInstruments(
@@ -1569,7 +2191,7 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
               toUsrSpeed_Plugin(m_NMEA0183.Mwd.WindSpeedKnots,
                                 g_iDashWindSpeedUnit),
               getUsrSpeedUnit_Plugin(g_iDashWindSpeedUnit));
-          mMWVT_Watchdog = gps_watchdog_timeout_ticks;
+          FeedWatchdog(WD_MWVT);
           // m_NMEA0183.Mwd.WindSpeedms
         }
         return;
@@ -1578,7 +2200,7 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
     // NMEA 0183 standard Wind Speed and Angle, in relation to the vessel's
     // bow/centerline.
     if (m_NMEA0183.LastSentenceIDReceived == _T("MWV")) {
-      if (mPriAWA >= 4 || mPriTWA >= 5 || mPriWDN >= 5) {
+      if (m_Priority.Accept(PG_AWA, 4) || m_Priority.Accept(PG_TWA, 5) || m_Priority.Accept(PG_WDN, 5)) {
         if (m_NMEA0183.Parse()) {
           if (m_NMEA0183.Mwv.IsDataValid == NTrue) {
             // MWV windspeed has different units. Form it to knots to fit
@@ -1592,8 +2214,8 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
             if (m_NMEA0183.Mwv.Reference ==
                 _T("R"))  // Relative (apparent wind)
             {
-              if (mPriAWA >= 4) {
-                mPriAWA = 4;
+              if (m_Priority.Accept(PG_AWA, 4)) {
+                m_Priority.Won(PG_AWA, 4);
                 wxString m_awaunit;
                 double m_awaangle;
                 if (m_NMEA0183.Mwv.WindAngle > 180) {
@@ -1610,26 +2232,26 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                     toUsrSpeed_Plugin(m_NMEA0183.Mwv.WindSpeed * m_wSpeedFactor,
                                       g_iDashWindSpeedUnit),
                     getUsrSpeedUnit_Plugin(g_iDashWindSpeedUnit));
-                mMWVA_Watchdog = gps_watchdog_timeout_ticks;
+                FeedWatchdog(WD_MWVA);
               }
 
               // If we have true HDT, COG, and SOG
               // then using simple vector math, we can calculate true wind
               // direction and speed. If there is no higher priority source for
               // WDN, then do so here, and update the appropriate instruments.
-              if (mPriWDN >= 8) {
+              if (m_Priority.Accept(PG_WDN, 8)) {
                 CalculateAndUpdateTWDS(
                     m_NMEA0183.Mwv.WindSpeed * m_wSpeedFactor,
                     m_NMEA0183.Mwv.WindAngle);
-                mPriWDN = 8;
-                mWDN_Watchdog = no_nav_watchdog_timeout_ticks;
-                mMWVT_Watchdog = gps_watchdog_timeout_ticks;
+                m_Priority.Won(PG_WDN, 8);
+                FeedWatchdog(WD_WDN);
+                FeedWatchdog(WD_MWVT);
               }
             } else if (m_NMEA0183.Mwv.Reference ==
                        _T("T"))  // Theoretical (aka True)
             {
-              if (mPriTWA >= 4) {
-                mPriTWA = 4;
+              if (m_Priority.Accept(PG_TWA, 4)) {
+                m_Priority.Won(PG_TWA, 4);
                 wxString m_twaunit;
                 double m_twaangle;
                 bool b_R = false;
@@ -1644,22 +2266,19 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                 SendSentenceToAllInstruments(OCPN_DBP_STC_TWA, m_twaangle,
                                              m_twaunit);
 
-                if (mPriWDN >= 7) {
+                if (m_Priority.Accept(PG_WDN, 7)) {
                   // MWV has wind angle relative to the bow.
                   // Wind history use angle relative to north.
                   // If no TWD with higher priority is present
                   // and true heading is available calculate it.
-                  if (g_dHDT < 361. && g_dHDT >= 0.0) {
-                    double g_dCalWdir = (m_NMEA0183.Mwv.WindAngle) + g_dHDT;
-                    if (g_dCalWdir > 360.) {
-                      g_dCalWdir -= 360;
-                    } else if (g_dCalWdir < 0.) {
-                      g_dCalWdir += 360;
-                    }
-                    SendSentenceToAllInstruments(OCPN_DBP_STC_TWD, g_dCalWdir,
+                  m_Derived.Set(DD_TWA, m_NMEA0183.Mwv.WindAngle);
+                  if (m_Derived.Take(DD_OUT_TWD_MEASURED) &&
+                      !std::isnan(m_Derived.GetTwdMeasured())) {
+                    SendSentenceToAllInstruments(OCPN_DBP_STC_TWD,
+                                                 m_Derived.GetTwdMeasured(),
                                                  _T("\u00B0"));
-                    mPriWDN = 7;
-                    mWDN_Watchdog = no_nav_watchdog_timeout_ticks;
+                    m_Priority.Won(PG_WDN, 7);
+                    FeedWatchdog(WD_WDN);
                   }
                 }
 
@@ -1673,7 +2292,7 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                     toUsrSpeed_Plugin(m_NMEA0183.Mwv.WindSpeed * m_wSpeedFactor,
                                       g_iDashWindSpeedUnit),
                     getUsrSpeedUnit_Plugin(g_iDashWindSpeedUnit));
-                mMWVT_Watchdog = gps_watchdog_timeout_ticks;
+                FeedWatchdog(WD_MWVT);
               }
             }
           }
@@ -1682,12 +2301,12 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
       }
     }
     if (m_NMEA0183.LastSentenceIDReceived == _T("RMC")) {
-      if (mPriPosition >= 5 || mPriCOGSOG >= 3 || mPriVar >= 4 ||
-          mPriDateTime >= 3) {
+      if (m_Priority.Accept(PG_POSITION, 5) || m_Priority.Accept(PG_COGSOG, 3) || m_Priority.Accept(PG_VAR, 4) ||
+          m_Priority.Accept(PG_DATETIME, 3)) {
         if (m_NMEA0183.Parse()) {
           if (m_NMEA0183.Rmc.IsDataValid == NTrue) {
-            if (mPriPosition >= 5) {
-              mPriPosition = 5;
+            if (m_Priority.Accept(PG_POSITION, 5)) {
+              m_Priority.Won(PG_POSITION, 5);
               double lat, lon;
               float llt = m_NMEA0183.Rmc.Position.Latitude.Latitude;
               int lat_deg_int = (int)(llt / 100);
@@ -1707,8 +2326,8 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
               SendSentenceToAllInstruments(OCPN_DBP_STC_LON, lon, _T("SDMM"));
             }
 
-            if (mPriCOGSOG >= 3) {
-              mPriCOGSOG = 3;
+            if (m_Priority.Accept(PG_COGSOG, 3)) {
+              m_Priority.Won(PG_COGSOG, 3);
               if (!std::isnan(m_NMEA0183.Rmc.SpeedOverGroundKnots)) {
                 SendSentenceToAllInstruments(
                     OCPN_DBP_STC_SOG,
@@ -1724,46 +2343,31 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                     mCOGFilter.filter(m_NMEA0183.Rmc.TrackMadeGoodDegreesTrue),
                     _T("\u00B0"));
               }
-              if (!std::isnan(m_NMEA0183.Rmc.TrackMadeGoodDegreesTrue) &&
-                  !std::isnan(m_NMEA0183.Rmc.MagneticVariation)) {
-                double dMagneticCOG;
-                if (m_NMEA0183.Rmc.MagneticVariationDirection == East) {
-                  dMagneticCOG =
-                      mCOGFilter.get() - m_NMEA0183.Rmc.MagneticVariation;
-                  if (dMagneticCOG < 0.0) dMagneticCOG = 360.0 + dMagneticCOG;
-                } else {
-                  dMagneticCOG =
-                      mCOGFilter.get() + m_NMEA0183.Rmc.MagneticVariation;
-                  if (dMagneticCOG > 360.0) dMagneticCOG = dMagneticCOG - 360.0;
-                }
-                SendSentenceToAllInstruments(OCPN_DBP_STC_MCOG, dMagneticCOG,
-                                             _T("\u00B0M"));
-              }
             }
 
-            if (mPriVar >= 4) {
+            if (m_Priority.Accept(PG_VAR, 4)) {
               // Any device sending VAR=0.0 can be assumed to not really know
               // what the actual variation is, so in this case we use WMM if
               // available
               if ((!std::isnan(m_NMEA0183.Rmc.MagneticVariation)) &&
                   0.0 != m_NMEA0183.Rmc.MagneticVariation) {
-                mPriVar = 4;
+                m_Priority.Won(PG_VAR, 4);
                 if (m_NMEA0183.Rmc.MagneticVariationDirection == East)
                   mVar = m_NMEA0183.Rmc.MagneticVariation;
                 else if (m_NMEA0183.Rmc.MagneticVariationDirection == West)
                   mVar = -m_NMEA0183.Rmc.MagneticVariation;
-                mVar_Watchdog = gps_watchdog_timeout_ticks;
+                FeedWatchdog(WD_VAR);
 
                 SendSentenceToAllInstruments(OCPN_DBP_STC_HMV, mVar,
                                              _T("\u00B0"));
               }
             }
 
-            if (mPriDateTime >= 3) {
-              mPriDateTime = 3;
+            if (m_Priority.Accept(PG_DATETIME, 3)) {
+              m_Priority.Won(PG_DATETIME, 3);
               wxString dt = m_NMEA0183.Rmc.Date + m_NMEA0183.Rmc.UTCTime;
               mUTCDateTime.ParseFormat(dt.c_str(), _T("%d%m%y%H%M%S"));
-              mUTC_Watchdog = gps_watchdog_timeout_ticks;
+              FeedWatchdog(WD_UTC);
             }
           }
         }
@@ -1771,7 +2375,7 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
       }
     }
     if (m_NMEA0183.LastSentenceIDReceived == _T("RSA")) {
-      if (mPriRSA >= 3) {
+      if (m_Priority.Accept(PG_RSA, 3)) {
         if (m_NMEA0183.Parse()) {
           if (m_NMEA0183.Rsa.IsStarboardDataValid == NTrue) {
             SendSentenceToAllInstruments(OCPN_DBP_STC_RSA,
@@ -1781,40 +2385,40 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
             SendSentenceToAllInstruments(OCPN_DBP_STC_RSA, -m_NMEA0183.Rsa.Port,
                                          _T("\u00B0"));
           }
-          mRSA_Watchdog = gps_watchdog_timeout_ticks;
-          mPriRSA = 3;
+          FeedWatchdog(WD_RSA);
+          m_Priority.Won(PG_RSA, 3);
           return;
         }
       }
     }
     if (m_NMEA0183.LastSentenceIDReceived == _T("VHW")) {
-      if (mPriHeadingT >= 4 || mPriHeadingM >= 5 || mPriSTW >= 3) {
+      if (m_Priority.Accept(PG_HEADING_T, 4) || m_Priority.Accept(PG_HEADING_M, 5) || m_Priority.Accept(PG_STW, 3)) {
         if (m_NMEA0183.Parse()) {
-          if (mPriHeadingT >= 4) {
+          if (m_Priority.Accept(PG_HEADING_T, 4)) {
             if (!std::isnan(m_NMEA0183.Vhw.DegreesTrue)) {
-              mPriHeadingT = 4;
+              m_Priority.Won(PG_HEADING_T, 4);
               SendSentenceToAllInstruments(
                   OCPN_DBP_STC_HDT, m_NMEA0183.Vhw.DegreesTrue, _T("\u00B0T"));
-              mHDT_Watchdog = gps_watchdog_timeout_ticks;
+              FeedWatchdog(WD_HDT);
             }
           }
-          if (mPriHeadingM >= 5) {
+          if (m_Priority.Accept(PG_HEADING_M, 5)) {
             if (!std::isnan(m_NMEA0183.Vhw.DegreesMagnetic)) {
-              mPriHeadingM = 5;
+              m_Priority.Won(PG_HEADING_M, 5);
               SendSentenceToAllInstruments(OCPN_DBP_STC_HDM,
                                            m_NMEA0183.Vhw.DegreesMagnetic,
                                            _T("\u00B0M"));
-              mHDx_Watchdog = gps_watchdog_timeout_ticks;
+              FeedWatchdog(WD_HDM);
             }
           }
           if (!std::isnan(m_NMEA0183.Vhw.Knots)) {
-            if (mPriSTW >= 3) {
-              mPriSTW = 3;
+            if (m_Priority.Accept(PG_STW, 3)) {
+              m_Priority.Won(PG_STW, 3);
               SendSentenceToAllInstruments(
                   OCPN_DBP_STC_STW,
                   toUsrSpeed_Plugin(m_NMEA0183.Vhw.Knots, g_iDashSpeedUnit),
                   getUsrSpeedUnit_Plugin(g_iDashSpeedUnit));
-              mSTW_Watchdog = gps_watchdog_timeout_ticks;
+              FeedWatchdog(WD_STW);
             }
           }
         }
@@ -1822,9 +2426,9 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
       }
     }
     if (m_NMEA0183.LastSentenceIDReceived == _T("VTG")) {
-      if (mPriCOGSOG >= 2) {
+      if (m_Priority.Accept(PG_COGSOG, 2)) {
         if (m_NMEA0183.Parse()) {
-          mPriCOGSOG = 2;
+          m_Priority.Won(PG_COGSOG, 2);
           //    Special check for unintialized values, as opposed to zero values
           if (!std::isnan(m_NMEA0183.Vtg.SpeedKnots)) {
             SendSentenceToAllInstruments(
@@ -1852,10 +2456,10 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
      * to the vessel's heading, and wind speed measured relative to the moving
      * vessel. */
     if (m_NMEA0183.LastSentenceIDReceived == _T("VWR")) {
-      if (mPriAWA >= 3) {
+      if (m_Priority.Accept(PG_AWA, 3)) {
         if (m_NMEA0183.Parse()) {
           if (m_NMEA0183.Vwr.WindDirectionMagnitude < 200) {
-            mPriAWA = 3;
+            m_Priority.Won(PG_AWA, 3);
 
             wxString awaunit;
             awaunit = m_NMEA0183.Vwr.DirectionOfWind == Left ? _T("\u00B0L")
@@ -1868,7 +2472,7 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                 toUsrSpeed_Plugin(m_NMEA0183.Vwr.WindSpeedKnots,
                                   g_iDashWindSpeedUnit),
                 getUsrSpeedUnit_Plugin(g_iDashWindSpeedUnit));
-            mMWVA_Watchdog = gps_watchdog_timeout_ticks;
+            FeedWatchdog(WD_MWVA);
             /*
                 double m_NMEA0183.Vwr.WindSpeedms;
                 double m_NMEA0183.Vwr.WindSpeedKmh;
@@ -1879,14 +2483,14 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
           // then using simple vector math, we can calculate true wind direction
           // and speed. If there is no higher priority source for WDN, then do
           // so here, and update the appropriate instruments.
-          if (mPriWDN >= 9) {
+          if (m_Priority.Accept(PG_WDN, 9)) {
             double awa = m_NMEA0183.Vwr.WindDirectionMagnitude;
             if (m_NMEA0183.Vwr.DirectionOfWind == Left)
               awa = 360. - m_NMEA0183.Vwr.WindDirectionMagnitude;
             CalculateAndUpdateTWDS(m_NMEA0183.Vwr.WindSpeedKnots, awa);
-            mPriWDN = 9;
-            mMWVT_Watchdog = gps_watchdog_timeout_ticks;
-            mWDN_Watchdog = no_nav_watchdog_timeout_ticks;
+            m_Priority.Won(PG_WDN, 9);
+            FeedWatchdog(WD_MWVT);
+            FeedWatchdog(WD_WDN);
           }
         }
         return;
@@ -1899,10 +2503,10 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
      * at the vessel if it were
      * stationary relative to the water and heading in the same direction. */
     if (m_NMEA0183.LastSentenceIDReceived == _T("VWT")) {
-      if (mPriTWA >= 4) {
+      if (m_Priority.Accept(PG_TWA, 4)) {
         if (m_NMEA0183.Parse()) {
           if (m_NMEA0183.Vwt.WindDirectionMagnitude < 200) {
-            mPriTWA = 4;
+            m_Priority.Won(PG_TWA, 4);
             wxString vwtunit;
             vwtunit = m_NMEA0183.Vwt.DirectionOfWind == Left ? _T("\u00B0L")
                                                              : _T("\u00B0R");
@@ -1914,7 +2518,7 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                 toUsrSpeed_Plugin(m_NMEA0183.Vwt.WindSpeedKnots,
                                   g_iDashWindSpeedUnit),
                 getUsrSpeedUnit_Plugin(g_iDashWindSpeedUnit));
-            mMWVT_Watchdog = gps_watchdog_timeout_ticks;
+            FeedWatchdog(WD_MWVT);
             /*
              double           m_NMEA0183.Vwt.WindSpeedms;
              double           m_NMEA0183.Vwt.WindSpeedKmh;
@@ -1959,7 +2563,7 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
           if (m_NMEA0183.Xdr.TransducerInfo[i].TransducerType == _T("T")) {
               if (m_NMEA0183.Xdr.TransducerInfo[i].UnitOfMeasurement == _T("R")) {
                   // Update Watchdog timer
-                  engineWatchDog = wxDateTime::Now();
+                  FeedWatchdog(WD_ENGINE);
                   // Set the units
                   xdrunit = _T("RPM");                  
                   // TwoCan plugin transducer names
@@ -2006,12 +2610,12 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                   _T("ENV_OUTAIR_T") ||
                 m_NMEA0183.Xdr.TransducerInfo[i].TransducerName ==
                 _T("ENV_OUTSIDE_T")) {
-                if (mPriATMP >= 4) {
-                    mPriATMP = 4;
+                if (m_Priority.Accept(PG_ATMP, 4)) {
+                    m_Priority.Won(PG_ATMP, 4);
                     SendSentenceToAllInstruments(
                         OCPN_DBP_STC_ATMP, toUsrTemp_Plugin(xdrdata, g_iDashTempUnit),
                         getUsrTempUnit_Plugin(g_iDashTempUnit));
-                    mATMP_Watchdog = no_nav_watchdog_timeout_ticks;
+                    FeedWatchdog(WD_ATMP);
                     continue;
                 }
             }  // Water temp
@@ -2019,21 +2623,21 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                 .Contains("WATER") ||
                 m_NMEA0183.Xdr.TransducerInfo[i].TransducerName ==
                 "WTHI") {
-                if (mPriWTP >= 3) {
-                    mPriWTP = 3;
+                if (m_Priority.Accept(PG_WTP, 3)) {
+                    m_Priority.Won(PG_WTP, 3);
                     SendSentenceToAllInstruments(
                         OCPN_DBP_STC_TMP,
                         toUsrTemp_Plugin(
                             m_NMEA0183.Xdr.TransducerInfo[i].MeasurementData,
                             g_iDashTempUnit),
                         getUsrTempUnit_Plugin(g_iDashTempUnit));
-                    mWTP_Watchdog = no_nav_watchdog_timeout_ticks;
+                    FeedWatchdog(WD_WTP);
                     continue;
                 }
             }
             // Engine
             if (m_NMEA0183.Xdr.TransducerInfo[i].UnitOfMeasurement == _T("C")) {
-                engineWatchDogDynamic = wxDateTime::Now();
+                FeedWatchdog(WD_ENGINE_DYNAMIC);
                 if (g_iDashTemperatureUnit == TEMPERATURE_CELSIUS) {
                     xdrunit = _T("\u00B0 C");
                     // TwoCan transducer naming
@@ -2126,11 +2730,11 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
             }
           } // Humidity
           if (m_NMEA0183.Xdr.TransducerInfo[i].TransducerType == "H") {
-              if (mPriHUM >= 3) {
+              if (m_Priority.Accept(PG_HUM, 3)) {
                   if (m_NMEA0183.Xdr.TransducerInfo[i].UnitOfMeasurement == "P") {
                       SendSentenceToAllInstruments(OCPN_DBP_STC_HUM, xdrdata, "%");
-                      mPriHUM = 3;
-                      mHUM_Watchdog = no_nav_watchdog_timeout_ticks;
+                      m_Priority.Won(PG_HUM, 3);
+                      FeedWatchdog(WD_HUM);
                       continue;
                   }
               }
@@ -2141,13 +2745,13 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
               xdrdata *= 1000;
               SendSentenceToAllInstruments(OCPN_DBP_STC_MDA, xdrdata,
                                            _T("hPa"));
-              mPriMDA = 4;
-              mMDA_Watchdog = no_nav_watchdog_timeout_ticks;
+              m_Priority.Won(PG_MDA, 4);
+              FeedWatchdog(WD_MDA);
               continue;
             }
             // Engine
             if (m_NMEA0183.Xdr.TransducerInfo[i].UnitOfMeasurement == _T("P")) {
-                engineWatchDogDynamic = wxDateTime::Now();
+                FeedWatchdog(WD_ENGINE_DYNAMIC);
                 if (g_iDashPressureUnit == PRESSURE_BAR) {
                     xdrunit = _T("Bar");
                     // TwoCan Transducer naming
@@ -2224,7 +2828,7 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                 Contains(_T("PTCH")) ||
                 m_NMEA0183.Xdr.TransducerInfo[i].TransducerName.
                 Contains(_T("PITCH"))) {
-              if (mPriPitchRoll >= 3) {
+              if (m_Priority.Accept(PG_PITCH_ROLL, 3)) {
                 if (m_NMEA0183.Xdr.TransducerInfo[i].MeasurementData > 0) {
                   xdrunit = _T("\u00B0\u2191") + _("Up");
                 }
@@ -2237,15 +2841,15 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                 }
                 SendSentenceToAllInstruments(OCPN_DBP_STC_PITCH, xdrdata,
                                              xdrunit);
-                mPITCH_Watchdog = gps_watchdog_timeout_ticks;
-                mPriPitchRoll = 3;
+                FeedWatchdog(WD_PITCH);
+                m_Priority.Won(PG_PITCH_ROLL, 3);
                 continue;
               }
             }
             // XDR Heel
             if (m_NMEA0183.Xdr.TransducerInfo[i].TransducerName.
                      Contains(_T("ROLL"))) {
-              if (mPriPitchRoll >= 3) {
+              if (m_Priority.Accept(PG_PITCH_ROLL, 3)) {
                 if (m_NMEA0183.Xdr.TransducerInfo[i].MeasurementData > 0) {
                   xdrunit = _T("\u00B0\u003E") + _("Stbd");
                 }
@@ -2257,19 +2861,19 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                   xdrunit = _T("\u00B0");
                 }
                 SendSentenceToAllInstruments(OCPN_DBP_STC_HEEL, xdrdata, xdrunit);
-                mHEEL_Watchdog = gps_watchdog_timeout_ticks;
-                mPriPitchRoll = 3;
+                FeedWatchdog(WD_HEEL);
+                m_Priority.Won(PG_PITCH_ROLL, 3);
                 continue;
               }
             }
             // XDR Rudder Angle
             if (m_NMEA0183.Xdr.TransducerInfo[i].TransducerName ==
                      _T("RUDDER")) {
-              if (mPriRSA > 4) {
+              if (m_Priority.Accept(PG_RSA, 4)) {
                 SendSentenceToAllInstruments(OCPN_DBP_STC_RSA, xdrdata,
                                              _T("\u00B0"));
-                mRSA_Watchdog = gps_watchdog_timeout_ticks;
-                mPriRSA = 4;
+                FeedWatchdog(WD_RSA);
+                m_Priority.Won(PG_RSA, 4);
                 continue;
               }
             }
@@ -2277,15 +2881,15 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
           // Nasa style water temp
           if (m_NMEA0183.Xdr.TransducerInfo[i].TransducerName ==
               _T("ENV_WATER_T")) {
-            if (mPriWTP >= 3) {
-              mPriWTP = 3;
+            if (m_Priority.Accept(PG_WTP, 3)) {
+              m_Priority.Won(PG_WTP, 3);
               SendSentenceToAllInstruments(
                   OCPN_DBP_STC_TMP,
                   toUsrTemp_Plugin(
                       m_NMEA0183.Xdr.TransducerInfo[i].MeasurementData,
                       g_iDashTempUnit),
                   getUsrTempUnit_Plugin(g_iDashTempUnit));
-              mWTP_Watchdog = no_nav_watchdog_timeout_ticks;
+              FeedWatchdog(WD_WTP);
               continue;
             }
           }
@@ -2472,7 +3076,7 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
           if (m_NMEA0183.Xdr.TransducerInfo[i].TransducerType == _T("V")) {
               if (m_NMEA0183.Xdr.TransducerInfo[i].UnitOfMeasurement == _T("P")) {
                   // Update Watchdog Timer
-                  tankLevelWatchDog = wxDateTime::Now();
+                  FeedWatchdog(WD_TANK);
                   xdrunit = _T("Level");
                   // TwoCan Plugin Transducer Names
                   if (m_NMEA0183.Xdr.TransducerInfo[i].TransducerName == _T("FUEL")) {
@@ -2535,7 +3139,7 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
           if (m_NMEA0183.Xdr.TransducerInfo[i].TransducerType == _T("E")) {
               if (m_NMEA0183.Xdr.TransducerInfo[i].UnitOfMeasurement == _T("P")) {
                   // Update Watchdog Timer
-                  tankLevelWatchDog = wxDateTime::Now();
+                  FeedWatchdog(WD_TANK);
                   xdrunit = _T("Level");
                   // NMEA 183 v4.11 Transducer Names
                   if (m_NMEA0183.Xdr.TransducerInfo[i].TransducerName.Upper() == _T("FUEL#0")) {
@@ -2611,9 +3215,9 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
       return;
     }
     if (m_NMEA0183.LastSentenceIDReceived == _T("ZDA")) {
-      if (mPriDateTime >= 2) {
+      if (m_Priority.Accept(PG_DATETIME, 2)) {
         if (m_NMEA0183.Parse()) {
-          mPriDateTime = 2;
+          m_Priority.Won(PG_DATETIME, 2);
           /*
            wxString m_NMEA0183.Zda.UTCTime;
            int      m_NMEA0183.Zda.Day;
@@ -2627,7 +3231,7 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                     m_NMEA0183.Zda.Month, m_NMEA0183.Zda.Day);
           dt.Append(m_NMEA0183.Zda.UTCTime);
           mUTCDateTime.ParseFormat(dt.c_str(), _T("%Y%m%d%H%M%S"));
-          mUTC_Watchdog = gps_watchdog_timeout_ticks;
+          FeedWatchdog(WD_UTC);
         }
         return;
       }
@@ -2638,7 +3242,7 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                 // Only display engine rpm 'E', not shaft rpm 'S'
                 if (m_NMEA0183.Rpm.Source == _T("E")) {
                     // Update Watchdog Timer
-                    engineWatchDog = wxDateTime::Now();
+                    FeedWatchdog(WD_ENGINE);
                     // Engine Numbering: 
                     // 0 = Mid-line, Odd = Starboard, Even = Port (numbered from midline)
                     switch (m_NMEA0183.Rpm.EngineNumber) {
@@ -2679,64 +3283,23 @@ void dashboard_pi::SetNMEASentence(wxString &sentence) {
                                    _T("\u00B0"));
       if (!std::isnan(gpd.Hdt)) {
         SendSentenceToAllInstruments(OCPN_DBP_STC_HDT, gpd.Hdt, _T("\u00B0T"));
-        mHDT_Watchdog = gps_watchdog_timeout_ticks;
+        FeedWatchdog(WD_HDT);
       }
     }
   }
 }
 
 /*      Calculate True Wind speed and direction from AWS and AWA
- *      This algorithm requires HDT, SOG, and COG, which are maintained as
- * globals elsewhere. Also, update all instruments tagged with OCPN_DBP_STC_TWD,
- * OCPN_DBP_STC_TWS, and OCPN_DBP_STC_TWS2
+ *      This algorithm requires HDT, SOG, and COG, which are kept as inputs of
+ * m_Derived by SendSentenceToAllInstruments(). Also, update all instruments
+ * tagged with OCPN_DBP_STC_TWD, OCPN_DBP_STC_TWS, OCPN_DBP_STC_TWS2 and, if no
+ * other source is present, OCPN_DBP_STC_VMGW
  */
 void dashboard_pi::CalculateAndUpdateTWDS(double awsKnots, double awaDegrees) {
-  if (!std::isnan(g_dHDT)) {
-    // Apparent wind velocity vector, relative to head-up
-    double awsx = awsKnots * cos(awaDegrees * PI / 180.);
-    double awsy = awsKnots * sin(awaDegrees * PI / 180.);
-
-    // Ownship velocity vector, relative to head-up
-    double bsx = 0;
-    double bsy = 0;
-    if ((!std::isnan(g_dSOG)) && (!std::isnan(g_dCOG))) {
-      bsx = g_dSOG * cos((g_dCOG - g_dHDT) * PI / 180.);
-      bsy = g_dSOG * sin((g_dCOG - g_dHDT) * PI / 180.);
-      ;
-    }
-
-    // "True" wind is calculated by vector subtraction
-    double twdx = awsx - bsx;
-    double twdy = awsy - bsy;
-
-    // Calculate the speed (magnitude of the vector)
-    double tws = pow(((twdx * twdx) + (twdy * twdy)), 0.5);
-
-    // calculate the True Wind Angle
-    double twd = atan2(twdy, twdx) * 180. / PI;
-    if (twd < 0)
-      SendSentenceToAllInstruments(OCPN_DBP_STC_TWA, -twd, _T("\u00B0L"));
-    else
-      SendSentenceToAllInstruments(OCPN_DBP_STC_TWA, twd, _T("\u00B0R"));
-
-    // Calculate the True Wind Direction, by re-orienting to the ownship HDT
-    double twdc = twd + g_dHDT;
-
-    // Normalize
-    if (twdc < 0) twdc += 360.;
-    if (twdc > 360.) twdc -= 360;
-
-    // Update the instruments
-    // printf("CALC: %4.0f %4.0f\n", tws, twdc);
-    SendSentenceToAllInstruments(OCPN_DBP_STC_TWD, twdc, _T("\u00B0"));
-
-    SendSentenceToAllInstruments(OCPN_DBP_STC_TWS,
-                                 toUsrSpeed_Plugin(tws, g_iDashWindSpeedUnit),
-                                 getUsrSpeedUnit_Plugin(g_iDashWindSpeedUnit));
-    SendSentenceToAllInstruments(OCPN_DBP_STC_TWS2,
-                                 toUsrSpeed_Plugin(tws, g_iDashWindSpeedUnit),
-                                 getUsrSpeedUnit_Plugin(g_iDashWindSpeedUnit));
-  }
+  m_Derived.Set(DD_AWS, awsKnots);
+  m_Derived.Set(DD_AWA, awaDegrees);
+  PublishDerived(DD_OUT_TRUEWIND);
+  PublishDerived(DD_OUT_VMGW);
 }
 
 // NMEA2000, N2K
@@ -2755,8 +3318,8 @@ void dashboard_pi::HandleN2K_127245(ObservedEvt ev) {
   std::string source = GetN2000Source(id_127245, ev);
   source += ":" + ident;
 
-  if (mPriRSA >= 1) {
-    if (mPriRSA == 1) {
+  if (m_Priority.Accept(PG_RSA, 1)) {
+    if (m_Priority.IsActive(PG_RSA, 1)) {
       // We favor first received after last WD
       if (source != prio127245) return;
     }
@@ -2774,8 +3337,8 @@ void dashboard_pi::HandleN2K_127245(ObservedEvt ev) {
       if (!N2kIsNA(RudderPosition)) {
         double m_rudangle = GEODESIC_RAD2DEG(RudderPosition);
         SendSentenceToAllInstruments(OCPN_DBP_STC_RSA, m_rudangle, _T("\u00B0"));
-        mRSA_Watchdog = gps_watchdog_timeout_ticks;
-        mPriRSA = 1;
+        FeedWatchdog(WD_RSA);
+        m_Priority.Won(PG_RSA, 1);
       }
     }
   }
@@ -2794,8 +3357,8 @@ void dashboard_pi::HandleN2K_127257(ObservedEvt ev) {
   std::string source = GetN2000Source(id_127257, ev);
   source += ":" + ident;
 
-  if (mPriPitchRoll >= 1) {
-    if (mPriPitchRoll == 1) {
+  if (m_Priority.Accept(PG_PITCH_ROLL, 1)) {
+    if (m_Priority.IsActive(PG_PITCH_ROLL, 1)) {
       // We favor first received after last WD
       if (source != prio127257) return;
     }
@@ -2817,8 +3380,8 @@ void dashboard_pi::HandleN2K_127257(ObservedEvt ev) {
           m_pitch *= -1;
         }
         SendSentenceToAllInstruments(OCPN_DBP_STC_PITCH, m_pitch, p_unit);
-        mPITCH_Watchdog = gps_watchdog_timeout_ticks;
-        mPriPitchRoll = 1;
+        FeedWatchdog(WD_PITCH);
+        m_Priority.Won(PG_PITCH_ROLL, 1);
       }
       if (!N2kIsNA(Roll)) {
         double m_heel = GEODESIC_RAD2DEG(Roll);
@@ -2828,8 +3391,8 @@ void dashboard_pi::HandleN2K_127257(ObservedEvt ev) {
           m_heel *= -1;
         }
         SendSentenceToAllInstruments(OCPN_DBP_STC_HEEL, m_heel, h_unit);
-        mHEEL_Watchdog = gps_watchdog_timeout_ticks;
-        mPriPitchRoll = 1;
+        FeedWatchdog(WD_HEEL);
+        m_Priority.Won(PG_PITCH_ROLL, 1);
       }
     }
   }
@@ -2847,8 +3410,8 @@ void dashboard_pi::HandleN2K_128267(ObservedEvt ev) {
   std::string source = GetN2000Source(id_128267, ev);
   source += ":" + ident;
 
-  if (mPriDepth >= 1) {
-    if (mPriDepth == 1) {
+  if (m_Priority.Accept(PG_DEPTH, 1)) {
+    if (m_Priority.IsActive(PG_DEPTH, 1)) {
       if (source != prio128267) return;
     }
     else {
@@ -2869,8 +3432,8 @@ void dashboard_pi::HandleN2K_128267(ObservedEvt ev) {
         SendSentenceToAllInstruments(OCPN_DBP_STC_DPT,
           toUsrDistance_Plugin(depth / 1852.0, g_iDashDepthUnit),
           getUsrDistanceUnit_Plugin(g_iDashDepthUnit));
-        mPriDepth = 1;
-        mDPT_DBT_Watchdog = gps_watchdog_timeout_ticks;
+        m_Priority.Won(PG_DEPTH, 1);
+        FeedWatchdog(WD_DPT);
       }
     }
   }
@@ -2892,7 +3455,7 @@ void dashboard_pi::HandleN2K_128275(ObservedEvt ev) {
       SendSentenceToAllInstruments( OCPN_DBP_STC_VLW2,
                               toUsrDistance_Plugin(m_slog, g_iDashDistanceUnit),
                               getUsrDistanceUnit_Plugin(g_iDashDistanceUnit));
-      mLOG_Watchdog = no_nav_watchdog_timeout_ticks;
+      FeedWatchdog(WD_LOG);
     }
   }
   if (!N2kIsNA(TripLog)) {
@@ -2900,7 +3463,7 @@ void dashboard_pi::HandleN2K_128275(ObservedEvt ev) {
     SendSentenceToAllInstruments(
       OCPN_DBP_STC_VLW1, toUsrDistance_Plugin(m_tlog, g_iDashDistanceUnit),
       getUsrDistanceUnit_Plugin(g_iDashDistanceUnit));
-    mTrLOG_Watchdog = no_nav_watchdog_timeout_ticks;
+    FeedWatchdog(WD_TRLOG);
   }
 }
 
@@ -2916,8 +3479,8 @@ void dashboard_pi::HandleN2K_128259(ObservedEvt ev) {
   std::string source = GetN2000Source(id_128259, ev);
   source += ":" + ident;
 
-  if (mPriSTW >= 1) {
-    if (mPriSTW == 1) {
+  if (m_Priority.Accept(PG_STW, 1)) {
+    if (m_Priority.IsActive(PG_STW, 1)) {
       if (source != prio128259) return;
     }
     else {
@@ -2936,8 +3499,8 @@ void dashboard_pi::HandleN2K_128259(ObservedEvt ev) {
         SendSentenceToAllInstruments(
           OCPN_DBP_STC_STW, toUsrSpeed_Plugin(stw_knots, g_iDashSpeedUnit),
           getUsrSpeedUnit_Plugin(g_iDashSpeedUnit));
-        mPriSTW = 1;
-        mSTW_Watchdog = gps_watchdog_timeout_ticks;
+        m_Priority.Won(PG_STW, 1);
+        FeedWatchdog(WD_STW);
       }
     }
   }
@@ -2988,10 +3551,10 @@ void dashboard_pi::HandleN2K_129029(ObservedEvt ev) {
       default: talker_N2k = wxEmptyString;
     }
     if (!N2kIsNA(Altitude)) {
-      if (mPriAlt >= 1) {
+      if (m_Priority.Accept(PG_ALT, 1)) {
         SendSentenceToAllInstruments(OCPN_DBP_STC_ALTI, Altitude, _T("m"));
-        mPriAlt = 1;
-        mALT_Watchdog = gps_watchdog_timeout_ticks;
+        m_Priority.Won(PG_ALT, 1);
+        FeedWatchdog(WD_ALT);
       }
     }
   }
@@ -3018,7 +3581,7 @@ void dashboard_pi::HandleN2K_129540(ObservedEvt ev) {
   // Get the GNSS status data
   if (ParseN2kPGN129540(v, SID, Mode, NumberOfSVs)) {
 
-    if (!N2kIsNA(NumberOfSVs) && mPriSatStatus == 1) {
+    if (!N2kIsNA(NumberOfSVs) && m_Priority.IsActive(PG_SAT_STATUS, 1)) {
       // Step through each satellite, one-by-one
       // Arrange to max three messages with up to 4 sats each like N0183 GSV
       SAT_INFO N2K_SatInfo[4];
@@ -3048,8 +3611,8 @@ void dashboard_pi::HandleN2K_129540(ObservedEvt ev) {
         // Send to GPS.cpp
         if (idx > 0) {
           SendSatInfoToAllInstruments(NumberOfSVs, iMesNum + 1, talker_N2k, N2K_SatInfo);
-          //mPriSatStatus = 1;
-          mSatStatus_Wdog = gps_watchdog_timeout_ticks;
+          //m_Priority.Won(PG_SAT_STATUS, 1);
+          FeedWatchdog(WD_SAT_STATUS);
         }
       }
     }
@@ -3069,8 +3632,8 @@ void dashboard_pi::HandleN2K_130306(ObservedEvt ev) {
   std::string source = GetN2000Source(id_130306, ev);
   source += ":" + ident;
 
-  if (mPriWDN >= 1) {
-    if (mPriWDN == 1) {
+  if (m_Priority.Accept(PG_WDN, 1)) {
+    if (m_Priority.IsActive(PG_WDN, 1)) {
       if (source != prio130306) return;
     }
     else {
@@ -3090,15 +3653,15 @@ void dashboard_pi::HandleN2K_130306(ObservedEvt ev) {
 
         switch (WindReference) {
         case 0: // N2kWind direction True North
-          if (mPriWDN >= 1) {
+          if (m_Priority.Accept(PG_WDN, 1)) {
             double m_twdT = GEODESIC_RAD2DEG(WindAngle);
             SendSentenceToAllInstruments(OCPN_DBP_STC_TWD, m_twdT, _T("\u00B0"));
-            mPriWDN = 1;
-            mWDN_Watchdog = no_nav_watchdog_timeout_ticks;
+            m_Priority.Won(PG_WDN, 1);
+            FeedWatchdog(WD_WDN);
           }
           break;
         case 1:  // N2kWind direction Magnetic North
-          if (mPriWDN >= 1) {
+          if (m_Priority.Accept(PG_WDN, 1)) {
             double m_twdT = GEODESIC_RAD2DEG(WindAngle);
             // Make it true if variation is available
             if (!std::isnan(mVar)) {
@@ -3111,12 +3674,12 @@ void dashboard_pi::HandleN2K_130306(ObservedEvt ev) {
               }
             }
             SendSentenceToAllInstruments(OCPN_DBP_STC_TWD, m_twdT, _T("\u00B0"));
-            mPriWDN = 1;
-            mWDN_Watchdog = no_nav_watchdog_timeout_ticks;
+            m_Priority.Won(PG_WDN, 1);
+            FeedWatchdog(WD_WDN);
           }
           break;
         case 2: // N2kWind_Apparent_centerline
-          if (mPriAWA >= 1) {
+          if (m_Priority.Accept(PG_AWA, 1)) {
             double m_awaangle, m_awaspeed_kn, calc_angle;
             // Angle equals 0-360 degr
             m_awaangle = GEODESIC_RAD2DEG(WindAngle);
@@ -3133,30 +3696,30 @@ void dashboard_pi::HandleN2K_130306(ObservedEvt ev) {
             SendSentenceToAllInstruments(OCPN_DBP_STC_AWS,
               toUsrSpeed_Plugin(m_awaspeed_kn, g_iDashWindSpeedUnit),
               getUsrSpeedUnit_Plugin(g_iDashWindSpeedUnit));
-            mPriAWA = 1;
-            mMWVA_Watchdog = gps_watchdog_timeout_ticks;
+            m_Priority.Won(PG_AWA, 1);
+            FeedWatchdog(WD_MWVA);
 
             // If not N2K true wind data are recently received calculate it.
-            if (mPriTWA != 1) {
+            if (!m_Priority.IsActive(PG_TWA, 1)) {
               // Wants -+ angle instead of "L"/"R"
               if (calc_angle > 180) calc_angle -= 360.0;
               CalculateAndUpdateTWDS(m_awaspeed_kn, calc_angle);
-              mPriTWA = 2;
-              mPriWDN = 2;
-              mMWVT_Watchdog = gps_watchdog_timeout_ticks;
-              mWDN_Watchdog = no_nav_watchdog_timeout_ticks;
+              m_Priority.Won(PG_TWA, 2);
+              m_Priority.Won(PG_WDN, 2);
+              FeedWatchdog(WD_MWVT);
+              FeedWatchdog(WD_WDN);
             }
           }
           break;
         case 3: // N2kWind_True_centerline_boat(ground)
-          if (mPriTWA >= 1 && g_bDBtrueWindGround) {
+          if (m_Priority.Accept(PG_TWA, 1) && g_bDBtrueWindGround) {
             m_twaangle = GEODESIC_RAD2DEG(WindAngle);
             m_twaspeed_kn = MS2KNOTS(WindSpeed);
             sendTrueWind = true;
           }
           break;
         case 4: // N2kWind_True_Centerline__water
-          if (mPriTWA >= 1 && !g_bDBtrueWindGround) {
+          if (m_Priority.Accept(PG_TWA, 1) && !g_bDBtrueWindGround) {
             m_twaangle = GEODESIC_RAD2DEG(WindAngle);
             m_twaspeed_kn = MS2KNOTS(WindSpeed);
             sendTrueWind = true;
@@ -3185,9 +3748,9 @@ void dashboard_pi::HandleN2K_130306(ObservedEvt ev) {
           SendSentenceToAllInstruments(OCPN_DBP_STC_TWS2,
             toUsrSpeed_Plugin(m_twaspeed_kn, g_iDashWindSpeedUnit),
             getUsrSpeedUnit_Plugin(g_iDashWindSpeedUnit));
-          mPriTWA = 1;
-          mPriWDN = 1; // For source prio
-          mMWVT_Watchdog = gps_watchdog_timeout_ticks;
+          m_Priority.Won(PG_TWA, 1);
+          m_Priority.Won(PG_WDN, 1); // For source prio
+          FeedWatchdog(WD_MWVT);
         }
       }
     }
@@ -3203,26 +3766,26 @@ void dashboard_pi::HandleN2K_130310(ObservedEvt ev) {
   // Outside Environmental parameters
   if (ParseN2kPGN130310(v, SID, WaterTemperature,
                         OutsideAmbientAirTemperature, AtmosphericPressure)) {
-    if (mPriWTP >= 1) {
+    if (m_Priority.Accept(PG_WTP, 1)) {
       if (!N2kIsNA(WaterTemperature)) {
         double m_wtemp KELVIN2C(WaterTemperature);
         SendSentenceToAllInstruments(
           OCPN_DBP_STC_TMP, toUsrTemp_Plugin(m_wtemp, g_iDashTempUnit),
           getUsrTempUnit_Plugin(g_iDashTempUnit));
-        mPriWTP =1;
-        mWTP_Watchdog = no_nav_watchdog_timeout_ticks;
+        m_Priority.Won(PG_WTP, 1);
+        FeedWatchdog(WD_WTP);
       }
     }
 
-    if (mPriATMP >= 1) {
+    if (m_Priority.Accept(PG_ATMP, 1)) {
       if (!N2kIsNA(OutsideAmbientAirTemperature)) {
         double m_airtemp = KELVIN2C(OutsideAmbientAirTemperature);
         if (m_airtemp > -60 && m_airtemp < 100) {
           SendSentenceToAllInstruments(
             OCPN_DBP_STC_ATMP, toUsrTemp_Plugin(m_airtemp, g_iDashTempUnit),
             getUsrTempUnit_Plugin(g_iDashTempUnit));
-          mPriATMP = 1;
-          mATMP_Watchdog = no_nav_watchdog_timeout_ticks;
+          m_Priority.Won(PG_ATMP, 1);
+          FeedWatchdog(WD_ATMP);
         }
       }
     }
@@ -3230,7 +3793,7 @@ void dashboard_pi::HandleN2K_130310(ObservedEvt ev) {
     if (!N2kIsNA(AtmosphericPressure)) {
       double m_press = PA2HPA(AtmosphericPressure);
       SendSentenceToAllInstruments(OCPN_DBP_STC_MDA, m_press, _T("hPa"));
-      mMDA_Watchdog = no_nav_watchdog_timeout_ticks;
+      FeedWatchdog(WD_MDA);
     }
   }
 }
@@ -3245,11 +3808,11 @@ void dashboard_pi::HandleN2K_130313(ObservedEvt ev) {
 
     if (ParseN2kPGN130313(v, SID, HumidityInstance, HumiditySource,
         ActualHumidity, SetHumidity)) {
-        if (mPriHUM >= 1) {
+        if (m_Priority.Accept(PG_HUM, 1)) {
             if (!N2kIsNA(ActualHumidity)) {
                 SendSentenceToAllInstruments(OCPN_DBP_STC_HUM, ActualHumidity, "%");
-                mPriHUM = 1;
-                mHUM_Watchdog = no_nav_watchdog_timeout_ticks;
+                m_Priority.Won(PG_HUM, 1);
+                FeedWatchdog(WD_HUM);
             }
         }
     }
@@ -3277,7 +3840,7 @@ void dashboard_pi::HandleN2K_127488(ObservedEvt ev) {
         dualEngine = TRUE;
     }
 
-    engineWatchDog = wxDateTime::Now();
+    FeedWatchdog(WD_ENGINE);
 
     if (IsDataValid(engineSpeed)) {
         switch (engineInstance) {
@@ -3476,7 +4039,7 @@ void dashboard_pi::HandleN2K_127505(ObservedEvt ev) {
     unsigned int tankCapacity; // 0.1 L
     tankCapacity = payload[index + 3] | (payload[index + 4] << 8) | (payload[index + 5] << 16) | (payload[index + 6] << 24);
 
-    tankLevelWatchDog = wxDateTime::Now();
+    FeedWatchdog(WD_TANK);
 
     if (IsDataValid(tankLevel)) {
 
@@ -3628,18 +4191,18 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
     static wxString talkerID = wxEmptyString;
 
     if (update_path == _T("navigation.position")) {
-      if (mPriPosition >= 2) {
+      if (m_Priority.Accept(PG_POSITION, 2)) {
         if (value["latitude"].IsDouble() && value["longitude"].IsDouble()) {
           double lat = value["latitude"].AsDouble();
           double lon = value["longitude"].AsDouble();
           SendSentenceToAllInstruments(OCPN_DBP_STC_LAT, lat, _T("SDMM"));
           SendSentenceToAllInstruments(OCPN_DBP_STC_LON, lon, _T("SDMM"));
-          mPriPosition = 2;
+          m_Priority.Won(PG_POSITION, 2);
         }
       }
     }
     else if (update_path == _T("navigation.speedOverGround") &&
-             2 == mPriPosition) {
+             m_Priority.IsActive(PG_POSITION, 2)) {
       double sog_knot = GetJsonDouble(value);
       if (std::isnan(sog_knot)) return;
 
@@ -3649,7 +4212,7 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
         getUsrSpeedUnit_Plugin(g_iDashSpeedUnit));
     }
     else if (update_path == _T("navigation.courseOverGroundTrue") &&
-             2 == mPriPosition) {
+             m_Priority.IsActive(PG_POSITION, 2)) {
       double cog_rad = GetJsonDouble(value);
       if (std::isnan(cog_rad)) return;
 
@@ -3658,41 +4221,41 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
                                    _T("\u00B0"));
     }
     else if (update_path == _T("navigation.headingTrue")) {
-      if (mPriHeadingT >= 2) {
+      if (m_Priority.Accept(PG_HEADING_T, 2)) {
         double hdt = GetJsonDouble(value);
         if (std::isnan(hdt)) return;
 
         hdt = GEODESIC_RAD2DEG(hdt);
         SendSentenceToAllInstruments(OCPN_DBP_STC_HDT, hdt, _T("\u00B0T"));
-        mPriHeadingT = 2;
-        mHDT_Watchdog = gps_watchdog_timeout_ticks;
+        m_Priority.Won(PG_HEADING_T, 2);
+        FeedWatchdog(WD_HDT);
       }
     }
     else if (update_path == _T("navigation.headingMagnetic")) {
-      if (mPriHeadingM >= 2) {
+      if (m_Priority.Accept(PG_HEADING_M, 2)) {
         double hdm = GetJsonDouble(value);
         if (std::isnan(hdm)) return;
 
         hdm = GEODESIC_RAD2DEG(hdm);
         SendSentenceToAllInstruments(OCPN_DBP_STC_HDM, hdm, _T("\u00B0M"));
-        mPriHeadingM = 2;
-        mHDx_Watchdog = gps_watchdog_timeout_ticks;
+        m_Priority.Won(PG_HEADING_M, 2);
+        FeedWatchdog(WD_HDM);
 
         // If no higher priority HDT, calculate it here.
-        if (mPriHeadingT >= 6 && ( !std::isnan(mVar) )) {
+        if (m_Priority.Accept(PG_HEADING_T, 6) && ( !std::isnan(mVar) )) {
           double heading = hdm + mVar;
           if (heading < 0)
             heading += 360;
           else if (heading >= 360.0)
             heading -= 360;
           SendSentenceToAllInstruments(OCPN_DBP_STC_HDT, heading, _T("\u00B0"));
-          mPriHeadingT = 6;
-          mHDT_Watchdog = gps_watchdog_timeout_ticks;
+          m_Priority.Won(PG_HEADING_T, 6);
+          FeedWatchdog(WD_HDT);
         }
       }
     }
     else if (update_path == _T("navigation.speedThroughWater")) {
-      if (mPriSTW >= 2) {
+      if (m_Priority.Accept(PG_STW, 2)) {
         double stw_knots = GetJsonDouble(value);
         if (std::isnan(stw_knots)) return;
 
@@ -3700,25 +4263,25 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
         SendSentenceToAllInstruments(
           OCPN_DBP_STC_STW, toUsrSpeed_Plugin(stw_knots, g_iDashSpeedUnit),
           getUsrSpeedUnit_Plugin(g_iDashSpeedUnit));
-        mPriSTW = 2;
-        mSTW_Watchdog = gps_watchdog_timeout_ticks;
+        m_Priority.Won(PG_STW, 2);
+        FeedWatchdog(WD_STW);
       }
     }
     else if (update_path == _T("navigation.magneticVariation")) {
-      if (mPriVar >= 2) {
+      if (m_Priority.Accept(PG_VAR, 2)) {
         double dvar = GetJsonDouble(value);
         if (std::isnan(dvar)) return;
 
         dvar = GEODESIC_RAD2DEG(dvar);
         if (0.0 != dvar) {  // Let WMM do the job instead
           SendSentenceToAllInstruments(OCPN_DBP_STC_HMV, dvar, _T("\u00B0"));
-          mPriVar = 2;
-          mVar_Watchdog = gps_watchdog_timeout_ticks;
+          m_Priority.Won(PG_VAR, 2);
+          FeedWatchdog(WD_VAR);
         }
       }
     }
     else if (update_path == _T("environment.wind.angleApparent")) {
-      if (mPriAWA >= 2) {
+      if (m_Priority.Accept(PG_AWA, 2)) {
         double m_awaangle = GetJsonDouble(value);
         if (std::isnan(m_awaangle)) return;
 
@@ -3729,12 +4292,12 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
           m_awaangle *= -1;
         }
         SendSentenceToAllInstruments(OCPN_DBP_STC_AWA, m_awaangle, m_awaunit);
-        mPriAWA = 2;  // Set prio only here. No need to catch speed if no angle.
-        mMWVA_Watchdog = gps_watchdog_timeout_ticks;
+        m_Priority.Won(PG_AWA, 2);  // Set prio only here. No need to catch speed if no angle.
+        FeedWatchdog(WD_MWVA);
       }
     }
     else if (update_path == _T("environment.wind.speedApparent")) {
-      if (mPriAWA >= 2) {
+      if (m_Priority.Accept(PG_AWA, 2)) {
         double m_awaspeed_kn = GetJsonDouble(value);
         if (std::isnan(m_awaspeed_kn)) return;
 
@@ -3749,7 +4312,7 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
               !g_bDBtrueWindGround ) ||
               ( update_path == _T("environment.wind.angleTrueGround") &&
                g_bDBtrueWindGround )) {
-      if (mPriTWA >= 3) {
+      if (m_Priority.Accept(PG_TWA, 3)) {
         double m_twaangle = GetJsonDouble(value);
         if (std::isnan(m_twaangle)) return;
 
@@ -3761,26 +4324,22 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
           m_twaangle *= -1;
         }
         SendSentenceToAllInstruments(OCPN_DBP_STC_TWA, m_twaangle, m_twaunit);
-        mPriTWA = 3;  // Set prio only here. No need to catch speed if no angle.
-        mMWVT_Watchdog = gps_watchdog_timeout_ticks;
+        m_Priority.Won(PG_TWA, 3);  // Set prio only here. No need to catch speed if no angle.
+        FeedWatchdog(WD_MWVT);
 
-        if (mPriWDN >= 5) {
+        if (m_Priority.Accept(PG_WDN, 5)) {
           // m_twaangle_raw has wind angle relative to the bow.
           // Wind history use angle relative to north.
           // If no TWD with higher priority is present and
           // true heading is available calculate it.
-          if (g_dHDT < 361. && g_dHDT >= 0.0) {
-            double g_dCalWdir = (m_twaangle_raw)+g_dHDT;
-            if (g_dCalWdir > 360.) {
-              g_dCalWdir -= 360;
-            }
-            else if (g_dCalWdir < 0.) {
-              g_dCalWdir += 360;
-            }
-            SendSentenceToAllInstruments(OCPN_DBP_STC_TWD, g_dCalWdir,
+          m_Derived.Set(DD_TWA, m_twaangle_raw);
+          if (m_Derived.Take(DD_OUT_TWD_MEASURED) &&
+              !std::isnan(m_Derived.GetTwdMeasured())) {
+            SendSentenceToAllInstruments(OCPN_DBP_STC_TWD,
+                                         m_Derived.GetTwdMeasured(),
                                          _T("\u00B0"));
-            mPriWDN = 5;
-            mWDN_Watchdog = no_nav_watchdog_timeout_ticks;
+            m_Priority.Won(PG_WDN, 5);
+            FeedWatchdog(WD_WDN);
           }
         }
       }
@@ -3789,7 +4348,7 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
               !g_bDBtrueWindGround ) ||
               ( update_path == _T("environment.wind.speedOverGround") &&
                g_bDBtrueWindGround )) {
-      if (mPriTWA >= 3) {
+      if (m_Priority.Accept(PG_TWA, 3)) {
         double m_twaspeed_kn = GetJsonDouble(value);
         if (std::isnan(m_twaspeed_kn)) return;
 
@@ -3805,35 +4364,35 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
       }
     }
     else if (update_path == _T("environment.depth.belowSurface")) {
-      if (mPriDepth >= 3) {
+      if (m_Priority.Accept(PG_DEPTH, 3)) {
         double depth = GetJsonDouble(value);
         if (std::isnan(depth)) return;
 
-        mPriDepth = 3;
+        m_Priority.Won(PG_DEPTH, 3);
         depth += g_dDashDBTOffset;
         depth /= 1852.0;
         SendSentenceToAllInstruments(
           OCPN_DBP_STC_DPT, toUsrDistance_Plugin(depth, g_iDashDepthUnit),
           getUsrDistanceUnit_Plugin(g_iDashDepthUnit));
-        mDPT_DBT_Watchdog = gps_watchdog_timeout_ticks;
+        FeedWatchdog(WD_DPT);
       }
     }
     else if (update_path == _T("environment.depth.belowTransducer")) {
-      if (mPriDepth >= 3) {
+      if (m_Priority.Accept(PG_DEPTH, 3)) {
         double depth = GetJsonDouble(value);
         if (std::isnan(depth)) return;
 
-        mPriDepth = 3;
+        m_Priority.Won(PG_DEPTH, 3);
         depth += g_dDashDBTOffset;
         depth /= 1852.0;
         SendSentenceToAllInstruments(
           OCPN_DBP_STC_DPT, toUsrDistance_Plugin(depth, g_iDashDepthUnit),
           getUsrDistanceUnit_Plugin(g_iDashDepthUnit));
-        mDPT_DBT_Watchdog = gps_watchdog_timeout_ticks;
+        FeedWatchdog(WD_DPT);
       }
     }
     else if (update_path == _T("environment.water.temperature")) {
-      if (mPriWTP >= 2) {
+      if (m_Priority.Accept(PG_WTP, 2)) {
         double m_wtemp = GetJsonDouble(value);
         if (std::isnan(m_wtemp)) return;
 
@@ -3842,8 +4401,8 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
           SendSentenceToAllInstruments(
             OCPN_DBP_STC_TMP, toUsrTemp_Plugin(m_wtemp, g_iDashTempUnit),
             getUsrTempUnit_Plugin(g_iDashTempUnit));
-          mPriWTP = 2;
-          mWTP_Watchdog = no_nav_watchdog_timeout_ticks;
+          m_Priority.Won(PG_WTP, 2);
+          FeedWatchdog(WD_WTP);
         }
       }
     }
@@ -3856,7 +4415,7 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
       SendSentenceToAllInstruments(
         OCPN_DBP_STC_VMG, toUsrSpeed_Plugin(m_vmg_kn, g_iDashSpeedUnit),
         getUsrSpeedUnit_Plugin(g_iDashSpeedUnit));
-      mVMG_Watchdog = gps_watchdog_timeout_ticks;
+      FeedWatchdog(WD_VMG);
     }
 
     else if (update_path ==
@@ -3868,28 +4427,29 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
       SendSentenceToAllInstruments(
         OCPN_DBP_STC_VMGW, toUsrSpeed_Plugin(m_vmgw_kn, g_iDashSpeedUnit),
         getUsrSpeedUnit_Plugin(g_iDashSpeedUnit));
-      mVMGW_Watchdog = gps_watchdog_timeout_ticks;
+      m_Priority.Won(PG_VMGW, 1);
+      FeedWatchdog(WD_VMGW);
     }
 
     else if (update_path == _T("steering.rudderAngle")) {  // ->port
-      if (mPriRSA >= 2) {
+      if (m_Priority.Accept(PG_RSA, 2)) {
         double m_rudangle = GetJsonDouble(value);
         if (std::isnan(m_rudangle)) return;
 
         m_rudangle = GEODESIC_RAD2DEG(m_rudangle);
         SendSentenceToAllInstruments(OCPN_DBP_STC_RSA, m_rudangle, _T("\u00B0"));
-        mRSA_Watchdog = gps_watchdog_timeout_ticks;
-        mPriRSA = 2;
+        FeedWatchdog(WD_RSA);
+        m_Priority.Won(PG_RSA, 2);
       }
     }
     else if (update_path ==
              _T("navigation.gnss.satellites")) {  // GNSS satellites in use
-      if (mPriSatUsed >= 2) {
+      if (m_Priority.Accept(PG_SAT_USED, 2)) {
         int usedSats = ( value ).AsInt();
         if (usedSats < 1 ) return;
         SendSentenceToAllInstruments(OCPN_DBP_STC_SAT, usedSats, _T (""));
-        mPriSatUsed = 2;
-        mSatsUsed_Wdog = gps_watchdog_timeout_ticks;
+        m_Priority.Won(PG_SAT_USED, 2);
+        FeedWatchdog(WD_SAT_USED);
       }
     }
     else if (update_path == _T("navigation.gnss.type") ) {
@@ -3911,16 +4471,16 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
     else if (update_path ==
                _T("navigation.gnss.satellitesInView")) {  // GNSS satellites in
                                                           // view
-      if (mPriSatUsed >= 4 ) {
+      if (m_Priority.Accept(PG_SAT_USED, 4) ) {
         if (value.HasMember("count") && value["count"].IsInt()) {
           double m_SK_SatsInView = (value["count"].AsInt());
           SendSentenceToAllInstruments(OCPN_DBP_STC_SAT, m_SK_SatsInView,
                                        _T (""));
-          mPriSatUsed = 4;
-          mSatsUsed_Wdog = gps_watchdog_timeout_ticks;
+          m_Priority.Won(PG_SAT_USED, 4);
+          FeedWatchdog(WD_SAT_USED);
         }
       }
-      if (mPriSatStatus == 2) {
+      if (m_Priority.IsActive(PG_SAT_STATUS, 2)) {
         if (value.HasMember("satellites") && value["satellites"].IsArray()) {
           // Update satellites data.
           int iNumSats;
@@ -3968,8 +4528,8 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
                   talkerID = talker; //Origin NMEA0183
                 }
                 SendSatInfoToAllInstruments(iNumSats, iMesNum + 1, talkerID, SK_SatInfo);
-                //mPriSatStatus = 2;
-                mSatStatus_Wdog = gps_watchdog_timeout_ticks;
+                //m_Priority.Won(PG_SAT_STATUS, 2);
+                FeedWatchdog(WD_SAT_STATUS);
               }
 
               if (iID < 1) break;
@@ -3978,28 +4538,28 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
         }
       }
     } else if (update_path == _T("navigation.gnss.antennaAltitude")) {
-      if (mPriAlt >= 2) {
+      if (m_Priority.Accept(PG_ALT, 2)) {
         double m_alt = GetJsonDouble(value);
         if (std::isnan(m_alt)) return;
 
         SendSentenceToAllInstruments(OCPN_DBP_STC_ALTI, m_alt, _T("m"));
-        mPriAlt = 2;
-        mALT_Watchdog = gps_watchdog_timeout_ticks;
+        m_Priority.Won(PG_ALT, 2);
+        FeedWatchdog(WD_ALT);
       }
 
     } else if (update_path == _T("navigation.datetime")) {
-      if (mPriDateTime >= 1) {
-        mPriDateTime = 1;
+      if (m_Priority.Accept(PG_DATETIME, 1)) {
+        m_Priority.Won(PG_DATETIME, 1);
         wxString s_dt = (value.AsString());  //"2019-12-28T09:26:58.000Z"
         s_dt.Replace('-', wxEmptyString);
         s_dt.Replace(':', wxEmptyString);
         wxString utc_dt = s_dt.BeforeFirst('T');      // Date
         utc_dt.Append(s_dt.AfterFirst('T').Left(6));  // time
         mUTCDateTime.ParseFormat(utc_dt.c_str(), _T("%Y%m%d%H%M%S"));
-        mUTC_Watchdog = gps_watchdog_timeout_ticks;
+        FeedWatchdog(WD_UTC);
       }
     } else if (update_path == _T("environment.outside.temperature")) {
-      if (mPriATMP >= 2) {
+      if (m_Priority.Accept(PG_ATMP, 2)) {
         double m_airtemp = GetJsonDouble(value);
         if (std::isnan(m_airtemp)) return;
 
@@ -4008,34 +4568,34 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
           SendSentenceToAllInstruments(
               OCPN_DBP_STC_ATMP, toUsrTemp_Plugin(m_airtemp, g_iDashTempUnit),
               getUsrTempUnit_Plugin(g_iDashTempUnit));
-          mPriATMP = 2;
-          mATMP_Watchdog = no_nav_watchdog_timeout_ticks;
+          m_Priority.Won(PG_ATMP, 2);
+          FeedWatchdog(WD_ATMP);
         }
       }
     }
     else if (update_path == _T("environment.outside.humidity") ||
         update_path == _T("environment.outside.relativeHumidity")) {
-            if (mPriHUM >= 2) {
+            if (m_Priority.Accept(PG_HUM, 2)) {
                 double m_hum = GetJsonDouble(value) * 100;  // ratio2%
                 if (std::isnan(m_hum)) return;
                 SendSentenceToAllInstruments(OCPN_DBP_STC_HUM, m_hum, "%");
-                mPriHUM = 2;
-                mHUM_Watchdog = no_nav_watchdog_timeout_ticks;
+                m_Priority.Won(PG_HUM, 2);
+                FeedWatchdog(WD_HUM);
             }
     } else if (update_path ==
                _T("environment.wind.directionTrue")) {  // relative true north
-      if (mPriWDN >= 3) {
+      if (m_Priority.Accept(PG_WDN, 3)) {
         double m_twdT = GetJsonDouble(value);
         if (std::isnan(m_twdT)) return;
 
         m_twdT = GEODESIC_RAD2DEG(m_twdT);
         SendSentenceToAllInstruments(OCPN_DBP_STC_TWD, m_twdT, _T("\u00B0"));
-        mPriWDN = 3;
-        mWDN_Watchdog = no_nav_watchdog_timeout_ticks;
+        m_Priority.Won(PG_WDN, 3);
+        FeedWatchdog(WD_WDN);
       }
     } else if (update_path == _T("environment.wind.directionMagnetic")) {
       // relative magn north
-      if (mPriWDN >= 4) {
+      if (m_Priority.Accept(PG_WDN, 4)) {
         double m_twdM = GetJsonDouble(value);
         if (std::isnan(m_twdM)) return;
         m_twdM = GEODESIC_RAD2DEG(m_twdM);
@@ -4050,8 +4610,8 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
           }
         }
         SendSentenceToAllInstruments(OCPN_DBP_STC_TWD, m_twdM, _T("\u00B0"));
-        mPriWDN = 4;
-        mWDN_Watchdog = no_nav_watchdog_timeout_ticks;
+        m_Priority.Won(PG_WDN, 4);
+        FeedWatchdog(WD_WDN);
       }
     } else if (update_path == _T("navigation.trip.log")) {  // m
       double m_tlog = GetJsonDouble(value);
@@ -4061,7 +4621,7 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
       SendSentenceToAllInstruments(
           OCPN_DBP_STC_VLW1, toUsrDistance_Plugin(m_tlog, g_iDashDistanceUnit),
           getUsrDistanceUnit_Plugin(g_iDashDistanceUnit));
-      mTrLOG_Watchdog = no_nav_watchdog_timeout_ticks;
+      FeedWatchdog(WD_TRLOG);
     } else if (update_path == _T("navigation.log")) {  // m
       double m_slog = GetJsonDouble(value);
       if (std::isnan(m_slog)) return;
@@ -4070,16 +4630,16 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
       SendSentenceToAllInstruments(
           OCPN_DBP_STC_VLW2, toUsrDistance_Plugin(m_slog, g_iDashDistanceUnit),
           getUsrDistanceUnit_Plugin(g_iDashDistanceUnit));
-      mLOG_Watchdog = no_nav_watchdog_timeout_ticks;
+      FeedWatchdog(WD_LOG);
     } else if (update_path == _T("environment.outside.pressure")) {  // Pa
       double m_press = GetJsonDouble(value);
       if (std::isnan(m_press)) return;
 
       m_press = PA2HPA(m_press);
       SendSentenceToAllInstruments(OCPN_DBP_STC_MDA, m_press, _T("hPa"));
-      mMDA_Watchdog = no_nav_watchdog_timeout_ticks;
+      FeedWatchdog(WD_MDA);
     } else if (update_path == _T("navigation.attitude")) {  // rad
-      if (mPriPitchRoll >= 2) {
+      if (m_Priority.Accept(PG_PITCH_ROLL, 2)) {
         if (value["roll"].AsString() != "0") {
           double m_heel = GEODESIC_RAD2DEG(value["roll"].AsDouble());
           wxString h_unit = _T("\u00B0\u003E") + _("Stbd");
@@ -4088,8 +4648,8 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
             m_heel *= -1;
           }
           SendSentenceToAllInstruments(OCPN_DBP_STC_HEEL, m_heel, h_unit);
-          mHEEL_Watchdog = gps_watchdog_timeout_ticks;
-          mPriPitchRoll = 2;
+          FeedWatchdog(WD_HEEL);
+          m_Priority.Won(PG_PITCH_ROLL, 2);
         }
         if (value["pitch"].AsString() != "0") {
           double m_pitch = GEODESIC_RAD2DEG(value["pitch"].AsDouble());
@@ -4099,8 +4659,8 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
             m_pitch *= -1;
           }
           SendSentenceToAllInstruments(OCPN_DBP_STC_PITCH, m_pitch, p_unit);
-          mPITCH_Watchdog = gps_watchdog_timeout_ticks;
-          mPriPitchRoll = 2;
+          FeedWatchdog(WD_PITCH);
+          m_Priority.Won(PG_PITCH_ROLL, 2);
         }
       }
     }
@@ -4110,59 +4670,53 @@ void dashboard_pi::updateSKItem(wxJSONValue &item, wxString &talker, wxString &s
 /*******Nav data from OCPN core *******/
 void dashboard_pi::SetPositionFixEx(PlugIn_Position_Fix_Ex &pfix) {
 
-  if (mPriPosition >= 1) {
-    mPriPosition = 1;
+  if (m_Priority.Accept(PG_POSITION, 1)) {
+    m_Priority.Won(PG_POSITION, 1);
     SendSentenceToAllInstruments(OCPN_DBP_STC_LAT, pfix.Lat, _T("SDMM"));
     SendSentenceToAllInstruments(OCPN_DBP_STC_LON, pfix.Lon, _T("SDMM"));
   }
-  if (mPriCOGSOG >= 1) {
-    double dMagneticCOG;
-    mPriCOGSOG = 1;
+  if (m_Priority.Accept(PG_COGSOG, 1)) {
+    m_Priority.Won(PG_COGSOG, 1);
     SendSentenceToAllInstruments(
         OCPN_DBP_STC_SOG,
         toUsrSpeed_Plugin(mSOGFilter.filter(pfix.Sog), g_iDashSpeedUnit),
         getUsrSpeedUnit_Plugin(g_iDashSpeedUnit));
     SendSentenceToAllInstruments(OCPN_DBP_STC_COG, mCOGFilter.filter(pfix.Cog),
                                  _T("\u00B0"));
-    dMagneticCOG = mCOGFilter.get() - pfix.Var;
-    if (dMagneticCOG < 0.0) dMagneticCOG = 360.0 + dMagneticCOG;
-    if (dMagneticCOG > 360.0) dMagneticCOG = dMagneticCOG - 360.0;
-    SendSentenceToAllInstruments(OCPN_DBP_STC_MCOG, dMagneticCOG,
-                                 _T("\u00B0M"));
   }
-  if (mPriVar >= 1) {
+  if (m_Priority.Accept(PG_VAR, 1)) {
     if (!std::isnan(pfix.Var)) {
-      mPriVar = 1;
+      m_Priority.Won(PG_VAR, 1);
       mVar = pfix.Var;
-      mVar_Watchdog = gps_watchdog_timeout_ticks;
+      FeedWatchdog(WD_VAR);
 
       SendSentenceToAllInstruments(OCPN_DBP_STC_HMV, pfix.Var, _T("\u00B0"));
     }
   }
-  if (mPriDateTime >= 6) {  // We prefer the GPS datetime
+  if (m_Priority.Accept(PG_DATETIME, 6)) {  // We prefer the GPS datetime
     mUTCDateTime.Set(pfix.FixTime);
     if (mUTCDateTime.IsValid()) {
-      mPriDateTime = 6;
+      m_Priority.Won(PG_DATETIME, 6);
       mUTCDateTime = mUTCDateTime.ToUTC();
-      mUTC_Watchdog = gps_watchdog_timeout_ticks;
+      FeedWatchdog(WD_UTC);
     }
   }
-  if (mPriSatUsed >= 1) {
+  if (m_Priority.Accept(PG_SAT_USED, 1)) {
     mSatsInUse = pfix.nSats;
     if (mSatsInUse > 0) {
       SendSentenceToAllInstruments(OCPN_DBP_STC_SAT, mSatsInUse, _T(""));
-      mPriSatUsed = 1;
-      mSatsUsed_Wdog = gps_watchdog_timeout_ticks;
+      m_Priority.Won(PG_SAT_USED, 1);
+      FeedWatchdog(WD_SAT_USED);
     }
   }
-  if (mPriHeadingT >= 1) {
+  if (m_Priority.Accept(PG_HEADING_T, 1)) {
     double hdt = pfix.Hdt;
     if (std::isnan(hdt)) return;
     SendSentenceToAllInstruments(OCPN_DBP_STC_HDT, hdt, _T("\u00B0T"));
-    mPriHeadingT = 1;
-    mHDT_Watchdog = gps_watchdog_timeout_ticks;
+    m_Priority.Won(PG_HEADING_T, 1);
+    FeedWatchdog(WD_HDT);
   }
-  if (mPriHeadingM >= 1) {
+  if (m_Priority.Accept(PG_HEADING_M, 1)) {
     double hdm = pfix.Hdm;
     if (std::isnan(hdm) && !std::isnan(pfix.Hdt) && !std::isnan(pfix.Var)) {
       hdm = pfix.Hdt - pfix.Var;
@@ -4171,8 +4725,8 @@ void dashboard_pi::SetPositionFixEx(PlugIn_Position_Fix_Ex &pfix) {
     }
     if (std::isnan(hdm)) return;
     SendSentenceToAllInstruments(OCPN_DBP_STC_HDM, hdm, _T("\u00B0M"));
-    mPriHeadingM = 1;
-    mHDx_Watchdog = gps_watchdog_timeout_ticks;
+    m_Priority.Won(PG_HEADING_M, 1);
+    FeedWatchdog(WD_HDM);
   }
 }
 
@@ -4202,14 +4756,26 @@ void dashboard_pi::SetPluginMessage(wxString &message_id,
     double decl_val;
     decl.ToDouble(&decl_val);
 
-    if (mPriVar >= 5) {
-      mPriVar = 5;
+    if (m_Priority.Accept(PG_VAR, 5)) {
+      m_Priority.Won(PG_VAR, 5);
       mVar = decl_val;
-      mVar_Watchdog = gps_watchdog_timeout_ticks;
+      FeedWatchdog(WD_VAR);
       SendSentenceToAllInstruments(OCPN_DBP_STC_HMV, mVar, _T("\u00B0"));
     }
   } else if (message_id == _T("OCPN_CORE_SIGNALK")) {
     ParseSignalK(message_body);
+  } else if (message_id == _T("DASHBOARD_PI_PROFILE_REQUEST")) {
+    // Reply with the timings of Init and the last preference changes,
+    // a body of {"Log": true} also writes them to the OpenCPN log
+    wxJSONValue root;
+    wxJSONReader reader;
+    if (!message_body.IsEmpty() && reader.Parse(message_body, &root) == 0 &&
+        root[_T("Log")].IsBool() && root[_T("Log")].AsBool())
+      g_StartupProfile.Log();
+    wxJSONWriter writer;
+    wxString reply;
+    writer.Write(g_StartupProfile.ToJSON(), reply);
+    SendPluginMessage(_T("DASHBOARD_PI_PROFILE"), reply);
   }
 }
 
@@ -4240,7 +4806,11 @@ void dashboard_pi::ShowPreferencesDialog(wxWindow *parent) {
   }
 #endif
 
-  if (dialog->ShowModal() == wxID_OK) {
+  // Closing the dialog stores its global settings even without OK
+  bool ok = dialog->ShowModal() == wxID_OK;
+  m_bGlobalConfigDirty = true;
+  if (ok) {
+    g_StartupProfile.Begin(_T("Preferences"));
     double scaler = 1.0;
     if (OCPN_GetWinDIPScaleFactor() < 1.0)
       scaler = 1.0 + OCPN_GetWinDIPScaleFactor() / 4;
@@ -4280,15 +4850,17 @@ void dashboard_pi::ShowPreferencesDialog(wxWindow *parent) {
     m_ArrayOfDashboardWindow = dialog->m_Config;
 
     ApplyConfig();
-    SaveConfig();
+    ScheduleSaveConfig();
     //SetToolbarItemState(m_toolbar_item_id, GetDashboardWindowShownCount() != 0);
     SetToolbarItemState(m_toolbar_item_id, m_ShowDashboards);
+    g_StartupProfile.End();
   }
   dialog->Destroy();
 }
 
 void dashboard_pi::SetColorScheme(PI_ColorScheme cs) {
   aktuellColorScheme = cs;
+  ResetInstrumentPalettes();
   for (size_t i = 0; i < m_ArrayOfDashboardWindow.GetCount(); i++) {
     DashboardWindow *dashboard_window =
         m_ArrayOfDashboardWindow.Item(i)->m_pDashboardWindow;
@@ -4313,6 +4885,7 @@ void dashboard_pi::OnToolbarToolCallback(int id) {
   int cnt = GetDashboardWindowShownCount();
 
   m_ShowDashboards = !m_ShowDashboards;
+  m_bGlobalConfigDirty = true;
 
   for (size_t i = 0; i < m_ArrayOfDashboardWindow.GetCount(); i++) {
     DashboardWindowContainer *cont = m_ArrayOfDashboardWindow.Item(i);
@@ -4329,9 +4902,23 @@ void dashboard_pi::OnToolbarToolCallback(int id) {
   SetToolbarItemState(m_toolbar_item_id, m_ShowDashboards);
 }
 
+// Sets a font of the preferences and its copy scaled for the display
+static void SetGlobalFont(wxFontData *&pFont, wxFontData &Font,
+                          wxFontData *pUSFont, const wxFont &font,
+                          const wxColour &colour, double scaler) {
+  pFont = &Font;
+  pUSFont->SetChosenFont(font);
+  pUSFont->SetColour(colour);
+  Font = *pUSFont;
+  Font.SetChosenFont(font.Scaled(scaler));
+}
+
 bool dashboard_pi::LoadConfig(void) {
   wxFileConfig *pConf = (wxFileConfig *)m_pconfig;
 
+  // Fonts may change, drop the measured texts and colours of the old ones
+  ResetTextExtentCache();
+  ResetInstrumentPalettes();
   if (pConf) {
     pConf->SetPath(_T("/PlugIns/Dashboard"));
 
@@ -4365,49 +4952,46 @@ bool dashboard_pi::LoadConfig(void) {
       scaler = 1.0 + OCPN_GetWinDIPScaleFactor()/4;
     scaler = wxMax(1.0, scaler);
 
-    g_pFontTitle = &g_FontTitle;
+    // Defaults of missing keys are part of the layout too
+    m_sLayoutSalt =
+        TitleFont + DataFont + LabelFont + SmallFont + wxVERSION_STRING;
+    uint64_t hash = LayoutSnapshot::HashConfig(
+        pConf, _T("/PlugIns/Dashboard"), m_sLayoutSalt);
+    LayoutSnapshot snapshot;
+    if (!version.IsEmpty() && snapshot.Load(LAYOUT_SNAPSHOT_FILE, hash) &&
+        ReadLayoutSnapshot(snapshot, scaler)) {
+      LoadPriorityOrder(pConf);
+      return true;
+    }
+    pConf->SetPath(_T("/PlugIns/Dashboard"));
+
     pConf->Read(_T("FontTitle"), &config, TitleFont);
     LoadFont(&pDF, config);
     pConf->Read(_T("ColorTitle"), &config, "#000000");
     wxColour DummyColor(config);
-    g_pUSFontTitle->SetChosenFont(DummyFont);
-    g_pUSFontTitle->SetColour(DummyColor);
-    g_FontTitle = *g_pUSFontTitle;
-    g_FontTitle.SetChosenFont(g_pUSFontTitle->GetChosenFont().Scaled(scaler));
-    g_USFontTitle = *g_pUSFontTitle;    
+    SetGlobalFont(g_pFontTitle, g_FontTitle, g_pUSFontTitle, DummyFont,
+                  DummyColor, scaler);
 
-    g_pFontData = &g_FontData;
     pConf->Read(_T("FontData"), &config, DataFont);
     LoadFont(&pDF, config);
     pConf->Read(_T("ColorData"), &config, "#000000");
     DummyColor.Set(config);
-    g_pUSFontData->SetChosenFont(DummyFont);
-    g_pUSFontData->SetColour(DummyColor);
-    g_FontData = *g_pUSFontData;
-    g_FontData.SetChosenFont(g_pUSFontData->GetChosenFont().Scaled(scaler));
-    g_USFontData = *g_pUSFontData;
+    SetGlobalFont(g_pFontData, g_FontData, g_pUSFontData, DummyFont,
+                  DummyColor, scaler);
 
-    g_pFontLabel = &g_FontLabel;
     pConf->Read(_T("FontLabel"), &config, LabelFont);
     LoadFont(&pDF, config);
     pConf->Read(_T("ColorLabel"), &config, "#000000");
     DummyColor.Set(config);
-    g_pUSFontLabel->SetChosenFont(DummyFont);
-    g_pUSFontLabel->SetColour(DummyColor);
-    g_FontLabel = *g_pUSFontLabel;
-    g_FontLabel.SetChosenFont(g_pUSFontLabel->GetChosenFont().Scaled(scaler));
-    g_USFontLabel = *g_pUSFontLabel;
+    SetGlobalFont(g_pFontLabel, g_FontLabel, g_pUSFontLabel, DummyFont,
+                  DummyColor, scaler);
 
-    g_pFontSmall = &g_FontSmall;
     pConf->Read(_T("FontSmall"), &config, SmallFont);
     LoadFont(&pDF, config);
     pConf->Read(_T("ColorSmall"), &config, "#000000");
     DummyColor.Set(config);
-    g_pUSFontSmall->SetChosenFont(DummyFont);
-    g_pUSFontSmall->SetColour(DummyColor);
-    g_FontSmall = *g_pUSFontSmall;
-    g_FontSmall.SetChosenFont(g_pUSFontSmall->GetChosenFont().Scaled(scaler));
-    g_USFontSmall = *g_pUSFontSmall;
+    SetGlobalFont(g_pFontSmall, g_FontSmall, g_pUSFontSmall, DummyFont,
+                  DummyColor, scaler);
 
     pConf->Read(_T("SpeedometerMax"), &g_iDashSpeedMax, 12);
     pConf->Read(_T("COGDamp"), &g_iDashCOGDamp, 0);
@@ -4424,6 +5008,8 @@ bool dashboard_pi::LoadConfig(void) {
     pConf->Read(_T("TemperatureUnit"), &g_iDashTempUnit, 0);
 
     pConf->Read(_T("UTCOffset"), &g_iUTCOffset, 0);
+    pConf->Read(_T("WindHistorySpan"), &g_iDashWindHistorySpan, 1);
+    pConf->Read(_T("BaroHistorySpan"), &g_iDashBaroHistorySpan, 1);
 
     pConf->Read(_T("PrefWidth"), &g_dashPrefWidth, 0);
     pConf->Read(_T("PrefHeight"), &g_dashPrefHeight, 0);
@@ -4437,12 +5023,15 @@ bool dashboard_pi::LoadConfig(void) {
     pConf->Read(_T("DualEngine"), &dualEngine, false);
     pConf->Read(_T("TwentyFourVolt"), &twentyFourVolts, false);
 
+    LoadPriorityOrder(pConf);
+
     int d_cnt;
     pConf->Read(_T("DashboardCount"), &d_cnt, -1);
     // TODO: Memory leak? We should destroy everything first
     m_ArrayOfDashboardWindow.Clear();
     if (version.IsEmpty() && d_cnt == -1) {
       m_config_version = 1;
+      m_bGlobalConfigDirty = true;
       // Let's load version 1 or default settings.
       int i_cnt;
       pConf->Read(_T("InstrumentCount"), &i_cnt, -1);
@@ -4498,9 +5087,11 @@ bool dashboard_pi::LoadConfig(void) {
         pConf->Read(_T("Style"), &b_Style, wxDEFAULT_DIALOG_STYLE | wxRESIZE_BORDER);
         wxArrayInt ar;
         wxArrayOfInstrumentProperties Property;
+        bool b_skipped = false;  // The list places no longer match the keys
         for (int i = 0; i < i_cnt; i++) {
             int id;
             pConf->Read(wxString::Format(_T("Instrument%d"), i + 1), &id, -1);            
+            if (id == -1) b_skipped = true;
             if (id != -1)
             {
                 ar.Add(id);
@@ -4508,47 +5099,50 @@ bool dashboard_pi::LoadConfig(void) {
                 if (pConf->Exists(wxString::Format(_T("InstTitelFont%d"), i + 1)))
                 {
                     instp = new InstrumentProperties(id, i);
+                    InstrumentStyle style = instp->Style();
 
                     pConf->Read(wxString::Format(_T("InstTitelFont%d"), i + 1), &config, TitleFont);
                     LoadFont(&pDF, config);
                     pConf->Read(wxString::Format(_T("InstTitelColor%d"), i + 1), &config, "#000000");
                     DummyColor.Set(config);
-                    instp->m_TitelFont.SetChosenFont(DummyFont);
-                    instp->m_TitelFont.SetColour(DummyColor);
+                    style.m_TitelFont.SetChosenFont(DummyFont);
+                    style.m_TitelFont.SetColour(DummyColor);
 
                     pConf->Read(wxString::Format(_T("InstDataFont%d"), i + 1), &config, DataFont);
                     LoadFont(&pDF, config);
                     pConf->Read(wxString::Format(_T("InstDataColor%d"), i + 1), &config, "#000000");
                     DummyColor.Set(config);
-                    instp->m_DataFont.SetChosenFont(DummyFont);
-                    instp->m_DataFont.SetColour(DummyColor);
+                    style.m_DataFont.SetChosenFont(DummyFont);
+                    style.m_DataFont.SetColour(DummyColor);
 
                     pConf->Read(wxString::Format(_T("InstLabelFont%d"), i + 1), &config, LabelFont);
                     LoadFont(&pDF, config);
                     pConf->Read(wxString::Format(_T("InstLabelColor%d"), i + 1), &config, "#000000");
                     DummyColor.Set(config);
-                    instp->m_LabelFont.SetChosenFont(DummyFont);
-                    instp->m_LabelFont.SetColour(DummyColor);
+                    style.m_LabelFont.SetChosenFont(DummyFont);
+                    style.m_LabelFont.SetColour(DummyColor);
 
                     pConf->Read(wxString::Format(_T("InstSmallFont%d"), i + 1), &config, SmallFont);
                     LoadFont(&pDF, config);
                     pConf->Read(wxString::Format(_T("InstSmallColor%d"), i + 1), &config, "#000000");
                     DummyColor.Set(config);
-                    instp->m_SmallFont.SetChosenFont(DummyFont);
-                    instp->m_SmallFont.SetColour(DummyColor);
+                    style.m_SmallFont.SetChosenFont(DummyFont);
+                    style.m_SmallFont.SetColour(DummyColor);
 
                     pConf->Read(wxString::Format(_T("TitlelBackColor%d"), i + 1), &config, "DASHL");
-                    instp->m_TitlelBackgroundColour.Set(config);
+                    style.m_TitlelBackgroundColour.Set(config);
 
                     pConf->Read(wxString::Format(_T("DataBackColor%d"), i + 1), &config, "DASHB");
-                    instp->m_DataBackgroundColour.Set(config);
+                    style.m_DataBackgroundColour.Set(config);
 
                     pConf->Read(wxString::Format(_T("ArrowFirst%d"), i + 1), &config, "DASHN");
-                    instp->m_Arrow_First_Colour.Set(config);
+                    style.m_Arrow_First_Colour.Set(config);
 
                     pConf->Read(wxString::Format(_T("ArrowSecond%d"), i + 1), &config, "BLUE3");
-                    instp->m_Arrow_Second_Colour.Set(config);
+                    style.m_Arrow_Second_Colour.Set(config);
 
+                    instp->SetStyle(style);
+                    instp->m_bDirty = false;
                     Property.Add(instp);
                 }
             }
@@ -4558,6 +5152,11 @@ bool dashboard_pi::LoadConfig(void) {
         DashboardWindowContainer *cont =
             new DashboardWindowContainer(NULL, caption, orient, ar, b_Size, b_Position, b_Style, Property);
         cont->m_bPersVisible = b_persist;
+        // The group is what was just read
+        cont->m_bDirty = b_skipped;
+        cont->m_iConfigGroup = k + 1;
+        cont->m_SavedSize = b_Size;
+        cont->m_SavedPosition = b_Position;
 
         if (b_persist) b_onePersisted = true;
 
@@ -4567,8 +5166,12 @@ bool dashboard_pi::LoadConfig(void) {
       // Make sure at least one dashboard is scheduled to be visible
       if (m_ArrayOfDashboardWindow.Count() && !b_onePersisted) {
         DashboardWindowContainer *cont = m_ArrayOfDashboardWindow.Item(0);
-        if (cont) cont->m_bPersVisible = true;
+        if (cont) {
+          cont->m_bPersVisible = true;
+          cont->m_bDirty = true;
+        }
       }
+      WriteLayoutSnapshot(hash);
     }
 
     return true;
@@ -4576,6 +5179,35 @@ bool dashboard_pi::LoadConfig(void) {
     return false;
 }
 
+// Optional per-boat source order, best first, using the default source
+// numbers of the group. E.g. prefer DPT over N2K depth:
+// [PlugIns/Dashboard/Priority]
+// Depth=4,1
+void dashboard_pi::LoadPriorityOrder(wxFileConfig *pConf) {
+  m_Priority.ResetOrder();
+  pConf->SetPath(_T("/PlugIns/Dashboard/Priority"));
+  for (int g = 0; g < PG_LAST; g++) {
+    wxString name = wxString::FromAscii(PriorityArbiter::GetGroupName(g));
+    wxString order;
+    if (!pConf->Read(name, &order)) continue;
+
+    std::vector<int> sources;
+    wxStringTokenizer tkz(order, _T(","));
+    while (tkz.HasMoreTokens()) {
+      wxString token = tkz.GetNextToken().Trim().Trim(false);
+      long source;
+      if (token.ToLong(&source))
+        sources.push_back((int)source);
+      else
+        wxLogMessage(_T("Dashboard: Unknown source %s in priority %s=%s"),
+                     token, name, order);
+    }
+    if (!m_Priority.SetOrder(g, sources))
+      wxLogMessage(_T("Dashboard: Invalid source priority %s=%s"), name, order);
+  }
+  pConf->SetPath(_T("/PlugIns/Dashboard"));
+}
+
 void dashboard_pi::LoadFont(wxFont **target, wxString native_info) {
   if (!native_info.IsEmpty()) {
 #ifdef __OCPN__ANDROID__
@@ -4587,151 +5219,330 @@ void dashboard_pi::LoadFont(wxFont **target, wxString native_info) {
   }
 }
 
+// The snapshot holds the layout as LoadConfig() reads it from the config, in
+// the order of the keys there. Shared keys like TemperatureUnit are stored
+// once.
+void dashboard_pi::WriteLayoutSnapshot(uint64_t hash) {
+  LayoutSnapshot s;
+  wxFontData *fonts[] = {g_pUSFontTitle, g_pUSFontData, g_pUSFontLabel,
+                         g_pUSFontSmall};
+  for (int i = 0; i < 4; i++) {
+    s.PutFont(fonts[i]->GetChosenFont());
+    s.PutColour(fonts[i]->GetColour());
+  }
+  s.PutInt(g_iDashSpeedMax);
+  s.PutInt(g_iDashCOGDamp);
+  s.PutInt(g_iDashSpeedUnit);
+  s.PutInt(g_iDashSOGDamp);
+  s.PutInt(g_iDashDepthUnit);
+  s.PutDouble(g_dDashDBTOffset);
+  s.PutInt(g_iDashDistanceUnit);
+  s.PutInt(g_iDashWindSpeedUnit);
+  s.PutInt(g_bDBtrueWindGround);
+  s.PutInt(g_iUTCOffset);
+  s.PutInt(g_iDashWindHistorySpan);
+  s.PutInt(g_iDashBaroHistorySpan);
+  s.PutInt(g_dashPrefWidth);
+  s.PutInt(g_dashPrefHeight);
+  s.PutInt(m_ShowDashboards);
+  s.PutInt(g_iDashTachometerMax);
+  s.PutInt(g_iDashTemperatureUnit);
+  s.PutInt(g_iDashPressureUnit);
+  s.PutInt(dualEngine);
+  s.PutInt(twentyFourVolts);
+
+  s.PutInt(m_ArrayOfDashboardWindow.GetCount());
+  for (size_t i = 0; i < m_ArrayOfDashboardWindow.GetCount(); i++) {
+    DashboardWindowContainer *cont = m_ArrayOfDashboardWindow.Item(i);
+    s.PutString(cont->m_sCaption);
+    s.PutString(cont->m_sOrientation);
+    s.PutInt(cont->m_bPersVisible);
+    s.PutInt(cont->m_SavedSize.x);
+    s.PutInt(cont->m_SavedSize.y);
+    s.PutInt(cont->m_SavedPosition.x);
+    s.PutInt(cont->m_SavedPosition.y);
+    s.PutInt(cont->m_Style);
+    s.PutInt(cont->m_bDirty);
+    s.PutInt(cont->m_aInstrumentList.GetCount());
+    for (size_t j = 0; j < cont->m_aInstrumentList.GetCount(); j++)
+      s.PutInt(cont->m_aInstrumentList.Item(j));
+    s.PutInt(cont->m_aInstrumentPropertyList.GetCount());
+    for (size_t j = 0; j < cont->m_aInstrumentPropertyList.GetCount(); j++) {
+      InstrumentProperties *Inst = cont->m_aInstrumentPropertyList.Item(j);
+      const InstrumentStyle &style = Inst->Style();
+      s.PutInt(Inst->m_aInstrument);
+      s.PutInt(Inst->m_Listplace);
+      s.PutFont(style.m_TitelFont.GetChosenFont());
+      s.PutColour(style.m_TitelFont.GetColour());
+      s.PutFont(style.m_DataFont.GetChosenFont());
+      s.PutColour(style.m_DataFont.GetColour());
+      s.PutFont(style.m_LabelFont.GetChosenFont());
+      s.PutColour(style.m_LabelFont.GetColour());
+      s.PutFont(style.m_SmallFont.GetChosenFont());
+      s.PutColour(style.m_SmallFont.GetColour());
+      s.PutColour(style.m_TitlelBackgroundColour);
+      s.PutColour(style.m_DataBackgroundColour);
+      s.PutColour(style.m_Arrow_First_Colour);
+      s.PutColour(style.m_Arrow_Second_Colour);
+    }
+  }
+  s.Save(LAYOUT_SNAPSHOT_FILE, hash);
+}
+
+// False if the snapshot is unusable, LoadConfig() then reads the config
+bool dashboard_pi::ReadLayoutSnapshot(LayoutSnapshot &s, double scaler) {
+  wxFont fonts[4];
+  wxColour colours[4];
+  for (int i = 0; i < 4; i++) {
+    fonts[i] = s.GetFont();
+    colours[i] = s.GetColour();
+  }
+  g_iDashSpeedMax = s.GetInt();
+  g_iDashCOGDamp = s.GetInt();
+  g_iDashSpeedUnit = s.GetInt();
+  g_iDashSOGDamp = s.GetInt();
+  g_iDashDepthUnit = s.GetInt();
+  g_dDashDBTOffset = s.GetDouble();
+  g_iDashDistanceUnit = s.GetInt();
+  g_iDashWindSpeedUnit = s.GetInt();
+  g_bDBtrueWindGround = s.GetInt() != 0;
+  g_iUTCOffset = s.GetInt();
+  g_iDashWindHistorySpan = s.GetInt();
+  g_iDashBaroHistorySpan = s.GetInt();
+  g_dashPrefWidth = s.GetInt();
+  g_dashPrefHeight = s.GetInt();
+  m_ShowDashboards = s.GetInt() != 0;
+  g_iDashTachometerMax = s.GetInt();
+  g_iDashTemperatureUnit = s.GetInt();
+  g_iDashTempUnit = g_iDashTemperatureUnit;
+  g_iDashPressureUnit = s.GetInt();
+  dualEngine = s.GetInt() != 0;
+  twentyFourVolts = s.GetInt() != 0;
+
+  wxArrayOfDashboard dashboards;
+  int d_cnt = s.GetInt();
+  for (int k = 0; k < d_cnt && s.IsOk(); k++) {
+    wxString caption = s.GetString();
+    wxString orient = s.GetString();
+    bool b_persist = s.GetInt() != 0;
+    wxSize b_Size;
+    b_Size.x = s.GetInt();
+    b_Size.y = s.GetInt();
+    wxPoint b_Position;
+    b_Position.x = s.GetInt();
+    b_Position.y = s.GetInt();
+    long b_Style = s.GetInt();
+    bool b_dirty = s.GetInt() != 0;
+    wxArrayInt ar;
+    int i_cnt = s.GetInt();
+    for (int i = 0; i < i_cnt && s.IsOk(); i++) ar.Add(s.GetInt());
+    wxArrayOfInstrumentProperties Property;
+    int p_cnt = s.GetInt();
+    for (int i = 0; i < p_cnt && s.IsOk(); i++) {
+      int id = s.GetInt();
+      InstrumentProperties *instp = new InstrumentProperties(id, s.GetInt());
+      InstrumentStyle style = instp->Style();
+      style.m_TitelFont.SetChosenFont(s.GetFont());
+      style.m_TitelFont.SetColour(s.GetColour());
+      style.m_DataFont.SetChosenFont(s.GetFont());
+      style.m_DataFont.SetColour(s.GetColour());
+      style.m_LabelFont.SetChosenFont(s.GetFont());
+      style.m_LabelFont.SetColour(s.GetColour());
+      style.m_SmallFont.SetChosenFont(s.GetFont());
+      style.m_SmallFont.SetColour(s.GetColour());
+      style.m_TitlelBackgroundColour = s.GetColour();
+      style.m_DataBackgroundColour = s.GetColour();
+      style.m_Arrow_First_Colour = s.GetColour();
+      style.m_Arrow_Second_Colour = s.GetColour();
+      instp->SetStyle(style);
+      instp->m_bDirty = false;
+      Property.Add(instp);
+    }
+    DashboardWindowContainer *cont = new DashboardWindowContainer(
+        NULL, caption, orient, ar, b_Size, b_Position, b_Style, Property);
+    cont->m_bPersVisible = b_persist;
+    cont->m_bDirty = b_dirty;
+    cont->m_iConfigGroup = k + 1;
+    cont->m_SavedSize = b_Size;
+    cont->m_SavedPosition = b_Position;
+    dashboards.Add(cont);
+  }
+  if (!s.IsOk()) {
+    for (size_t i = 0; i < dashboards.GetCount(); i++) delete dashboards[i];
+    return false;
+  }
+
+  SetGlobalFont(g_pFontTitle, g_FontTitle, g_pUSFontTitle, fonts[0],
+                colours[0], scaler);
+  SetGlobalFont(g_pFontData, g_FontData, g_pUSFontData, fonts[1], colours[1],
+                scaler);
+  SetGlobalFont(g_pFontLabel, g_FontLabel, g_pUSFontLabel, fonts[2],
+                colours[2], scaler);
+  SetGlobalFont(g_pFontSmall, g_FontSmall, g_pUSFontSmall, fonts[3],
+                colours[3], scaler);
+  m_ArrayOfDashboardWindow.Clear();
+  m_ArrayOfDashboardWindow = dashboards;
+  m_config_version = 2;
+  return true;
+}
+
+// Only the changed parts of the config are written: the global keys when
+// m_bGlobalConfigDirty, a whole DashboardN group when its container is dirty
+// or moved to another n, else only the instruments with changed styles and
+// a changed window geometry.
 bool dashboard_pi::SaveConfig(void) {
   wxFileConfig *pConf = (wxFileConfig *)m_pconfig;
+  m_iSaveConfigTicks = 0;
 
   if (pConf) {
+    int d_cnt = (int)m_ArrayOfDashboardWindow.GetCount();
     pConf->SetPath(_T("/PlugIns/Dashboard"));
-    pConf->Write(_T("Version"), _T("2"));
-    pConf->Write(_T("FontTitle"), g_pUSFontTitle->GetChosenFont().GetNativeFontInfoDesc());
-    pConf->Write(_T("ColorTitle"), g_pUSFontTitle->GetColour().GetAsString(wxC2S_HTML_SYNTAX));
-    pConf->Write(_T("FontData"), g_pUSFontData->GetChosenFont().GetNativeFontInfoDesc());
-    pConf->Write(_T("ColorData"), g_pUSFontData->GetColour().GetAsString(wxC2S_HTML_SYNTAX));
-    pConf->Write(_T("FontLabel"), g_pUSFontLabel->GetChosenFont().GetNativeFontInfoDesc());
-    pConf->Write(_T("ColorLabel"), g_pUSFontLabel->GetColour().GetAsString(wxC2S_HTML_SYNTAX));
-    pConf->Write(_T("FontSmall"), g_pUSFontSmall->GetChosenFont().GetNativeFontInfoDesc());
-    pConf->Write(_T("ColorSmall"), g_pUSFontSmall->GetColour().GetAsString(wxC2S_HTML_SYNTAX));
-    pConf->Write(_T("SpeedometerMax"), g_iDashSpeedMax);
-    pConf->Write(_T("COGDamp"), g_iDashCOGDamp);
-    pConf->Write(_T("SpeedUnit"), g_iDashSpeedUnit);
-    pConf->Write(_T("SOGDamp"), g_iDashSOGDamp);
-    pConf->Write(_T("DepthUnit"), g_iDashDepthUnit);
-    pConf->Write(_T("DepthOffset"), g_dDashDBTOffset);
-    pConf->Write(_T("DistanceUnit"), g_iDashDistanceUnit);
-    pConf->Write(_T("WindSpeedUnit"), g_iDashWindSpeedUnit);
-    pConf->Write(_T("UTCOffset"), g_iUTCOffset);
-    pConf->Write(_T("UseSignKtruewind"), g_bDBtrueWindGround);
-    pConf->Write(_T("TemperatureUnit"), g_iDashTempUnit);
-    pConf->Write(_T("PrefWidth"), g_dashPrefWidth);
-    pConf->Write(_T("PrefHeight"), g_dashPrefHeight);
-    pConf->Write(_T("ShowDashboards"), m_ShowDashboards);
-    // Engine
-    pConf->Write(_T("TachometerMax"), g_iDashTachometerMax);
-    pConf->Write(_T("TemperatureUnit"), g_iDashTemperatureUnit);
-    pConf->Write(_T("PressureUnit"), g_iDashPressureUnit);
-    pConf->Write(_T("DualEngine"), dualEngine);
-    pConf->Write(_T("TwentyFourVolt"), twentyFourVolts);
-
-    pConf->Write(_T("DashboardCount" ),
-                 (int)m_ArrayOfDashboardWindow.GetCount());
-    // Delete old Dashborads
-    for (size_t i = m_ArrayOfDashboardWindow.GetCount(); i < 20; i++) {
-        if (pConf->Exists(wxString::Format(_T("/PlugIns/Dashboard/Dashboard%zu"), i + 1)))
-        {
-            pConf->DeleteGroup(wxString::Format(_T("/PlugIns/Dashboard/Dashboard%zu"), i + 1));
-        }
+    if (m_bGlobalConfigDirty) {
+      pConf->Write(_T("Version"), _T("2"));
+      pConf->Write(_T("FontTitle"), g_pUSFontTitle->GetChosenFont().GetNativeFontInfoDesc());
+      pConf->Write(_T("ColorTitle"), g_pUSFontTitle->GetColour().GetAsString(wxC2S_HTML_SYNTAX));
+      pConf->Write(_T("FontData"), g_pUSFontData->GetChosenFont().GetNativeFontInfoDesc());
+      pConf->Write(_T("ColorData"), g_pUSFontData->GetColour().GetAsString(wxC2S_HTML_SYNTAX));
+      pConf->Write(_T("FontLabel"), g_pUSFontLabel->GetChosenFont().GetNativeFontInfoDesc());
+      pConf->Write(_T("ColorLabel"), g_pUSFontLabel->GetColour().GetAsString(wxC2S_HTML_SYNTAX));
+      pConf->Write(_T("FontSmall"), g_pUSFontSmall->GetChosenFont().GetNativeFontInfoDesc());
+      pConf->Write(_T("ColorSmall"), g_pUSFontSmall->GetColour().GetAsString(wxC2S_HTML_SYNTAX));
+      pConf->Write(_T("SpeedometerMax"), g_iDashSpeedMax);
+      pConf->Write(_T("COGDamp"), g_iDashCOGDamp);
+      pConf->Write(_T("SpeedUnit"), g_iDashSpeedUnit);
+      pConf->Write(_T("SOGDamp"), g_iDashSOGDamp);
+      pConf->Write(_T("DepthUnit"), g_iDashDepthUnit);
+      pConf->Write(_T("DepthOffset"), g_dDashDBTOffset);
+      pConf->Write(_T("DistanceUnit"), g_iDashDistanceUnit);
+      pConf->Write(_T("WindSpeedUnit"), g_iDashWindSpeedUnit);
+      pConf->Write(_T("UTCOffset"), g_iUTCOffset);
+      pConf->Write(_T("WindHistorySpan"), g_iDashWindHistorySpan);
+      pConf->Write(_T("BaroHistorySpan"), g_iDashBaroHistorySpan);
+      pConf->Write(_T("UseSignKtruewind"), g_bDBtrueWindGround);
+      pConf->Write(_T("TemperatureUnit"), g_iDashTempUnit);
+      pConf->Write(_T("PrefWidth"), g_dashPrefWidth);
+      pConf->Write(_T("PrefHeight"), g_dashPrefHeight);
+      pConf->Write(_T("ShowDashboards"), m_ShowDashboards);
+      // Engine
+      pConf->Write(_T("TachometerMax"), g_iDashTachometerMax);
+      pConf->Write(_T("TemperatureUnit"), g_iDashTemperatureUnit);
+      pConf->Write(_T("PressureUnit"), g_iDashPressureUnit);
+      pConf->Write(_T("DualEngine"), dualEngine);
+      pConf->Write(_T("TwentyFourVolt"), twentyFourVolts);
+      m_bGlobalConfigDirty = false;
     }
-    for (size_t i = 0; i < m_ArrayOfDashboardWindow.GetCount(); i++) {
+    int old_cnt;
+    pConf->Read(_T("DashboardCount"), &old_cnt, -1);
+    if (old_cnt != d_cnt) {
+      pConf->Write(_T("DashboardCount"), d_cnt);
+      DeleteStaleDashboardGroups(pConf, d_cnt);
+    }
+
+    for (int i = 0; i < d_cnt; i++) {
       DashboardWindowContainer *cont = m_ArrayOfDashboardWindow.Item(i);
+      if (cont->m_bDirty || cont->m_iConfigGroup != i + 1) {
+        SaveDashboardGroup(pConf, cont, i + 1);
+        continue;
+      }
       pConf->SetPath(
-          wxString::Format(_T("/PlugIns/Dashboard/Dashboard%zu"), i + 1));
-      pConf->Write(_T("Caption"), cont->m_sCaption);
-      pConf->Write(_T("Orientation"), cont->m_sOrientation);
-      pConf->Write(_T("Persistence"), cont->m_bPersVisible);
-      pConf->Write(_T("SizeX"), cont->m_pDashboardWindow->GetSize().GetX());
-      pConf->Write(_T("SizeY"), cont->m_pDashboardWindow->GetSize().GetY());
-      pConf->Write(_T("PositionX"), cont->m_pDashboardWindow->GetPosition().x);
-      pConf->Write(_T("PositionY"), cont->m_pDashboardWindow->GetPosition().y);
-      pConf->Write(_T("Style"), cont->m_Style);
-      pConf->Write(_T("InstrumentCount"),
-                   (int)cont->m_aInstrumentList.GetCount());
-      // Delete old Instruments
-      for (size_t i = cont->m_aInstrumentList.GetCount(); i < 40; i++) {
-          if (pConf->Exists(wxString::Format(_T("Instrument%zu"), i + 1)))
-          {
-              pConf->DeleteEntry(wxString::Format(_T("Instrument%zu"), i + 1));
-              if (pConf->Exists(wxString::Format(_T("InstTitelFont%zu"), i + 1)))
-              {
-                  pConf->DeleteEntry(wxString::Format(_T("InstTitelFont%zu"), i + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("InstTitelColor%zu"), i + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("InstDataFont%zu"), i + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("InstDataColor%zu"), i + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("InstLabelFont%zu"), i + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("InstLabelColor%zu"), i + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("InstSmallFont%zu"), i + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("InstSmallColor%zu"), i + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("TitlelBackColor%zu"), i + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("DataBackColor%zu"), i + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("ArrowFirst%zu"), i + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("ArrowSecond%zu"), i + 1));
-              }
-          }
+          wxString::Format(_T("/PlugIns/Dashboard/Dashboard%d"), i + 1));
+      if (cont->m_pDashboardWindow) {
+        wxSize size = cont->m_pDashboardWindow->GetSize();
+        wxPoint position = cont->m_pDashboardWindow->GetPosition();
+        if (size != cont->m_SavedSize || position != cont->m_SavedPosition) {
+          pConf->Write(_T("SizeX"), size.GetX());
+          pConf->Write(_T("SizeY"), size.GetY());
+          pConf->Write(_T("PositionX"), position.x);
+          pConf->Write(_T("PositionY"), position.y);
+          cont->m_SavedSize = size;
+          cont->m_SavedPosition = position;
+        }
       }
-      for (size_t j = 0; j < cont->m_aInstrumentList.GetCount(); j++)
-      {
-          pConf->Write(wxString::Format(_T("Instrument%zu"), j + 1), cont->m_aInstrumentList.Item(j));
-          InstrumentProperties* Inst = NULL;
-          // First delete
-          if (pConf->Exists(wxString::Format(_T("InstTitelFont%zu"), j + 1)))
-          {
-              bool Delete = true;
-              for (size_t i = 0; i < cont->m_aInstrumentPropertyList.GetCount(); i++)
-              {
-                  Inst = cont->m_aInstrumentPropertyList.Item(i);
-                  if (Inst->m_Listplace == (int)j)
-                  {
-                      Delete = false;
-                      break;
-                  }                  
-              }
-              if (Delete)
-              {
-                  pConf->DeleteEntry(wxString::Format(_T("InstTitelFont%zu"), j + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("InstTitelColor%zu"), j + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("InstDataFont%zu"), j + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("InstDataColor%zu"), j + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("InstLabelFont%zu"), j + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("InstLabelColor%zu"), j + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("InstSmallFont%zu"), j + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("InstSmallColor%zu"), j + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("TitlelBackColor%zu"), i + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("DataBackColor%zu"), i + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("ArrowFirst%zu"), i + 1));
-                  pConf->DeleteEntry(wxString::Format(_T("ArrowSecond%zu"), i + 1));
-              }
-          }
-          Inst = NULL;
-          for (size_t i = 0; i < (cont->m_aInstrumentPropertyList.GetCount()); i++)
-          {
-              Inst = cont->m_aInstrumentPropertyList.Item(i);
-              if (Inst->m_Listplace == (int)j)
-              {
-                  pConf->Write(wxString::Format(_T("InstTitelFont%zu"), j + 1), Inst->m_TitelFont.GetChosenFont().GetNativeFontInfoDesc());
-                  pConf->Write(wxString::Format(_T("InstTitelColor%zu"), j + 1), Inst->m_TitelFont.GetColour().GetAsString(wxC2S_HTML_SYNTAX));
-                  pConf->Write(wxString::Format(_T("InstDataFont%zu"), j + 1), Inst->m_DataFont.GetChosenFont().GetNativeFontInfoDesc());
-                  pConf->Write(wxString::Format(_T("InstDataColor%zu"), j + 1), Inst->m_DataFont.GetColour().GetAsString(wxC2S_HTML_SYNTAX));
-                  pConf->Write(wxString::Format(_T("InstLabelFont%zu"), j + 1), Inst->m_LabelFont.GetChosenFont().GetNativeFontInfoDesc());
-                  pConf->Write(wxString::Format(_T("InstLabelColor%zu"), j + 1), Inst->m_LabelFont.GetColour().GetAsString(wxC2S_HTML_SYNTAX));
-                  pConf->Write(wxString::Format(_T("InstSmallFont%zu"), j + 1), Inst->m_SmallFont.GetChosenFont().GetNativeFontInfoDesc());
-                  pConf->Write(wxString::Format(_T("InstSmallColor%zu"), j + 1), Inst->m_SmallFont.GetColour().GetAsString(wxC2S_HTML_SYNTAX));
-                  pConf->Write(wxString::Format(_T("TitlelBackColor%zu"), j + 1), Inst->m_TitlelBackgroundColour.GetAsString(wxC2S_HTML_SYNTAX));
-                  pConf->Write(wxString::Format(_T("DataBackColor%zu"), j + 1), Inst->m_DataBackgroundColour.GetAsString(wxC2S_HTML_SYNTAX));
-                  pConf->Write(wxString::Format(_T("ArrowFirst%zu"), j + 1), Inst->m_Arrow_First_Colour.GetAsString(wxC2S_HTML_SYNTAX));
-                  pConf->Write(wxString::Format(_T("ArrowSecond%zu"), j + 1), Inst->m_Arrow_Second_Colour.GetAsString(wxC2S_HTML_SYNTAX));
-                  break;
-              }
-          }
+      for (size_t j = 0; j < cont->m_aInstrumentPropertyList.GetCount(); j++) {
+        InstrumentProperties *Inst = cont->m_aInstrumentPropertyList.Item(j);
+        if (Inst->m_bDirty) SaveInstrumentProperties(pConf, Inst);
       }
     }
+    WriteLayoutSnapshot(LayoutSnapshot::HashConfig(
+        pConf, _T("/PlugIns/Dashboard"), m_sLayoutSalt));
     return true;
   } else
     return false;
 }
 
+// Rewrite the group of a dashboard, dropping the keys of removed instruments
+void dashboard_pi::SaveDashboardGroup(wxFileConfig *pConf,
+                                      DashboardWindowContainer *cont,
+                                      int group) {
+  pConf->SetPath(_T("/PlugIns/Dashboard"));
+  pConf->DeleteGroup(wxString::Format(_T("Dashboard%d"), group));
+  pConf->SetPath(
+      wxString::Format(_T("/PlugIns/Dashboard/Dashboard%d"), group));
+  pConf->Write(_T("Caption"), cont->m_sCaption);
+  pConf->Write(_T("Orientation"), cont->m_sOrientation);
+  pConf->Write(_T("Persistence"), cont->m_bPersVisible);
+  if (cont->m_pDashboardWindow) {
+    cont->m_SavedSize = cont->m_pDashboardWindow->GetSize();
+    cont->m_SavedPosition = cont->m_pDashboardWindow->GetPosition();
+  }
+  pConf->Write(_T("SizeX"), cont->m_SavedSize.GetX());
+  pConf->Write(_T("SizeY"), cont->m_SavedSize.GetY());
+  pConf->Write(_T("PositionX"), cont->m_SavedPosition.x);
+  pConf->Write(_T("PositionY"), cont->m_SavedPosition.y);
+  pConf->Write(_T("Style"), cont->m_Style);
+  pConf->Write(_T("InstrumentCount"), (int)cont->m_aInstrumentList.GetCount());
+  for (size_t j = 0; j < cont->m_aInstrumentList.GetCount(); j++)
+    pConf->Write(wxString::Format(_T("Instrument%zu"), j + 1),
+                 cont->m_aInstrumentList.Item(j));
+  for (size_t j = 0; j < cont->m_aInstrumentPropertyList.GetCount(); j++)
+    SaveInstrumentProperties(pConf, cont->m_aInstrumentPropertyList.Item(j));
+  cont->m_bDirty = false;
+  cont->m_iConfigGroup = group;
+}
+
+// The current path must be the group of the dashboard of 'Inst'
+void dashboard_pi::SaveInstrumentProperties(wxFileConfig *pConf,
+                                            InstrumentProperties *Inst) {
+  int n = Inst->m_Listplace + 1;
+  pConf->Write(wxString::Format(_T("InstTitelFont%d"), n), Inst->Style().m_TitelFont.GetChosenFont().GetNativeFontInfoDesc());
+  pConf->Write(wxString::Format(_T("InstTitelColor%d"), n), Inst->Style().m_TitelFont.GetColour().GetAsString(wxC2S_HTML_SYNTAX));
+  pConf->Write(wxString::Format(_T("InstDataFont%d"), n), Inst->Style().m_DataFont.GetChosenFont().GetNativeFontInfoDesc());
+  pConf->Write(wxString::Format(_T("InstDataColor%d"), n), Inst->Style().m_DataFont.GetColour().GetAsString(wxC2S_HTML_SYNTAX));
+  pConf->Write(wxString::Format(_T("InstLabelFont%d"), n), Inst->Style().m_LabelFont.GetChosenFont().GetNativeFontInfoDesc());
+  pConf->Write(wxString::Format(_T("InstLabelColor%d"), n), Inst->Style().m_LabelFont.GetColour().GetAsString(wxC2S_HTML_SYNTAX));
+  pConf->Write(wxString::Format(_T("InstSmallFont%d"), n), Inst->Style().m_SmallFont.GetChosenFont().GetNativeFontInfoDesc());
+  pConf->Write(wxString::Format(_T("InstSmallColor%d"), n), Inst->Style().m_SmallFont.GetColour().GetAsString(wxC2S_HTML_SYNTAX));
+  pConf->Write(wxString::Format(_T("TitlelBackColor%d"), n), Inst->Style().m_TitlelBackgroundColour.GetAsString(wxC2S_HTML_SYNTAX));
+  pConf->Write(wxString::Format(_T("DataBackColor%d"), n), Inst->Style().m_DataBackgroundColour.GetAsString(wxC2S_HTML_SYNTAX));
+  pConf->Write(wxString::Format(_T("ArrowFirst%d"), n), Inst->Style().m_Arrow_First_Colour.GetAsString(wxC2S_HTML_SYNTAX));
+  pConf->Write(wxString::Format(_T("ArrowSecond%d"), n), Inst->Style().m_Arrow_Second_Colour.GetAsString(wxC2S_HTML_SYNTAX));
+  Inst->m_bDirty = false;
+}
+
+// Delete the DashboardN groups with n > count in one pass over the groups
+void dashboard_pi::DeleteStaleDashboardGroups(wxFileConfig *pConf,
+                                              int count) {
+  wxArrayString stale;
+  wxString name, number;
+  long index, n;
+  pConf->SetPath(_T("/PlugIns/Dashboard"));
+  for (bool more = pConf->GetFirstGroup(name, index); more;
+       more = pConf->GetNextGroup(name, index)) {
+    if (name.StartsWith(_T("Dashboard"), &number) && number.ToLong(&n) &&
+        n > count)
+      stale.Add(name);
+  }
+  // Deleting while enumerating would invalidate the index
+  for (size_t i = 0; i < stale.GetCount(); i++) pConf->DeleteGroup(stale[i]);
+}
+
 void dashboard_pi::ApplyConfig(void) {
+  // Font colours may have changed in the preferences
+  ResetInstrumentPalettes();
   // Reverse order to handle deletes
   for (size_t i = m_ArrayOfDashboardWindow.GetCount(); i > 0; i--) {
     DashboardWindowContainer *cont = m_ArrayOfDashboardWindow.Item(i - 1);
+    ProfileScope scope(g_StartupProfile, _T("ApplyConfig ") + cont->m_sCaption);
     int orient = (cont->m_sOrientation == _T("V") ? wxVERTICAL : wxHORIZONTAL);
     if (cont->m_bIsDeleted) {
       if (cont->m_pDashboardWindow) {
@@ -4797,6 +5608,7 @@ void dashboard_pi::ShowDashboard(size_t id, bool visible) {
     DashboardWindowContainer *cont = m_ArrayOfDashboardWindow.Item(id);
     cont->m_bIsVisible = visible;
     cont->m_bPersVisible = visible;
+    cont->m_bDirty = true;
     if (cont->m_bIsVisible)
         cont->m_pDashboardWindow->Show();
     else
@@ -5365,6 +6177,24 @@ DashboardPreferencesDialog::DashboardPreferencesDialog(
   m_pChoiceTempUnit->SetSize(szTempUnit);
   m_pChoiceTempUnit->SetSelection(g_iDashTempUnit);
   itemFlexGridSizer04->Add(m_pChoiceTempUnit, 0, wxALIGN_RIGHT | wxALL, 0);
+
+  wxStaticText *itemStaticText0d = new wxStaticText(
+      itemPanelNotebook02, wxID_ANY, _("Wind history span (hours):"),
+      wxDefaultPosition, wxDefaultSize, 0);
+  itemFlexGridSizer04->Add(itemStaticText0d, 0, wxEXPAND | wxALL, border_size);
+  m_pSpinWindHistorySpan = new wxSpinCtrl(
+      itemPanelNotebook02, wxID_ANY, wxEmptyString, wxDefaultPosition,
+      wxDefaultSize, wxSP_ARROW_KEYS, 1, 6, g_iDashWindHistorySpan);
+  itemFlexGridSizer04->Add(m_pSpinWindHistorySpan, 0, wxALIGN_RIGHT | wxALL, 0);
+
+  wxStaticText *itemStaticText0e = new wxStaticText(
+      itemPanelNotebook02, wxID_ANY, _("Barometer history span (hours):"),
+      wxDefaultPosition, wxDefaultSize, 0);
+  itemFlexGridSizer04->Add(itemStaticText0e, 0, wxEXPAND | wxALL, border_size);
+  m_pSpinBaroHistorySpan = new wxSpinCtrl(
+      itemPanelNotebook02, wxID_ANY, wxEmptyString, wxDefaultPosition,
+      wxDefaultSize, wxSP_ARROW_KEYS, 1, 48, g_iDashBaroHistorySpan);
+  itemFlexGridSizer04->Add(m_pSpinBaroHistorySpan, 0, wxALIGN_RIGHT | wxALL, 0);
   // Engine Parameters
   // Sets the maximum RPM in the tachometer control
   wxStaticText* itemStaticTextTachometerM = new wxStaticText(itemPanelNotebook02, wxID_ANY, _("Engine Maximum RPM:"),
@@ -5509,6 +6339,8 @@ void DashboardPreferencesDialog::SaveDashboardConfig() {
   g_iDashWindSpeedUnit = m_pChoiceWindSpeedUnit->GetSelection();
   g_bDBtrueWindGround = m_pUseTrueWinddata->GetValue();
   g_iDashTempUnit = m_pChoiceTempUnit->GetSelection();
+  g_iDashWindHistorySpan = m_pSpinWindHistorySpan->GetValue();
+  g_iDashBaroHistorySpan = m_pSpinBaroHistorySpan->GetValue();
   g_iDashTachometerMax = m_pSpinRPMMax->GetValue();
   g_iDashTemperatureUnit = m_pChoiceTemperatureUnit->GetSelection();
   g_iDashPressureUnit = m_pChoicePressureUnit->GetSelection();
@@ -5517,13 +6349,21 @@ void DashboardPreferencesDialog::SaveDashboardConfig() {
 
   if (curSel != -1) {
     DashboardWindowContainer *cont = m_Config.Item(curSel);
-    cont->m_bIsVisible = m_pCheckBoxIsVisible->IsChecked();
-    cont->m_sCaption = m_pTextCtrlCaption->GetValue();
-    cont->m_sOrientation =
+    wxString orientation =
         m_pChoiceOrientation->GetSelection() == 0 ? _T("V") : _T("H");
-    cont->m_aInstrumentList.Clear();
+    wxArrayInt list;
     for (int i = 0; i < m_pListCtrlInstruments->GetItemCount(); i++)
-      cont->m_aInstrumentList.Add((int)m_pListCtrlInstruments->GetItemData(i));
+      list.Add((int)m_pListCtrlInstruments->GetItemData(i));
+    bool changed = cont->m_sCaption != m_pTextCtrlCaption->GetValue() ||
+                   cont->m_sOrientation != orientation ||
+                   cont->m_aInstrumentList.GetCount() != list.GetCount();
+    for (size_t i = 0; !changed && i < list.GetCount(); i++)
+      changed = cont->m_aInstrumentList[i] != list[i];
+    if (changed) cont->m_bDirty = true;
+    cont->m_bIsVisible = m_pCheckBoxIsVisible->IsChecked();
+    cont->m_sCaption = m_pTextCtrlCaption->GetValue();
+    cont->m_sOrientation = orientation;
+    cont->m_aInstrumentList = list;
   }
 }
 
@@ -5708,13 +6548,16 @@ void DashboardPreferencesDialog::OnInstrumentDelete(wxCommandEvent &event) {
               Inst->m_Listplace == itemID)
           {
               cont->m_aInstrumentPropertyList.Remove(Inst);
+              cont->m_bDirty = true;
               InstDel = Inst;
               break;
           }
           else
           {
-              if (Inst->m_Listplace > itemID)
+              if (Inst->m_Listplace > itemID) {
                   Inst->m_Listplace--;
+                  cont->m_bDirty = true;
+              }
           }
       }
   }
@@ -5784,27 +6627,36 @@ void DashboardPreferencesDialog::OnInstrumentEdit(wxCommandEvent &event) {
         if (Edit->m_colourPicker3->GetColour() != dummy) DefaultFont = false;
         GetGlobalColor(_T("BLUE3"), &dummy);
         if (Edit->m_colourPicker4->GetColour() != dummy) DefaultFont = false;
-        if (DefaultFont)
+        if (DefaultFont) {
             cont->m_aInstrumentPropertyList.Remove(Inst);
+            cont->m_bDirty = true;
+        }
         else
         {                      
-            Inst->m_TitelFont = *(Edit->m_fontPicker2->GetFontData());
-            Inst->m_TitelFont.SetChosenFont(Inst->m_TitelFont.GetChosenFont().Scaled(scaler));
-            Inst->m_DataFont = *(Edit->m_fontPicker4->GetFontData());
-            Inst->m_DataFont.SetChosenFont(Inst->m_DataFont.GetChosenFont().Scaled(scaler));
-            Inst->m_LabelFont = *(Edit->m_fontPicker5->GetFontData());
-            Inst->m_LabelFont.SetChosenFont(Inst->m_LabelFont.GetChosenFont().Scaled(scaler));
-            Inst->m_SmallFont = *(Edit->m_fontPicker6->GetFontData());
-            Inst->m_SmallFont.SetChosenFont(Inst->m_SmallFont.GetChosenFont().Scaled(scaler));
-            Inst->m_DataBackgroundColour = Edit->m_colourPicker2->GetColour();
-            Inst->m_TitlelBackgroundColour = Edit->m_colourPicker1->GetColour();
-            Inst->m_Arrow_First_Colour = Edit->m_colourPicker3->GetColour();
-            Inst->m_Arrow_Second_Colour = Edit->m_colourPicker4->GetColour();
+            InstrumentStyle style = Inst->Style();
+            style.m_TitelFont = *(Edit->m_fontPicker2->GetFontData());
+            style.m_TitelFont.SetChosenFont(style.m_TitelFont.GetChosenFont().Scaled(scaler));
+            style.m_DataFont = *(Edit->m_fontPicker4->GetFontData());
+            style.m_DataFont.SetChosenFont(style.m_DataFont.GetChosenFont().Scaled(scaler));
+            style.m_LabelFont = *(Edit->m_fontPicker5->GetFontData());
+            style.m_LabelFont.SetChosenFont(style.m_LabelFont.GetChosenFont().Scaled(scaler));
+            style.m_SmallFont = *(Edit->m_fontPicker6->GetFontData());
+            style.m_SmallFont.SetChosenFont(style.m_SmallFont.GetChosenFont().Scaled(scaler));
+            style.m_DataBackgroundColour = Edit->m_colourPicker2->GetColour();
+            style.m_TitlelBackgroundColour = Edit->m_colourPicker1->GetColour();
+            style.m_Arrow_First_Colour = Edit->m_colourPicker3->GetColour();
+            style.m_Arrow_Second_Colour = Edit->m_colourPicker4->GetColour();
+            Inst->SetStyle(style);
         }
     }
     delete Edit;
     if (cont->m_pDashboardWindow)
     {
+        ResetTextExtentCache();
+        ResetInstrumentPalettes();
+        cont->m_pDashboardWindow->ResetInstrumentCaches();
+        // Fonts are measured when an instrument is created
+        cont->m_pDashboardWindow->RebuildInstrument(Inst);
         wxSize DashSize = cont->m_pDashboardWindow->GetSize();
         cont->m_pDashboardWindow->SetInstrumentList(cont->m_aInstrumentList, &(cont->m_aInstrumentPropertyList));
         cont->m_pDashboardWindow->SetSize(DashSize);
@@ -5833,12 +6685,15 @@ void DashboardPreferencesDialog::OnInstrumentUp(wxCommandEvent &event) {
       for (unsigned int i = 0; i < (cont->m_aInstrumentPropertyList.GetCount()); i++)
       {
           Inst = cont->m_aInstrumentPropertyList.Item(i);
-          if (Inst->m_Listplace  == (itemID - 1))
+          if (Inst->m_Listplace  == (itemID - 1)) {
               Inst->m_Listplace = itemID;
+              cont->m_bDirty = true;
+          }
           if (Inst->m_aInstrument == (int)m_pListCtrlInstruments->GetItemData(itemID) &&
               Inst->m_Listplace == itemID)
           {
               cont->m_aInstrumentPropertyList.Item(i)->m_Listplace = itemID - 1;
+              cont->m_bDirty = true;
           }          
       }
   }
@@ -5875,12 +6730,15 @@ void DashboardPreferencesDialog::OnInstrumentDown(wxCommandEvent &event) {
       for (unsigned int i = 0; i < (cont->m_aInstrumentPropertyList.GetCount()); i++)
       {
           Inst = cont->m_aInstrumentPropertyList.Item(i);
-          if (Inst->m_Listplace == (itemID + 1) && Inst->m_aInstrument != (int)m_pListCtrlInstruments->GetItemData(itemID))
+          if (Inst->m_Listplace == (itemID + 1) && Inst->m_aInstrument != (int)m_pListCtrlInstruments->GetItemData(itemID)) {
               Inst->m_Listplace = itemID;
+              cont->m_bDirty = true;
+          }
           if (Inst->m_aInstrument == (int)m_pListCtrlInstruments->GetItemData(itemID) &&
               Inst->m_Listplace == itemID)
           {
               cont->m_aInstrumentPropertyList.Item(i)->m_Listplace = itemID + 1;
+              cont->m_bDirty = true;
               break;
           }
       }
@@ -6007,6 +6865,8 @@ DashboardWindow::DashboardWindow(wxWindow *pparent, wxWindowID id, dashboard_pi
 
   m_plugin = plugin;
   m_Container = mycont;
+  m_bInstrumentsPending = false;
+  m_PendingProperties = NULL;
 
   // wx2.9      itemBoxSizer = new wxWrapSizer( orient );
   itemBoxSizer = new wxBoxSizer(orient);
@@ -6145,18 +7005,21 @@ void DashboardWindow::OnContextMenuSelect(wxCommandEvent &event) {
           m_Container->m_pDashboardWindow->Hide();
       m_Container->m_pDashboardWindow->SetSize(m_Container->m_Size);
       m_Container->m_pDashboardWindow->SetTitle(m_Container->m_sCaption);
-      m_plugin->SaveConfig();
+      m_Container->m_bDirty = true;
+      m_plugin->ScheduleSaveConfig();
       delete this;
       return;
     }
     case ID_DASH_VERTICAL: {
       ChangePaneOrientation(wxVERTICAL);
       m_Container->m_sOrientation = _T("V");
+      m_Container->m_bDirty = true;
       break;
     }
     case ID_DASH_HORIZONTAL: {
       ChangePaneOrientation(wxHORIZONTAL);
       m_Container->m_sOrientation = _T("H");
+      m_Container->m_bDirty = true;
       break;
     }
     case ID_DASH_UNDOCK: {
@@ -6169,7 +7032,7 @@ void DashboardWindow::OnContextMenuSelect(wxCommandEvent &event) {
       break;
     }
   }
-  m_plugin->SaveConfig();
+  m_plugin->ScheduleSaveConfig();
 }
 
 void DashboardWindow::SetColorScheme(PI_ColorScheme cs) {
@@ -6180,9 +7043,22 @@ void DashboardWindow::SetColorScheme(PI_ColorScheme cs) {
   GetGlobalColor(_T("DASHL"), &col);
   SetBackgroundColour(col);
 
+  ResetInstrumentCaches();
   Refresh(false);
 }
 
+unsigned long DashboardWindow::GetSuppressedRepaints(void) {
+  unsigned long count = 0;
+  for (size_t i = 0; i < m_ArrayOfInstrument.GetCount(); i++)
+    count += m_ArrayOfInstrument.Item(i)->m_pInstrument->GetSuppressedRepaints();
+  return count;
+}
+
+void DashboardWindow::ResetInstrumentCaches(void) {
+  for (size_t i = 0; i < m_ArrayOfInstrument.GetCount(); i++)
+    m_ArrayOfInstrument.Item(i)->m_pInstrument->ResetCache();
+}
+
 void DashboardWindow::ChangePaneOrientation(int orient) {
   SetSizerOrientation(orient);
   bool vertical = orient == wxVERTICAL;
@@ -6214,572 +7090,113 @@ bool isArrayIntEqual(const wxArrayInt &l1, const wxArrayOfInstrument &l2) {
   return true;
 }
 
+// Settings the instrument factories build into the instruments, e.g. the
+// range of the speedometer. Instruments made with other ones are not reused.
+static wxString GetCreateSettings(void) {
+  return wxString::Format(_T("%d/%d/%d/%d"), g_iDashSpeedMax,
+                          g_iDashTachometerMax, g_iDashTemperatureUnit,
+                          g_iDashPressureUnit);
+}
+
 bool DashboardWindow::isInstrumentListEqual(const wxArrayInt &list) {
+  if (m_bInstrumentsPending) {
+    if (list.GetCount() != m_PendingList.GetCount()) return false;
+    for (size_t i = 0; i < list.GetCount(); i++)
+      if (list.Item(i) != m_PendingList.Item(i)) return false;
+    return true;
+  }
+  // Instruments made with other settings are built again
+  wxString settings = GetCreateSettings();
+  for (size_t i = 0; i < m_ArrayOfInstrument.GetCount(); i++)
+    if (m_ArrayOfInstrument.Item(i)->m_CreateSettings != settings) return false;
   return isArrayIntEqual(list, m_ArrayOfInstrument);
 }
 
+bool DashboardWindow::Show(bool show) {
+  if (show && m_bInstrumentsPending) {
+    m_bInstrumentsPending = false;
+    // Keep the size ApplyConfig did set, the build fits the window
+    wxSize size = GetSize();
+    BuildInstrumentList(m_PendingList, m_PendingProperties);
+    m_PendingList.Clear();
+    SetSize(size);
+  }
+  return wxDialog::Show(show);
+}
+
+// A hidden window which was never shown only keeps the list, its instruments
+// are built when it is shown. Until then it has no instruments, so it gets
+// no data either. Once built, a new list only changes what differs.
 void DashboardWindow::SetInstrumentList(wxArrayInt list, wxArrayOfInstrumentProperties* InstrumentPropertyList) {
-  /* options
-   ID_DBP_D_SOG: config max value, show STW optional
-   ID_DBP_D_COG:  +SOG +HDG? +BRG?
-   ID_DBP_D_AWS: config max value. Two arrows for AWS+TWS?
-   ID_DBP_D_VMG: config max value
-   ID_DBP_I_DPT: config unit (meter, feet, fathoms)
-   ID_DBP_D_DPT: show temp optional
-   // compass: use COG or HDG
-   // velocity range
-   // rudder range
-
-   */
-  InstrumentProperties *Properties;
+  if (IsShown() || !m_ArrayOfInstrument.IsEmpty()) {
+    m_bInstrumentsPending = false;
+    m_PendingList.Clear();
+    BuildInstrumentList(list, InstrumentPropertyList);
+    return;
+  }
+  m_PendingList = list;
+  m_PendingProperties = InstrumentPropertyList;
+  m_bInstrumentsPending = true;
+}
+
+void DashboardWindow::BuildInstrumentList(
+    const wxArrayInt &list,
+    wxArrayOfInstrumentProperties *InstrumentPropertyList) {
+  // Instruments of the old list are reused when id, properties and create
+  // settings match, so they keep their history and caches. The others are
+  // deleted before the new ones are created, a new history instrument then
+  // takes over the history file. The sizer only holds the order and is
+  // filled again.
+  wxString settings = GetCreateSettings();
+  wxArrayOfInstrument old = m_ArrayOfInstrument;
   m_ArrayOfInstrument.Clear();
-  itemBoxSizer->Clear(true);
+  itemBoxSizer->Clear(false);
+  std::vector<InstrumentProperties *> properties(list.GetCount(), NULL);
+  std::vector<DashboardInstrumentContainer *> reused(list.GetCount(), NULL);
   for (size_t i = 0; i < list.GetCount(); i++) {
     int id = list.Item(i);
-    Properties = NULL;
     for (size_t j = 0; j < InstrumentPropertyList->GetCount(); j++)
     {
         if (InstrumentPropertyList->Item(j)->m_aInstrument == id && InstrumentPropertyList->Item(j)->m_Listplace == (int)i)
         {
-            Properties = InstrumentPropertyList->Item(j);
+            properties[i] = InstrumentPropertyList->Item(j);
             break;
         }
     }
-    DashboardInstrument *instrument = NULL;
-    switch (id) {
-      case ID_DBP_I_POS:
-        instrument = new DashboardInstrument_Position(this, wxID_ANY,
-                                                      getInstrumentCaption(id), Properties);
-        break;
-      case ID_DBP_I_SOG:
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_SOG,
-            _T("%5.1f"));
-        break;
-      case ID_DBP_D_SOG:
-        instrument = new DashboardInstrument_Speedometer(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_SOG, 0,
-            g_iDashSpeedMax);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionLabel(g_iDashSpeedMax / 20 + 1, DIAL_LABEL_HORIZONTAL);
-        //(DashboardInstrument_Dial *)instrument->SetOptionMarker(0.1,
-        //DIAL_MARKER_SIMPLE, 5);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionMarker(0.5, DIAL_MARKER_SIMPLE, 2);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionExtraValue(OCPN_DBP_STC_STW, _T("STW\n%.2f"),
-                                  DIAL_POSITION_BOTTOMLEFT);
-        break;
-      case ID_DBP_I_COG:
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_COG,
-            _T("%03.0f"));
-        break;
-      case ID_DBP_M_COG:
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_MCOG,
-            _T("%03.0f"));
-        break;
-      case ID_DBP_D_COG:
-        instrument = new DashboardInstrument_Compass(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_COG);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionMarker(5, DIAL_MARKER_SIMPLE, 2);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionLabel(30, DIAL_LABEL_ROTATED);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionExtraValue(OCPN_DBP_STC_SOG, _T("SOG\n%.2f"),
-                                  DIAL_POSITION_BOTTOMLEFT);
-        break;
-      case ID_DBP_D_HDT:
-        instrument = new DashboardInstrument_Compass(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_HDT);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionMarker(5, DIAL_MARKER_SIMPLE, 2);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionLabel(30, DIAL_LABEL_ROTATED);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionExtraValue(OCPN_DBP_STC_STW, _T("STW\n%.1f"),
-                                  DIAL_POSITION_BOTTOMLEFT);
-        break;
-      case ID_DBP_I_STW:
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_STW,
-            _T("%.1f"));
-        break;
-      case ID_DBP_I_HDT:  // true heading
-        // TODO: Option True or Magnetic
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_HDT,
-            _T("%03.0f"));
-        break;
-      case ID_DBP_I_HDM:  // magnetic heading
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_HDM,
-            _T("%03.0f"));
-        break;
-      case ID_DBP_D_AW:
-      case ID_DBP_D_AWA:
-        instrument = new DashboardInstrument_Wind(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_AWA);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionMainValue(_T("%.0f"), DIAL_POSITION_BOTTOMLEFT);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionExtraValue(OCPN_DBP_STC_AWS, _T("%.1f"),
-                                  DIAL_POSITION_INSIDE);
-        break;
-      case ID_DBP_I_AWS:
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_AWS,
-            _T("%.1f"));
-        break;
-      case ID_DBP_D_AWS:
-        instrument = new DashboardInstrument_Speedometer(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_AWS, 0, 45);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionLabel(5, DIAL_LABEL_HORIZONTAL);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionMarker(1, DIAL_MARKER_SIMPLE, 5);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionMainValue(_T("A %.1f"), DIAL_POSITION_BOTTOMLEFT);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionExtraValue(OCPN_DBP_STC_TWS, _T("T %.1f"),
-                                  DIAL_POSITION_BOTTOMRIGHT);
-        break;
-      case ID_DBP_D_TW:  // True Wind angle +-180 degr on boat axis
-        instrument = new DashboardInstrument_TrueWindAngle(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_TWA);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionMainValue(_T("%.0f"), DIAL_POSITION_BOTTOMLEFT);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionExtraValue(OCPN_DBP_STC_TWS, _T("%.1f"),
-                                  DIAL_POSITION_INSIDE);
-        break;
-      case ID_DBP_D_AWA_TWA:  // App/True Wind angle +-180 degr on boat axis
-        instrument = new DashboardInstrument_AppTrueWindAngle(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_AWA);
-        ((DashboardInstrument_Dial *)instrument)->SetCapFlag(OCPN_DBP_STC_TWA);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionMainValue(_T("%.0f"), DIAL_POSITION_NONE);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionExtraValue(OCPN_DBP_STC_TWS, _T("%.1f"),
-                                  DIAL_POSITION_NONE);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionExtraValue(OCPN_DBP_STC_AWS, _T("%.1f"),
-                                  DIAL_POSITION_NONE);
-        break;
-      case ID_DBP_D_TWD:  // True Wind direction
-        instrument = new DashboardInstrument_WindCompass(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_TWD);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionMainValue(_T("%.0f"), DIAL_POSITION_BOTTOMLEFT);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionExtraValue(OCPN_DBP_STC_TWS2, _T("%.1f"),
-                                  DIAL_POSITION_INSIDE);
-        break;
-      case ID_DBP_I_ALTI:
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_ALTI,
-            _T("%6.1f"));
-        break;
-      case ID_DBP_D_ALTI:
-        instrument = new DashboardInstrument_Altitude(this, wxID_ANY,
-                                                   getInstrumentCaption(id), Properties);
-        break;
-      case ID_DBP_I_DPT:
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_DPT,
-            _T("%5.2f"));
-        break;
-      case ID_DBP_D_DPT:
-        instrument = new DashboardInstrument_Depth(this, wxID_ANY,
-                                                   getInstrumentCaption(id), Properties);
-        break;
-      case ID_DBP_I_TMP:
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_TMP,
-            _T("%2.1f"));
-        break;
-      case ID_DBP_I_MDA:  // barometric pressure
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_MDA,
-            _T("%5.1f"));
-        break;
-      case ID_DBP_D_MDA:  // barometric pressure
-        instrument = new DashboardInstrument_Speedometer(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_MDA, 938,
-            1088);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionLabel(15, DIAL_LABEL_HORIZONTAL);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionMarker(7.5, DIAL_MARKER_SIMPLE, 1);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionMainValue(_T("%5.1f"), DIAL_POSITION_INSIDE);
-        break;
-      case ID_DBP_I_ATMP:  // air temperature
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_ATMP,
-            _T("%2.1f"));
-        break;
-      case ID_DBP_I_VLW1:  // Trip Log
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_VLW1,
-            _T("%2.1f"));
-        break;
-
-      case ID_DBP_I_VLW2:  // Sum Log
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_VLW2,
-            _T("%2.1f"));
-        break;
-
-      case ID_DBP_I_TWA:  // true wind angle
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_TWA,
-            _T("%5.0f"));
-        break;
-      case ID_DBP_I_TWD:  // true wind direction
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_TWD,
-            _T("%3.0f"));
-        break;
-      case ID_DBP_I_TWS:  // true wind speed
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_TWS,
-            _T("%2.1f"));
-        break;
-      case ID_DBP_I_AWA:  // apparent wind angle
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_AWA,
-            _T("%3.0f"));
-        break;
-      case ID_DBP_I_VMGW:   // VMG based on wind and STW
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_VMGW,
-            _T("%2.1f"));
-        break;
-      case ID_DBP_I_VMG:
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_VMG,
-            _T("%5.1f"));
-        break;
-      case ID_DBP_D_VMG:
-        instrument = new DashboardInstrument_Speedometer(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_VMG, 0,
-            g_iDashSpeedMax);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionLabel(1, DIAL_LABEL_HORIZONTAL);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionMarker(0.5, DIAL_MARKER_SIMPLE, 2);
-        ((DashboardInstrument_Dial *)instrument)
-            ->SetOptionExtraValue(OCPN_DBP_STC_SOG, _T("SOG\n%.1f"),
-                                  DIAL_POSITION_BOTTOMLEFT);
-        break;
-      case ID_DBP_I_RSA:
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_RSA,
-            _T("%5.0f"));
-        break;
-      case ID_DBP_D_RSA:
-        instrument = new DashboardInstrument_RudderAngle(
-            this, wxID_ANY, getInstrumentCaption(id), Properties);
-        break;
-      case ID_DBP_I_SAT:
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_SAT,
-            _T("%5.0f"));
-        break;
-      case ID_DBP_D_GPS:
-        instrument = new DashboardInstrument_GPS(this, wxID_ANY,
-                                                 getInstrumentCaption(id), Properties);
-        break;
-      case ID_DBP_I_PTR:
-        instrument = new DashboardInstrument_Position(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_PLA,
-            OCPN_DBP_STC_PLO);
-        break;
-      case ID_DBP_I_GPSUTC:
-        instrument = new DashboardInstrument_Clock(this, wxID_ANY,
-                                                   getInstrumentCaption(id), Properties);
-        break;
-      case ID_DBP_I_SUN:
-        instrument = new DashboardInstrument_Sun(this, wxID_ANY,
-                                                 getInstrumentCaption(id), Properties);
-        break;
-      case ID_DBP_D_MON:
-        instrument = new DashboardInstrument_Moon(this, wxID_ANY,
-                                                  getInstrumentCaption(id), Properties);
-        break;
-      case ID_DBP_D_WDH:
-        instrument = new DashboardInstrument_WindDirHistory(
-            this, wxID_ANY, getInstrumentCaption(id), Properties);
-        break;
-      case ID_DBP_D_BPH:
-        instrument = new DashboardInstrument_BaroHistory(
-            this, wxID_ANY, getInstrumentCaption(id), Properties);
-        break;
-      case ID_DBP_I_FOS:
-        instrument = new DashboardInstrument_FromOwnship(
-            this, wxID_ANY, getInstrumentCaption(id), Properties);
-        break;
-      case ID_DBP_I_PITCH:
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_PITCH,
-            _T("%2.1f"));
+    for (size_t j = 0; j < old.GetCount(); j++) {
+      DashboardInstrumentContainer *candidate = old.Item(j);
+      if (candidate->m_ID == id && candidate->m_pProperties == properties[i] &&
+          candidate->m_CreateSettings == settings && !candidate->m_bRebuild) {
+        reused[i] = candidate;
+        old.RemoveAt(j);
         break;
-      case ID_DBP_I_HEEL:
-        instrument = new DashboardInstrument_Single(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_HEEL,
-            _T("%2.1f"));
-        break;
-        // any clock display with "LCL" in the format string is converted from
-        // UTC to local TZ
-      case ID_DBP_I_SUNLCL:
-        instrument = new DashboardInstrument_Sun(this, wxID_ANY,
-                                                 getInstrumentCaption(id), Properties,
-                                                 _T( "%02i:%02i:%02i LCL" ));
-        break;
-      case ID_DBP_I_GPSLCL:
-        instrument = new DashboardInstrument_Clock(
-            this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_CLK,
-            _T( "%02i:%02i:%02i LCL" ));
-        break;
-      case ID_DBP_I_CPULCL:
-        instrument = new DashboardInstrument_CPUClock(
-            this, wxID_ANY, getInstrumentCaption(id), Properties,
-            _T( "%02i:%02i:%02i LCL" ));
-        break;
-      case ID_DBP_I_HUM:
-          instrument = new DashboardInstrument_Single(
-              this, wxID_ANY, getInstrumentCaption(id), Properties,
-              OCPN_DBP_STC_HUM, "%3.0f");
-        break;
-      case ID_DBP_D_STW_COG:
-          instrument = new DashboardInstrument_SpeedometerSOGSTW(
-              this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_SOG, 0,
-              g_iDashSpeedMax);
-          ((DashboardInstrument_Dial*)instrument)
-              ->SetOptionLabel(g_iDashSpeedMax / 20 + 1, DIAL_LABEL_HORIZONTAL);          
-          ((DashboardInstrument_Dial*)instrument)
-              ->SetOptionMarker(0.5, DIAL_MARKER_SIMPLE, 2);
-          ((DashboardInstrument_Dial*)instrument)
-              ->SetOptionMainValue(_T("SOG\n%.1f"), DIAL_POSITION_BOTTOMLEFT);
-          ((DashboardInstrument_Dial*)instrument)
-              ->SetOptionExtraValue(OCPN_DBP_STC_STW, _T("   STW\n%.1f"),
-                  DIAL_POSITION_BOTTOMRIGHT);
-          break;
-      // Engine Dashboard
-      case ID_DBP_MAIN_ENGINE_RPM:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_MAIN_ENGINE_RPM, 0, g_iDashTachometerMax);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(1000, DIAL_LABEL_HORIZONTAL);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.2f"), DIAL_POSITION_NONE);
-          // ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(200, DIAL_MARKER_SIMPLE, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(200, DIAL_MARKER_WARNING_HIGH, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionExtraValue(OCPN_DBP_STC_MAIN_ENGINE_HOURS, _T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_PORT_ENGINE_RPM:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_PORT_ENGINE_RPM, 0, g_iDashTachometerMax);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(1000, DIAL_LABEL_HORIZONTAL);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.2f"), DIAL_POSITION_NONE);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(200, DIAL_MARKER_SIMPLE, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionExtraValue(OCPN_DBP_STC_PORT_ENGINE_HOURS, _T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_STBD_ENGINE_RPM:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_STBD_ENGINE_RPM, 0, g_iDashTachometerMax);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(1000, DIAL_LABEL_HORIZONTAL);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.2f"), DIAL_POSITION_NONE);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(200, DIAL_MARKER_SIMPLE, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionExtraValue(OCPN_DBP_STC_STBD_ENGINE_HOURS, _T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_MAIN_ENGINE_OIL:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_MAIN_ENGINE_OIL, 0, g_iDashPressureUnit == PRESSURE_BAR ? 5 : 80);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashPressureUnit == PRESSURE_BAR ? 1 : 20, DIAL_LABEL_HORIZONTAL);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashPressureUnit == PRESSURE_BAR ? 0.5 : 10, DIAL_MARKER_SIMPLE, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_PORT_ENGINE_OIL:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_PORT_ENGINE_OIL, 0, g_iDashPressureUnit == PRESSURE_BAR ? 5 : 80);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashPressureUnit == PRESSURE_BAR ? 1 : 20, DIAL_LABEL_HORIZONTAL);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashPressureUnit == PRESSURE_BAR ? 0.5 : 10, DIAL_MARKER_SIMPLE, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_STBD_ENGINE_OIL:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_STBD_ENGINE_OIL, 0, g_iDashPressureUnit == PRESSURE_BAR ? 5 : 80);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashPressureUnit == PRESSURE_BAR ? 1 : 20, DIAL_LABEL_HORIZONTAL);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashPressureUnit == PRESSURE_BAR ? 0.5 : 10, DIAL_MARKER_SIMPLE, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_MAIN_ENGINE_WATER:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_MAIN_ENGINE_WATER, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 40 : 80, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 120 : 250);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 10 : 30, DIAL_LABEL_HORIZONTAL);
-          //((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 5 : 15, DIAL_MARKER_SIMPLE, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 5 : 15, DIAL_MARKER_WARNING_HIGH, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_PORT_ENGINE_WATER:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_PORT_ENGINE_WATER, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 40 : 80, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 120 : 250);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 10 : 30, DIAL_LABEL_HORIZONTAL);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 5 : 15, DIAL_MARKER_WARNING_HIGH, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_STBD_ENGINE_WATER:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_STBD_ENGINE_WATER, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 40 : 80, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 120 : 250);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 10 : 30, DIAL_LABEL_HORIZONTAL);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 5 : 15, DIAL_MARKER_WARNING_HIGH, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_MAIN_ENGINE_EXHAUST:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_MAIN_ENGINE_EXHAUST, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 0 : 40, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 80 : 190);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 10 : 30, DIAL_LABEL_HORIZONTAL);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 5 : 15, DIAL_MARKER_SIMPLE, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_PORT_ENGINE_EXHAUST:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_PORT_ENGINE_EXHAUST, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 0 : 40, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 80 : 190);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 10 : 30, DIAL_LABEL_HORIZONTAL);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 5 : 15, DIAL_MARKER_SIMPLE, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_STBD_ENGINE_EXHAUST:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_STBD_ENGINE_EXHAUST, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 0 : 40, g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 80 : 190);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 10 : 30, DIAL_LABEL_HORIZONTAL);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(g_iDashTemperatureUnit == TEMPERATURE_CELSIUS ? 5 : 15, DIAL_MARKER_SIMPLE, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_MAIN_ENGINE_VOLTS:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_MAIN_ENGINE_VOLTS, twentyFourVolts ? 18 : 8, twentyFourVolts ? 32 : 16);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(2, DIAL_LABEL_HORIZONTAL);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(1, DIAL_MARKER_SIMPLE, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_PORT_ENGINE_VOLTS:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_PORT_ENGINE_VOLTS, twentyFourVolts ? 18 : 8, twentyFourVolts ? 32 : 16);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(2, DIAL_LABEL_HORIZONTAL);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(1, DIAL_MARKER_SIMPLE, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_STBD_ENGINE_VOLTS:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_STBD_ENGINE_VOLTS, twentyFourVolts ? 18 : 8, twentyFourVolts ? 32 : 16);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(2, DIAL_LABEL_HORIZONTAL);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(1, DIAL_MARKER_SIMPLE, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_FUEL_TANK_01:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_TANK_LEVEL_FUEL_01, 0, 100);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_LOW, 1);
-          break;
-      case ID_DBP_WATER_TANK_01:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_TANK_LEVEL_WATER_01, 0, 100);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_LOW, 1);
-          break;
-      case ID_DBP_FUEL_TANK_02:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_TANK_LEVEL_FUEL_02, 0, 100);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_LOW, 1);
-          break;
-      case ID_DBP_WATER_TANK_02:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_TANK_LEVEL_WATER_02, 0, 100);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_LOW, 1);
-          break;
-      case ID_DBP_WATER_TANK_03:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_TANK_LEVEL_WATER_03, 0, 100);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_LOW, 1);
-          break;
-      case ID_DBP_OIL_TANK:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_TANK_LEVEL_OIL, 0, 100);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_LOW, 1);
-          break;
-      case ID_DBP_LIVEWELL_TANK:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_TANK_LEVEL_LIVEWELL, 0, 100);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_LOW, 1);
-          break;
-      case ID_DBP_GREY_TANK:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_TANK_LEVEL_GREY, 0, 100);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_HIGH, 1);
-          break;
-      case ID_DBP_BLACK_TANK:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY,
-              getInstrumentCaption(id), Properties, OCPN_DBP_STC_TANK_LEVEL_BLACK, 0, 100);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(25, DIAL_LABEL_FRACTIONS);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(12.5, DIAL_MARKER_WARNING_HIGH, 1);
-          break;
-      case ID_DBP_START_BATTERY_VOLTS:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY, getInstrumentCaption(id), Properties,
-              OCPN_DBP_STC_START_BATTERY_VOLTS, twentyFourVolts ? 18 : 8, twentyFourVolts ? 32 : 16);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(2, DIAL_LABEL_HORIZONTAL);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.2f"), DIAL_POSITION_NONE);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(1, DIAL_MARKER_GREEN_MID, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionExtraValue(OCPN_DBP_STC_START_BATTERY_AMPS, _T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_HOUSE_BATTERY_VOLTS:
-          instrument = new DashboardInstrument_Speedometer(this, wxID_ANY, getInstrumentCaption(id), Properties,
-              OCPN_DBP_STC_HOUSE_BATTERY_VOLTS, twentyFourVolts ? 18 : 8, twentyFourVolts ? 32 : 16);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionLabel(2, DIAL_LABEL_HORIZONTAL);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMainValue(_T("%.2f"), DIAL_POSITION_NONE);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionMarker(1, DIAL_MARKER_GREEN_MID, 1);
-          ((DashboardInstrument_Dial*)instrument)->SetOptionExtraValue(OCPN_DBP_STC_HOUSE_BATTERY_AMPS, _T("%.1f"), DIAL_POSITION_INSIDE);
-          break;
-      case ID_DBP_RSA: {
-          instrument = new DashboardInstrument_RudderAngle(this, wxID_ANY, getInstrumentCaption(id), Properties);
-          ((DashboardInstrument_RudderAngle*)instrument)->SetOptionMarker(5, DIAL_MARKER_REDGREEN, 2);
-          wxString labels[] = { _T("40"), _T("30"), _T("20"), _T("10"), _T("0"), _T("10"), _T("20"), _T("30"), _T("40") };
-          ((DashboardInstrument_RudderAngle*)instrument)->SetOptionLabel(10, DIAL_LABEL_HORIZONTAL, wxArrayString(9, labels));
-          break;
       }
-      case ID_DBP_FUEL_TANK_GAUGE_01:
-          instrument = new DashboardInstrument_Block(this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_TANK_LEVEL_FUEL_GAUGE_01, "%s");
-          break;
-      case ID_DBP_FUEL_TANK_GAUGE_02:
-          instrument = new DashboardInstrument_Block(this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_TANK_LEVEL_FUEL_GAUGE_02, "%s");
-          break;
-      case ID_DBP_WATER_TANK_GAUGE_01:
-          instrument = new DashboardInstrument_Block(this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_TANK_LEVEL_WATER_GAUGE_01, "%s");
-          break;
-      case ID_DBP_WATER_TANK_GAUGE_02:
-          instrument = new DashboardInstrument_Block(this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_TANK_LEVEL_WATER_GAUGE_02, "%s");
-          break;
-      case ID_DBP_WATER_TANK_GAUGE_03:
-          instrument = new DashboardInstrument_Block(this, wxID_ANY, getInstrumentCaption(id), Properties, OCPN_DBP_STC_TANK_LEVEL_WATER_GAUGE_03, "%s");
-          break;
     }
-    if (instrument) {
+  }
+  for (size_t j = 0; j < old.GetCount(); j++) delete old.Item(j);
+
+  for (size_t i = 0; i < list.GetCount(); i++) {
+    int id = list.Item(i);
+    DashboardInstrumentContainer *pdic = reused[i];
+    if (!pdic) {
+      DashboardInstrument *instrument = CreateInstrument(id, properties[i]);
+      if (!instrument) continue;
       instrument->instrumentTypeId = id;
-      m_ArrayOfInstrument.Add(new DashboardInstrumentContainer(
-          id, instrument, instrument->GetCapacity()));
-      itemBoxSizer->Add(instrument, 0, wxEXPAND, 0);
-      if (itemBoxSizer->GetOrientation() == wxHORIZONTAL) {
-        itemBoxSizer->AddSpacer(5);
-      }
+      // Stale caps are only sent on a change, a new instrument needs them
+      const CapType &stale = m_plugin->GetStaleCaps();
+      CapType caps = instrument->GetCapacity();
+      for (int cap = 0; cap < N_INSTRUMENTS; cap++)
+        if (stale.test(cap) && caps.test(cap))
+          instrument->SetCapStale((DASH_CAP)cap, true);
+      pdic = new DashboardInstrumentContainer(id, instrument,
+                                              instrument->GetCapacity());
+      pdic->m_pProperties = properties[i];
+      pdic->m_CreateSettings = settings;
+    }
+    m_ArrayOfInstrument.Add(pdic);
+    itemBoxSizer->Add(pdic->m_pInstrument, 0, wxEXPAND, 0);
+    if (itemBoxSizer->GetOrientation() == wxHORIZONTAL) {
+      itemBoxSizer->AddSpacer(5);
     }
   }
 
@@ -6801,6 +7218,27 @@ void DashboardWindow::SetInstrumentList(wxArrayInt list, wxArrayOfInstrumentProp
   SetMinSize(itemBoxSizer->GetMinSize());
 }
 
+// The options of 'Properties' were edited in place, the next list must
+// create its instrument again.
+void DashboardWindow::RebuildInstrument(const InstrumentProperties *Properties) {
+  for (size_t i = 0; i < m_ArrayOfInstrument.GetCount(); i++)
+    if (m_ArrayOfInstrument.Item(i)->m_pProperties == Properties)
+      m_ArrayOfInstrument.Item(i)->m_bRebuild = true;
+}
+
+// One instrument of a layout, made by the factory of its id
+DashboardInstrument *DashboardWindow::CreateInstrument(
+    int id, InstrumentProperties *Properties) {
+  const InstrumentDescriptor *desc = GetInstrumentDescriptor(id);
+  if (!desc || !desc->create) return NULL;
+  StartupProfile::Clock::time_point start = StartupProfile::Clock::now();
+  DashboardInstrument *instrument =
+      desc->create(this, getInstrumentCaption(id), Properties, *desc);
+  g_StartupProfile.Add(_T("Create ") + wxString::FromAscii(desc->caption),
+                       start);
+  return instrument;
+}
+
 void DashboardWindow::SendSentenceToAllInstruments(DASH_CAP st, double value,
                                                    wxString unit) {
   for (size_t i = 0; i < m_ArrayOfInstrument.GetCount(); i++) {
@@ -6809,6 +7247,13 @@ void DashboardWindow::SendSentenceToAllInstruments(DASH_CAP st, double value,
   }
 }
 
+void DashboardWindow::SendStaleToAllInstruments(DASH_CAP st, bool stale) {
+  for (size_t i = 0; i < m_ArrayOfInstrument.GetCount(); i++) {
+    if (m_ArrayOfInstrument.Item(i)->m_cap_flag.test(st))
+      m_ArrayOfInstrument.Item(i)->m_pInstrument->SetCapStale(st, stale);
+  }
+}
+
 void DashboardWindow::SendSatInfoToAllInstruments(int cnt, int seq,
                                                   wxString talk,
                                                   SAT_INFO sats[4]) {
@@ -6963,56 +7408,56 @@ EditDialog::EditDialog(wxWindow* parent, InstrumentProperties& Properties, wxWin
     m_staticText1->Wrap(-1);
     fgSizer2->Add(m_staticText1, 0, wxALIGN_CENTER_VERTICAL | wxALL, 5);
 
-    m_fontPicker2 = new wxFontPickerCtrl(this, wxID_ANY, Properties.m_TitelFont, wxDefaultPosition, wxDefaultSize);
+    m_fontPicker2 = new wxFontPickerCtrl(this, wxID_ANY, Properties.Style().m_TitelFont, wxDefaultPosition, wxDefaultSize);
     fgSizer2->Add(m_fontPicker2, 0, wxALL, 5);
 
     m_staticText5 = new wxStaticText(this, wxID_ANY, _("Titlebackgroundcolor:"), wxDefaultPosition, wxDefaultSize, 0);
     m_staticText5->Wrap(-1);
     fgSizer2->Add(m_staticText5, 0, wxALIGN_CENTER_VERTICAL | wxALL, 5);
 
-    m_colourPicker1 = new wxColourPickerCtrl(this, wxID_ANY, Properties.m_TitlelBackgroundColour, wxDefaultPosition, wxDefaultSize, wxCLRP_DEFAULT_STYLE);
+    m_colourPicker1 = new wxColourPickerCtrl(this, wxID_ANY, Properties.Style().m_TitlelBackgroundColour, wxDefaultPosition, wxDefaultSize, wxCLRP_DEFAULT_STYLE);
     fgSizer2->Add(m_colourPicker1, 0, wxALL, 5);
 
     m_staticText2 = new wxStaticText(this, wxID_ANY, _("Data:"), wxDefaultPosition, wxDefaultSize, 0);
     m_staticText2->Wrap(-1);
     fgSizer2->Add(m_staticText2, 0, wxALIGN_CENTER_VERTICAL | wxALL, 5);
 
-    m_fontPicker4 = new wxFontPickerCtrl(this, wxID_ANY, Properties.m_DataFont, wxDefaultPosition, wxDefaultSize);
+    m_fontPicker4 = new wxFontPickerCtrl(this, wxID_ANY, Properties.Style().m_DataFont, wxDefaultPosition, wxDefaultSize);
     fgSizer2->Add(m_fontPicker4, 0, wxALL, 5);
 
     m_staticText6 = new wxStaticText(this, wxID_ANY, _("Databackgroundcolor:"), wxDefaultPosition, wxDefaultSize, 0);
     m_staticText6->Wrap(-1);
     fgSizer2->Add(m_staticText6, 0, wxALL, 5);
 
-    m_colourPicker2 = new wxColourPickerCtrl(this, wxID_ANY, Properties.m_DataBackgroundColour, wxDefaultPosition, wxDefaultSize, wxCLRP_DEFAULT_STYLE);
+    m_colourPicker2 = new wxColourPickerCtrl(this, wxID_ANY, Properties.Style().m_DataBackgroundColour, wxDefaultPosition, wxDefaultSize, wxCLRP_DEFAULT_STYLE);
     fgSizer2->Add(m_colourPicker2, 0, wxALL, 5);
 
     m_staticText3 = new wxStaticText(this, wxID_ANY, _("Label:"), wxDefaultPosition, wxDefaultSize, 0);
     m_staticText3->Wrap(-1);
     fgSizer2->Add(m_staticText3, 0, wxALIGN_CENTER_VERTICAL | wxALL, 5);
 
-    m_fontPicker5 = new wxFontPickerCtrl(this, wxID_ANY, Properties.m_LabelFont, wxDefaultPosition, wxDefaultSize);
+    m_fontPicker5 = new wxFontPickerCtrl(this, wxID_ANY, Properties.Style().m_LabelFont, wxDefaultPosition, wxDefaultSize);
     fgSizer2->Add(m_fontPicker5, 0, wxALL, 5);
 
     m_staticText4 = new wxStaticText(this, wxID_ANY, _("Small:"), wxDefaultPosition, wxDefaultSize, 0);
     m_staticText4->Wrap(-1);
     fgSizer2->Add(m_staticText4, 0, wxALIGN_CENTER_VERTICAL | wxALL, 5);
 
-    m_fontPicker6 = new wxFontPickerCtrl(this, wxID_ANY, Properties.m_SmallFont, wxDefaultPosition, wxDefaultSize);
+    m_fontPicker6 = new wxFontPickerCtrl(this, wxID_ANY, Properties.Style().m_SmallFont, wxDefaultPosition, wxDefaultSize);
     fgSizer2->Add(m_fontPicker6, 0, wxALL, 5);
 
     m_staticText9 = new wxStaticText(this, wxID_ANY, _("Arrow 1 Colour :"), wxDefaultPosition, wxDefaultSize, 0);
     m_staticText9->Wrap(-1);
     fgSizer2->Add(m_staticText9, 0, wxALIGN_CENTER_VERTICAL | wxALL, 5);
 
-    m_colourPicker3 = new wxColourPickerCtrl(this, wxID_ANY, Properties.m_Arrow_First_Colour, wxDefaultPosition, wxDefaultSize, wxCLRP_DEFAULT_STYLE);
+    m_colourPicker3 = new wxColourPickerCtrl(this, wxID_ANY, Properties.Style().m_Arrow_First_Colour, wxDefaultPosition, wxDefaultSize, wxCLRP_DEFAULT_STYLE);
     fgSizer2->Add(m_colourPicker3, 0, wxALL, 5);
 
     m_staticText10 = new wxStaticText(this, wxID_ANY, _("Arrow 2 Colour :"), wxDefaultPosition, wxDefaultSize, 0);
     m_staticText10->Wrap(-1);
     fgSizer2->Add(m_staticText10, 0, wxALIGN_CENTER_VERTICAL | wxALL, 5);
 
-    m_colourPicker4 = new wxColourPickerCtrl(this, wxID_ANY, Properties.m_Arrow_Second_Colour, wxDefaultPosition, wxDefaultSize, wxCLRP_DEFAULT_STYLE);
+    m_colourPicker4 = new wxColourPickerCtrl(this, wxID_ANY, Properties.Style().m_Arrow_Second_Colour, wxDefaultPosition, wxDefaultSize, wxCLRP_DEFAULT_STYLE);
     fgSizer2->Add(m_colourPicker4, 0, wxALL, 5);
 
     m_staticline1 = new wxStaticLine(this, wxID_ANY, wxDefaultPosition, wxDefaultSize, wxLI_HORIZONTAL);
@@ -52,9 +52,7 @@ DashboardInstrument_Depth::DashboardInstrument_Depth(wxWindow* parent,
   m_Depth = 0;
   m_DepthUnit = getUsrDistanceUnit_Plugin(g_iDashDepthUnit);
   m_Temp = _T("--");
-  for (int idx = 0; idx < DEPTH_RECORD_COUNT; idx++) {
-    m_ArrayDepth[idx] = 0;
-  }
+  m_ArrayDepth.Fill(0);
 }
 
 wxSize DashboardInstrument_Depth::GetSize(int orient, wxSize hint) {
@@ -63,23 +61,23 @@ wxSize DashboardInstrument_Depth::GetSize(int orient, wxSize hint) {
   wxFont f;
   if (m_Properties)
   {
-      f = m_Properties->m_TitelFont.GetChosenFont();
-      dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
-      f = m_Properties->m_DataFont.GetChosenFont();
-      dc.GetTextExtent("15.7 Feet", &w, &m_DataHeight, 0, 0, &f);
+      f = m_Properties->Style().m_TitelFont.GetChosenFont();
+      GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
+      f = m_Properties->Style().m_DataFont.GetChosenFont();
+      GetTextExtentCached(dc, "15.7 Feet", &w, &m_DataHeight, f);
       // Space for bottom(temp)text later.
-      f = m_Properties->m_LabelFont.GetChosenFont();
-      dc.GetTextExtent("20.8 C", &w_label, &h_label, 0, 0, &f);
+      f = m_Properties->Style().m_LabelFont.GetChosenFont();
+      GetTextExtentCached(dc, "20.8 C", &w_label, &h_label, f);
   }
   else
   {
       f = g_pFontTitle->GetChosenFont();
-      dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
+      GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
       f = g_pFontData->GetChosenFont();
-      dc.GetTextExtent("15.7 Feet", &w, &m_DataHeight, 0, 0, &f);
+      GetTextExtentCached(dc, "15.7 Feet", &w, &m_DataHeight, f);
       // Space for bottom(temp)text later.
       f = g_pFontLabel->GetChosenFont();
-      dc.GetTextExtent("20.8 C", &w_label, &h_label, 0, 0, &f);
+      GetTextExtentCached(dc, "20.8 C", &w_label, &h_label, f);
   }
   int y_total =
       //  Title         Depth data       plot area       w-temp
@@ -95,11 +93,7 @@ void DashboardInstrument_Depth::SetData(DASH_CAP st, double data,
                                         wxString unit) {
   if (st == OCPN_DBP_STC_DPT) {
     m_Depth = std::isnan(data) ? 0.0 : data;
-
-    for (int idx = 1; idx < DEPTH_RECORD_COUNT; idx++) {
-      m_ArrayDepth[idx - 1] = m_ArrayDepth[idx];
-    }
-    m_ArrayDepth[DEPTH_RECORD_COUNT - 1] = m_Depth;
+    m_ArrayDepth.Push(m_Depth);
     m_DepthUnit = unit;
   } else if (st == OCPN_DBP_STC_TMP) {
     if (!std::isnan(data)) {
@@ -120,29 +114,21 @@ void DashboardInstrument_Depth::DrawBackground(wxGCDC* dc) {
   wxColour cl;
   if (m_Properties)
   {
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_LabelFont.GetColour()));
+      dc->SetTextForeground(Palette().m_LabelFont);
   }
   else
   {
-      if (GetColourSchemeFont(g_pFontSmall->GetColour()) == GetColourSchemeFont(g_pFontLabel->GetColour()))
+      if (Palette().m_SmallFont == Palette().m_LabelFont)
       {
-          GetGlobalColor(_T("DASHL"), &cl);
+          cl = DashColour(DC_DASHL);
           dc->SetTextForeground(cl);
       }
       else
-          dc->SetTextForeground(GetColourSchemeFont(g_pFontLabel->GetColour()));
+          dc->SetTextForeground(Palette().m_LabelFont);
   }
   wxPen pen;
   pen.SetStyle(wxPENSTYLE_SOLID);
-  if (m_Properties)
-  {
-      cl = GetColourSchemeFont(m_Properties->m_SmallFont.GetColour());
-  }
-  else
-  {
-      //GetGlobalColor(_T("DASHF"), &cl);
-      cl = GetColourSchemeFont(g_pFontSmall->GetColour());
-  }
+  cl = Palette().m_SmallFont;
   pen.SetColour(cl);
   pen.SetWidth(1);
   dc->SetPen(pen);
@@ -170,17 +156,17 @@ void DashboardInstrument_Depth::DrawBackground(wxGCDC* dc) {
                size.x - 3, m_plotup + m_plotheight * 3 / 4);
   if (m_Properties)
   {
-      dc->SetFont(m_Properties->m_SmallFont.GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_SmallFont.GetColour()));
+      dc->SetFont(m_Properties->Style().m_SmallFont.GetChosenFont());
+      dc->SetTextForeground(Palette().m_SmallFont);
   }
   else
   {
       dc->SetFont(g_pFontSmall->GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(g_pFontSmall->GetColour()));
+      dc->SetTextForeground(Palette().m_SmallFont);
   }
   m_MaxDepth = 0;
-  for (int idx = 0; idx < DEPTH_RECORD_COUNT; idx++) {
-    if (m_ArrayDepth[idx] > m_MaxDepth) m_MaxDepth = m_ArrayDepth[idx];
+  for (double depth : m_ArrayDepth) {
+    if (depth > m_MaxDepth) m_MaxDepth = depth;
   }
   // Increase MaxDepth slightly for nicer display
   m_MaxDepth *= 1.2;
@@ -190,15 +176,15 @@ void DashboardInstrument_Depth::DrawBackground(wxGCDC* dc) {
   int width, height;
   wxFont f;
   if (m_Properties)
-      f = m_Properties->m_SmallFont.GetChosenFont();
+      f = m_Properties->Style().m_SmallFont.GetChosenFont();
   else
       f = g_pFontSmall->GetChosenFont();
-  dc->GetTextExtent(label, &width, &height, 0, 0, &f);
+  GetTextExtentCached(*dc, label, &width, &height, f);
   dc->DrawText(label, size.x - width - 1, m_plotup - height);
 
   label.Printf(_T("%.0f ") + m_DepthUnit, m_MaxDepth);
   if (m_Properties)
-      f = m_Properties->m_SmallFont.GetChosenFont();
+      f = m_Properties->Style().m_SmallFont.GetChosenFont();
   else
       f = g_pFontSmall->GetChosenFont();
   dc->GetTextExtent(label, &width, &height, 0, 0, &f);
@@ -210,14 +196,14 @@ void DashboardInstrument_Depth::DrawForeground(wxGCDC* dc) {
   wxColour cl;
   if (m_Properties)
   {
-      cl = GetColourSchemeFont(m_Properties->m_LabelFont.GetColour());
+      cl = Palette().m_LabelFont;
   }
   else
   {
-      if (GetColourSchemeFont(g_pFontSmall->GetColour()) == GetColourSchemeFont(g_pFontLabel->GetColour()))
-          GetGlobalColor(_T("DASHL"), &cl);
+      if (Palette().m_SmallFont == Palette().m_LabelFont)
+          cl = DashColour(DC_DASHL);
       else
-          cl = GetColourSchemeFont(g_pFontLabel->GetColour());
+          cl = Palette().m_LabelFont;
   }
   wxBrush brush;
   brush.SetStyle(wxBRUSHSTYLE_SOLID);
@@ -271,13 +257,13 @@ void DashboardInstrument_Depth::DrawForeground(wxGCDC* dc) {
 #endif
   if (m_Properties)
   {
-      dc->SetFont(m_Properties->m_DataFont.GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_DataFont.GetColour()));
+      dc->SetFont(m_Properties->Style().m_DataFont.GetChosenFont());
+      dc->SetTextForeground(Palette().m_DataFont);
   }
   else
   {
       // GetGlobalColor(_T("DASHF"), &cl);
-      dc->SetTextForeground(GetColourSchemeFont(g_pFontData->GetColour()));
+      dc->SetTextForeground(Palette().m_DataFont);
       dc->SetFont(g_pFontData->GetChosenFont());
   }
   if (m_DepthUnit != _T("-")) {  // Watchdog
@@ -288,7 +274,7 @@ void DashboardInstrument_Depth::DrawForeground(wxGCDC* dc) {
   } else
     dc->DrawText(_T("---"), 10, m_TitleHeight);
   if (m_Properties)
-     dc->SetFont(m_Properties->m_LabelFont.GetChosenFont());
+     dc->SetFont(m_Properties->Style().m_LabelFont.GetChosenFont());
   else
      dc->SetFont(g_pFontLabel->GetChosenFont());  
   dc->DrawText(m_Temp, 5, m_plotdown);
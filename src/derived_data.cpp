@@ -0,0 +1,161 @@
+/******************************************************************************
+ * derived_data.cpp
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Derived quantities (true wind, magnetic COG, VMG to wind)
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+#include "derived_data.h"
+#include <cmath>
+
+#define DD_BIT(i) (1u << (i))
+#define DD_DEG2RAD (3.14159265358979323846 / 180.)
+
+// Inputs that start a new value of an output, in the order of DD_OUT_
+static const unsigned s_Triggers[DD_OUTPUTS] = {
+    DD_BIT(DD_AWA) | DD_BIT(DD_AWS),  // DD_OUT_TRUEWIND
+    DD_BIT(DD_TWA),                   // DD_OUT_TWD_MEASURED
+    DD_BIT(DD_COG),                   // DD_OUT_MCOG
+    DD_BIT(DD_AWA) | DD_BIT(DD_AWS)   // DD_OUT_VMGW
+};
+
+static double NormalizeDeg(double deg) {
+  if (deg < 0.) deg += 360.;
+  if (deg > 360.) deg -= 360.;
+  return deg;
+}
+
+DerivedData::DerivedData() { Reset(); }
+
+void DerivedData::Reset(void) {
+  m_epoch = 0;
+  for (int i = 0; i < DD_INPUTS; i++) {
+    m_in[i] = NAN;
+    m_changed[i] = m_seen[i] = 0;
+  }
+  for (int i = 0; i < DD_OUTPUTS; i++) m_published[i] = 0;
+  m_boatEpoch = m_apparentEpoch = 0;
+  m_trueWindEpoch = m_twdMeasuredEpoch = m_mcogEpoch = 0;
+  m_bsx = m_bsy = m_awx = m_awy = 0.;
+  m_twa = m_tws = m_twd = m_vmgw = m_twdMeasured = m_mcog = NAN;
+}
+
+void DerivedData::Set(int input, double value) {
+  m_epoch++;
+  m_seen[input] = m_epoch;
+  bool same = std::isnan(value) ? std::isnan(m_in[input]) : value == m_in[input];
+  if (same) return;
+  m_in[input] = value;
+  m_changed[input] = m_epoch;
+}
+
+bool DerivedData::Take(int output) {
+  unsigned long arrived = 0;
+  for (int i = 0; i < DD_INPUTS; i++)
+    if ((s_Triggers[output] & DD_BIT(i)) && m_seen[i] > arrived)
+      arrived = m_seen[i];
+  if (arrived <= m_published[output]) return false;
+  m_published[output] = m_epoch;
+
+  switch (output) {
+    case DD_OUT_TRUEWIND:
+    case DD_OUT_VMGW:
+      UpdateTrueWind();
+      break;
+    case DD_OUT_TWD_MEASURED:
+      UpdateTwdMeasured();
+      break;
+    case DD_OUT_MCOG:
+      UpdateMcog();
+      break;
+  }
+  return true;
+}
+
+// True if one of the inputs in 'deps' did change since 'computed', which is
+// then moved to the current epoch.
+bool DerivedData::Stale(unsigned long &computed, unsigned deps) const {
+  bool stale = computed == 0;
+  for (int i = 0; i < DD_INPUTS; i++)
+    if ((deps & DD_BIT(i)) && m_changed[i] > computed) stale = true;
+  if (stale) computed = m_epoch;
+  return stale;
+}
+
+void DerivedData::UpdateBoat(void) {
+  if (!Stale(m_boatEpoch, DD_BIT(DD_HDT) | DD_BIT(DD_COG) | DD_BIT(DD_SOG)))
+    return;
+  m_bsx = m_bsy = 0.;
+  if (!std::isnan(m_in[DD_SOG]) && !std::isnan(m_in[DD_COG]) &&
+      !std::isnan(m_in[DD_HDT])) {
+    double a = (m_in[DD_COG] - m_in[DD_HDT]) * DD_DEG2RAD;
+    m_bsx = m_in[DD_SOG] * cos(a);
+    m_bsy = m_in[DD_SOG] * sin(a);
+  }
+}
+
+void DerivedData::UpdateApparent(void) {
+  if (!Stale(m_apparentEpoch, DD_BIT(DD_AWA) | DD_BIT(DD_AWS))) return;
+  double a = m_in[DD_AWA] * DD_DEG2RAD;
+  m_awx = m_in[DD_AWS] * cos(a);
+  m_awy = m_in[DD_AWS] * sin(a);
+}
+
+// "True" wind is calculated by vector subtraction of the boat velocity from
+// the apparent wind, both relative to head-up, then re-oriented to HDT.
+void DerivedData::UpdateTrueWind(void) {
+  if (!Stale(m_trueWindEpoch, DD_BIT(DD_HDT) | DD_BIT(DD_COG) |
+                                  DD_BIT(DD_SOG) | DD_BIT(DD_AWA) |
+                                  DD_BIT(DD_AWS)))
+    return;
+  m_twa = m_tws = m_twd = m_vmgw = NAN;
+  if (std::isnan(m_in[DD_HDT]) || std::isnan(m_in[DD_AWA]) ||
+      std::isnan(m_in[DD_AWS]))
+    return;
+  UpdateBoat();
+  UpdateApparent();
+
+  double twx = m_awx - m_bsx;
+  double twy = m_awy - m_bsy;
+  m_tws = sqrt(twx * twx + twy * twy);
+  m_twa = atan2(twy, twx) / DD_DEG2RAD;
+  m_twd = NormalizeDeg(m_twa + m_in[DD_HDT]);
+
+  // Boat velocity projected on the true wind, the cos/sin of TWA are
+  // already in the wind vector.
+  if (!std::isnan(m_in[DD_SOG]) && !std::isnan(m_in[DD_COG]))
+    m_vmgw = m_tws > 0. ? (m_bsx * twx + m_bsy * twy) / m_tws : 0.;
+}
+
+void DerivedData::UpdateTwdMeasured(void) {
+  if (!Stale(m_twdMeasuredEpoch, DD_BIT(DD_HDT) | DD_BIT(DD_TWA))) return;
+  m_twdMeasured = NAN;
+  double hdt = m_in[DD_HDT];
+  if (hdt < 361. && hdt >= 0.0 && !std::isnan(m_in[DD_TWA]))
+    m_twdMeasured = NormalizeDeg(m_in[DD_TWA] + hdt);
+}
+
+void DerivedData::UpdateMcog(void) {
+  if (!Stale(m_mcogEpoch, DD_BIT(DD_COG) | DD_BIT(DD_VAR))) return;
+  m_mcog = NAN;
+  if (std::isnan(m_in[DD_COG]) || std::isnan(m_in[DD_VAR])) return;
+  m_mcog = NormalizeDeg(m_in[DD_COG] - m_in[DD_VAR]);
+}
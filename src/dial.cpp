@@ -40,12 +40,16 @@
 #endif
 
 #include <cmath>
+#include <cstring>
 #include "wx/tokenzr.h"
+#include "wx/graphics.h"
 
 #ifdef __OCPN__ANDROID__
 #include "qdebug.h"
 #endif
 
+extern PI_ColorScheme aktuellColorScheme;
+
 double rad2deg(double angle) { return angle * 180.0 / M_PI; }
 double deg2rad(double angle) { return angle / 180.0 * M_PI; }
 
@@ -61,6 +65,7 @@ DashboardInstrument_Dial::DashboardInstrument_Dial(
 
   m_MainValue = s_value;
   m_ExtraValue = 0;
+  m_ExtraValueCap = cap_flag;  // Until SetOptionExtraValue()
   m_MainValueFormat = _T("%d");
   m_MainValueUnit = _T("");
   m_MainValueOption = DIAL_POSITION_NONE;
@@ -72,6 +77,8 @@ DashboardInstrument_Dial::DashboardInstrument_Dial(
   m_LabelStep = 1;
   m_MarkerOffset = 1;
   m_LabelOption = DIAL_LABEL_HORIZONTAL;
+  m_StaticLayerScheme = m_StaticLayerAngle = m_StaticLayerTitle = -1;
+  m_bRotatingScale = false;
 }
 
 wxSize DashboardInstrument_Dial::GetSize(int orient, wxSize hint) {
@@ -79,10 +86,10 @@ wxSize DashboardInstrument_Dial::GetSize(int orient, wxSize hint) {
   int w;
   wxFont f;
   if (m_Properties)
-      f = m_Properties->m_TitelFont.GetChosenFont();
+      f = m_Properties->Style().m_TitelFont.GetChosenFont();
   else
       f = g_pFontTitle->GetChosenFont();
-  dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
+  GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
   if (orient == wxHORIZONTAL) {
     w = wxMax(hint.y, DefaultWidth + m_TitleHeight);
     return wxSize(w - m_TitleHeight, w);
@@ -104,58 +111,83 @@ void DashboardInstrument_Dial::SetData(DASH_CAP st, double data,
   Refresh();
 }
 
-void DashboardInstrument_Dial::Draw(wxGCDC* bdc) {
+void DashboardInstrument_Dial::SetCapStale(DASH_CAP val, bool stale) {
+  if (!m_cap_flag.test(val) || m_stale_flag.test(val) == stale) return;
+  m_stale_flag.set(val, stale);
+  // Park the needle, the value text shows "---" while stale
+  if (stale && val == m_MainValueCap) m_MainValue = m_MainValueMin;
+  Refresh();
+}
 
-  if (m_Properties)
-  {
-      wxBrush b1(GetColourSchemeBackgroundColour(m_Properties->m_DataBackgroundColour));
-      bdc->SetBackground(b1);
+void DashboardInstrument_Dial::Draw(wxGCDC* bdc) {
+  DrawStaticLayer(bdc);
+  if (m_bRotatingScale) {
+    DrawLabels(bdc);
+    DrawMarkers(bdc);
   }
-  else
-  {
-      wxColour c1;
-      GetGlobalColor(_T("DASHB"), &c1);
-      wxBrush b1(c1);
-      bdc->SetBackground(b1);
+  DrawBackground(bdc);
+  DrawData(bdc, IsCapStale(m_MainValueCap) ? NAN : m_MainValue,
+           m_MainValueUnit, m_MainValueFormat, m_MainValueOption);
+  DrawData(bdc, IsCapStale(m_ExtraValueCap) ? NAN : m_ExtraValue,
+           m_ExtraValueUnit, m_ExtraValueFormat, m_ExtraValueOption);
+  DrawForeground(bdc);
+}
+
+// The static layer is rendered into m_StaticLayer only when size, colour
+// scheme, start angle or title height did change, or ResetCache() was
+// called. Otherwise it is just blitted. With m_bRotatingScale (the compass
+// turns the start angle with every heading) labels and markers are not
+// part of it, Draw() draws them every time.
+// m_cx, m_cy and m_radius are kept from the last rendering.
+void DashboardInstrument_Dial::DrawStaticLayer(wxGCDC* bdc) {
+  wxSize size = GetClientSize();
+  if (size.x <= 0 || size.y <= 0) return;  // Not laid out yet
+  if (!m_StaticLayer.IsOk() || size != m_StaticLayerSize ||
+      (int)aktuellColorScheme != m_StaticLayerScheme ||
+      (!m_bRotatingScale && m_AngleStart != m_StaticLayerAngle) ||
+      m_TitleHeight != m_StaticLayerTitle) {
+    m_StaticLayer.Create(size.x, size.y);
+    wxMemoryDC mdc(m_StaticLayer);
+    wxGCDC dc(mdc);
+    dc.SetBackground(Palette().m_DataBackgroundBrush);
+    dc.Clear();
+
+    CalculateGeometry(&dc);
+    DrawFrame(&dc);
+    if (!m_bRotatingScale) {
+      DrawLabels(&dc);
+      DrawMarkers(&dc);
+    }
+    mdc.SelectObject(wxNullBitmap);
+
+    m_StaticLayerSize = size;
+    m_StaticLayerScheme = aktuellColorScheme;
+    m_StaticLayerAngle = m_AngleStart;
+    m_StaticLayerTitle = m_TitleHeight;
   }
-  bdc->Clear();
+  bdc->DrawBitmap(m_StaticLayer, 0, 0);
+}
 
+void DashboardInstrument_Dial::CalculateGeometry(wxGCDC* bdc) {
   wxSize size = GetClientSize();
   m_cx = size.x / 2;
   int availableHeight = size.y - m_TitleHeight - 6;
   int width, height;
   wxFont f;
   if (m_Properties)
-    f = m_Properties->m_LabelFont.GetChosenFont();
+    f = m_Properties->Style().m_LabelFont.GetChosenFont();
   else
     f = g_pFontLabel->GetChosenFont();
-  bdc->GetTextExtent(_T("000"), &width, &height, 0, 0, &f);
+  GetTextExtentCached(*bdc, _T("000"), &width, &height, f);
   m_cy = m_TitleHeight + 2;
   m_cy += availableHeight / 2;
   m_radius = availableHeight / 2;
-
-  DrawFrame(bdc);
-  DrawLabels(bdc);
-  DrawMarkers(bdc);
-  DrawBackground(bdc);
-  DrawData(bdc, m_MainValue, m_MainValueUnit, m_MainValueFormat,
-           m_MainValueOption);
-  DrawData(bdc, m_ExtraValue, m_ExtraValueUnit, m_ExtraValueFormat,
-           m_ExtraValueOption);
-  DrawForeground(bdc);
 }
 
 void DashboardInstrument_Dial::DrawFrame(wxGCDC* dc) {
   wxSize size = GetClientSize();
   wxColour cl;
-  if (m_Properties)
-  {
-      cl = GetColourSchemeBackgroundColour(m_Properties->m_TitlelBackgroundColour);
-  }
-  else
-  {
-      GetGlobalColor(_T("DASHL"), &cl);
-  }
+  cl = Palette().m_TitleBackground;
   dc->SetTextForeground(cl);
   dc->SetBrush(*wxTRANSPARENT_BRUSH);
 
@@ -165,7 +197,7 @@ void DashboardInstrument_Dial::DrawFrame(wxGCDC* dc) {
   // BUG BUG Implement LOW & HIGH WARNING
   if (m_MarkerOption == DIAL_MARKER_WARNING_LOW) {
       pen.SetWidth(penwidth * 2);
-      GetGlobalColor(_T("DASHR"), &cl);
+      cl = DashColour(DC_DASHR);
       pen.SetColour(cl);
       dc->SetPen(pen);
       double angle1 = deg2rad(168); // 135 + 1/8 of270
@@ -179,7 +211,7 @@ void DashboardInstrument_Dial::DrawFrame(wxGCDC* dc) {
 
       // Some platforms have trouble with transparent pen.
       // so we simply draw arcs for the outer ring.
-      GetGlobalColor(_T("DASHF"), &cl);
+      cl = DashColour(DC_DASHF);
       pen.SetWidth(penwidth);
       pen.SetColour(cl);
       dc->SetPen(pen);
@@ -197,7 +229,7 @@ void DashboardInstrument_Dial::DrawFrame(wxGCDC* dc) {
   }
   else if (m_MarkerOption == DIAL_MARKER_WARNING_HIGH) {
       pen.SetWidth(penwidth * 2);
-      GetGlobalColor(_T("DASHR"), &cl);
+      cl = DashColour(DC_DASHR);
       pen.SetColour(cl);
       dc->SetPen(pen);
       double angle1 = deg2rad(45); // 45
@@ -211,7 +243,7 @@ void DashboardInstrument_Dial::DrawFrame(wxGCDC* dc) {
 
       // Some platforms have trouble with transparent pen.
       // so we simply draw arcs for the outer ring.
-      GetGlobalColor(_T("DASHF"), &cl);
+      cl = DashColour(DC_DASHF);
       pen.SetWidth(penwidth);
       pen.SetColour(cl);
       dc->SetPen(pen);
@@ -230,7 +262,7 @@ void DashboardInstrument_Dial::DrawFrame(wxGCDC* dc) {
   //  For battery status
   else if (m_MarkerOption == DIAL_MARKER_GREEN_MID) {
       pen.SetWidth(penwidth * 2);
-      GetGlobalColor(_T("DASHG"), &cl);
+      cl = DashColour(DC_DASHG);
       pen.SetColour(cl);
       dc->SetPen(pen);
       double angle1 = deg2rad(330); // 270 + 1/4 of 270
@@ -244,7 +276,7 @@ void DashboardInstrument_Dial::DrawFrame(wxGCDC* dc) {
 
       // Some platforms have trouble with transparent pen.
       // so we simply draw arcs for the outer ring.
-      GetGlobalColor(_T("DASHF"), &cl);
+      cl = DashColour(DC_DASHF);
       pen.SetWidth(penwidth);
       pen.SetColour(cl);
       dc->SetPen(pen);
@@ -263,7 +295,7 @@ void DashboardInstrument_Dial::DrawFrame(wxGCDC* dc) {
 
   else if (m_MarkerOption == DIAL_MARKER_REDGREENBAR) {
     pen.SetWidth(penwidth * 2);
-    GetGlobalColor(_T("DASHR"), &cl);
+    cl = DashColour(DC_DASHR);
     pen.SetColour(cl);
     dc->SetPen(pen);
     double angle1 = deg2rad(270);  // 305-ANGLE_OFFSET
@@ -275,7 +307,7 @@ void DashboardInstrument_Dial::DrawFrame(wxGCDC* dc) {
     wxCoord y2 = m_cy + ((radi)*sin(angle2));
     dc->DrawArc(x1, y1, x2, y2, m_cx, m_cy);
 
-    GetGlobalColor(_T("DASHG"), &cl);
+    cl = DashColour(DC_DASHG);
     pen.SetColour(cl);
     dc->SetPen(pen);
     angle1 = deg2rad(89);   // 305-ANGLE_OFFSET
@@ -288,7 +320,7 @@ void DashboardInstrument_Dial::DrawFrame(wxGCDC* dc) {
 
     // Some platforms have trouble with transparent pen.
     // so we simply draw arcs for the outer ring.
-    GetGlobalColor(_T("DASHF"), &cl);
+    cl = DashColour(DC_DASHF);
     pen.SetWidth(penwidth);
     pen.SetColour(cl);
     dc->SetPen(pen);
@@ -304,7 +336,7 @@ void DashboardInstrument_Dial::DrawFrame(wxGCDC* dc) {
     dc->DrawArc(x2, y2, x1, y1, m_cx, m_cy);
 
   } else {
-    GetGlobalColor(_T("DASHF"), &cl);
+    cl = DashColour(DC_DASHF);
     pen.SetColour(cl);
     dc->SetPen(pen);
     dc->DrawCircle(m_cx, m_cy, m_radius);
@@ -315,7 +347,7 @@ void DashboardInstrument_Dial::DrawMarkers(wxGCDC* dc) {
   if (m_MarkerOption == DIAL_MARKER_NONE) return;
 
   wxColour cl;
-  GetGlobalColor(_T("DASHF"), &cl);
+  cl = DashColour(DC_DASHF);
   int penwidth = GetClientSize().x / 100;
   wxPen pen(cl, penwidth, wxPENSTYLE_SOLID);
   dc->SetPen(pen);
@@ -332,11 +364,11 @@ void DashboardInstrument_Dial::DrawMarkers(wxGCDC* dc) {
     if (m_MarkerOption == DIAL_MARKER_REDGREEN) {
       int a = int(angle + ANGLE_OFFSET) % 360;
       if (a > 180)
-        GetGlobalColor(_T("DASHR"), &cl);
+        cl = DashColour(DC_DASHR);
       else if ((a > 0) && (a < 180))
-        GetGlobalColor(_T("DASHG"), &cl);
+        cl = DashColour(DC_DASHG);
       else
-        GetGlobalColor(_T("DASHF"), &cl);
+        cl = DashColour(DC_DASHF);
 
       pen.SetColour(cl);
       dc->SetPen(pen);
@@ -355,7 +387,7 @@ void DashboardInstrument_Dial::DrawMarkers(wxGCDC* dc) {
   }
   // We must reset pen color so following drawings are fine
   if (m_MarkerOption == DIAL_MARKER_REDGREEN) {
-    GetGlobalColor(_T("DASHF"), &cl);
+    cl = DashColour(DC_DASHF);
     pen.SetStyle(wxPENSTYLE_SOLID);
     pen.SetColour(cl);
     dc->SetPen(pen);
@@ -368,17 +400,17 @@ void DashboardInstrument_Dial::DrawLabels(wxGCDC* dc) {
   wxPoint TextPoint;
   wxPen pen;
   wxColor cl;
-  GetGlobalColor(_T("DASHF"), &cl);
+  cl = DashColour(DC_DASHF);
 
   if (m_Properties)
   {
-      dc->SetFont(m_Properties->m_SmallFont.GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_SmallFont.GetColour()));
+      dc->SetFont(m_Properties->Style().m_SmallFont.GetChosenFont());
+      dc->SetTextForeground(Palette().m_SmallFont);
   }
   else
   {
       dc->SetFont(g_pFontSmall->GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(g_pFontSmall->GetColour()));
+      dc->SetTextForeground(Palette().m_SmallFont);
   }
   int diff_angle = m_AngleStart + m_AngleRange - ANGLE_OFFSET;
   // angle between markers
@@ -415,10 +447,10 @@ void DashboardInstrument_Dial::DrawLabels(wxGCDC* dc) {
               : wxString::Format(_T("%d"), value));
       }
     if (m_Properties)
-        f = m_Properties->m_SmallFont.GetChosenFont();
+        f = m_Properties->Style().m_SmallFont.GetChosenFont();
     else
         f = g_pFontSmall->GetChosenFont();
-    dc->GetTextExtent(label, &width, &height, 0, 0, &f);
+    GetTextExtentCached(*dc, label, &width, &height, f);
     double halfW = width / 2;
     if ((m_LabelOption == DIAL_LABEL_HORIZONTAL) || (m_LabelOption == DIAL_LABEL_FRACTIONS)) {
       double halfH = height / 2;
@@ -457,13 +489,13 @@ void DashboardInstrument_Dial::DrawData(wxGCDC* dc, double value, wxString unit,
 
   if (m_Properties)
   {
-      dc->SetFont(m_Properties->m_LabelFont.GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_LabelFont.GetColour()));
+      dc->SetFont(m_Properties->Style().m_LabelFont.GetChosenFont());
+      dc->SetTextForeground(Palette().m_LabelFont);
   }
   else
   {
       dc->SetFont(g_pFontLabel->GetChosenFont());      
-      dc->SetTextForeground(GetColourSchemeFont(g_pFontLabel->GetColour()));
+      dc->SetTextForeground(Palette().m_LabelFont);
   }
   wxColour cl;
   //GetGlobalColor(_T("DASHF"), &cl);
@@ -493,7 +525,7 @@ void DashboardInstrument_Dial::DrawData(wxGCDC* dc, double value, wxString unit,
   int width, height;
   wxFont f;
   if (m_Properties)
-    f = m_Properties->m_LabelFont.GetChosenFont();
+    f = m_Properties->Style().m_LabelFont.GetChosenFont();
   else
     f = g_pFontLabel->GetChosenFont();
   dc->GetMultiLineTextExtent(text, &width, &height, NULL, &f);
@@ -509,18 +541,12 @@ void DashboardInstrument_Dial::DrawData(wxGCDC* dc, double value, wxString unit,
     case DIAL_POSITION_INSIDE: {
       TextPoint.x = m_cx - (width / 2) - 1;
       TextPoint.y = (size.y * .75) - height;
-      if (m_Properties)
-          cl = GetColourSchemeBackgroundColour(m_Properties->m_TitlelBackgroundColour);
-      else
-          GetGlobalColor(_T("DASHL"), &cl);
+      cl = Palette().m_TitleBackground;
       int penwidth = size.x / 100;
       wxPen* pen =
           wxThePenList->FindOrCreatePen(cl, penwidth, wxPENSTYLE_SOLID);
       dc->SetPen(*pen);
-      if (m_Properties)
-          cl = GetColourSchemeBackgroundColour(m_Properties->m_DataBackgroundColour);
-      else
-        GetGlobalColor(_T("DASHB"), &cl);
+      cl = Palette().m_DataBackground;
       dc->SetBrush(cl);
       // There might be a background drawn below
       // so we must clear it first.
@@ -549,7 +575,7 @@ void DashboardInstrument_Dial::DrawData(wxGCDC* dc, double value, wxString unit,
   //wxColour c2;
   //GetGlobalColor(_T("DASHB"), &c2);
   wxColour c3;
-  GetGlobalColor(_T("DASHF"), &c3);
+  c3 = DashColour(DC_DASHF);
 
   wxStringTokenizer tkz(text, _T("\n"));
   wxString token;
@@ -557,7 +583,7 @@ void DashboardInstrument_Dial::DrawData(wxGCDC* dc, double value, wxString unit,
   token = tkz.GetNextToken();
   while (token.Length()) {
     if(m_Properties)
-        f = m_Properties->m_LabelFont.GetChosenFont();
+        f = m_Properties->Style().m_LabelFont.GetChosenFont();
     else
         f = g_pFontLabel->GetChosenFont();
     dc->GetTextExtent(token, &width, &height, NULL, NULL, &f);
@@ -570,13 +596,13 @@ void DashboardInstrument_Dial::DrawData(wxGCDC* dc, double value, wxString unit,
 void DashboardInstrument_Dial::DrawForeground(wxGCDC* dc) {
   // The default foreground is the arrow used in most dials
   wxColour cl;
-  GetGlobalColor(_T("DASH2"), &cl);
+  cl = DashColour(DC_DASH2);
   wxPen pen1;
   pen1.SetStyle(wxPENSTYLE_SOLID);
   pen1.SetColour(cl);
   pen1.SetWidth(2);
   dc->SetPen(pen1);
-  GetGlobalColor(_T("DASH1"), &cl);
+  cl = DashColour(DC_DASH1);
   wxBrush brush1;
   brush1.SetStyle(wxBRUSHSTYLE_SOLID);
   brush1.SetColour(cl);
@@ -584,10 +610,7 @@ void DashboardInstrument_Dial::DrawForeground(wxGCDC* dc) {
   dc->DrawCircle(m_cx, m_cy, m_radius / 8);
 
   dc->SetPen(*wxTRANSPARENT_PEN);
-  if (m_Properties)
-      cl = GetColourSchemeFont(m_Properties->m_Arrow_First_Colour);
-  else
-    GetGlobalColor(_T("DASHN"), &cl);
+  cl = Palette().m_ArrowFirst;
   wxBrush brush;
   brush.SetStyle(wxBRUSHSTYLE_SOLID);
   brush.SetColour(cl);
@@ -635,17 +658,17 @@ void DrawCompassRose(wxGCDC* dc, int cx, int cy, int radius, int startangle,
   wxString CompassArray[] = {_("N"),  _("NE"), _("E"),  _("SE"), _("S"),
                              _("SW"), _("W"),  _("NW"), _("N")};
   if (Properties)
-      dc->SetFont((Properties->m_SmallFont.GetChosenFont()));
+      dc->SetFont((Properties->Style().m_SmallFont.GetChosenFont()));
   else
       dc->SetFont((g_pFontSmall->GetChosenFont()));
 
   wxColour cl;
   wxPen* pen;
-  GetGlobalColor(_T("DASH2"), &cl);
+  cl = DashColour(DC_DASH2);
   pen = wxThePenList->FindOrCreatePen(cl, 1, wxPENSTYLE_SOLID);
   wxBrush* b2 = wxTheBrushList->FindOrCreateBrush(cl);
 
-  GetGlobalColor(_T("DASH1"), &cl);
+  cl = DashColour(DC_DASH1);
   wxBrush* b1 = wxTheBrushList->FindOrCreateBrush(cl);
 
   dc->SetPen(*pen);
@@ -659,11 +682,11 @@ void DrawCompassRose(wxGCDC* dc, int cx, int cy, int radius, int startangle,
     if (showlabels) {
       Value = CompassArray[offset];
       if (Properties) {
-        f = Properties->m_SmallFont.GetChosenFont();
-        dc->GetTextExtent(Value, &width, &height, 0, 0, &f);
+        f = Properties->Style().m_SmallFont.GetChosenFont();
+        GetTextExtentCached(*dc, Value, &width, &height, f);
       } else {
         f = g_pFontSmall->GetChosenFont();
-        dc->GetTextExtent(Value, &width, &height, 0, 0, &f);
+        GetTextExtentCached(*dc, Value, &width, &height, f);
       }
       double x = width / 2;
       long double anglefortext = tmpangle - rad2deg(asin((x / radius)));
@@ -672,11 +695,11 @@ void DrawCompassRose(wxGCDC* dc, int cx, int cy, int radius, int startangle,
       dc->DrawRotatedText(Value, pt.x, pt.y, -90 - tmpangle);
       Value = CompassArray[offset + 1];
       if (Properties) {
-        f = Properties->m_SmallFont.GetChosenFont();
-        dc->GetTextExtent(Value, &width, &height, 0, 0, &f);
+        f = Properties->Style().m_SmallFont.GetChosenFont();
+        GetTextExtentCached(*dc, Value, &width, &height, f);
       } else {
         f = g_pFontSmall->GetChosenFont();
-        dc->GetTextExtent(Value, &width, &height, 0, 0, &f);
+        GetTextExtentCached(*dc, Value, &width, &height, f);
       }
       x = width / 2;
       anglefortext = tmpangle - rad2deg(asin((x / radius))) + 45;
@@ -708,13 +731,63 @@ void DrawCompassRose(wxGCDC* dc, int cx, int cy, int radius, int startangle,
   }
 }
 
+void CompassRoseSprite::Draw(wxGCDC* dc, int cx, int cy, int radius,
+                             int startangle, bool showlabels,
+                             InstrumentProperties* Properties) {
+  wxGraphicsContext* gc = dc->GetGraphicsContext();
+  if (!gc || radius <= 0) {
+    DrawCompassRose(dc, cx, cy, radius, startangle, showlabels, Properties);
+    return;
+  }
+
+  if (!m_Bitmap.IsOk() || radius != m_radius || showlabels != m_showlabels ||
+      (int)aktuellColorScheme != m_scheme) {
+    // The labels are drawn outside of the radius
+    int width, height = 0;
+    if (showlabels) {
+      wxFont f;
+      if (Properties)
+        f = Properties->Style().m_SmallFont.GetChosenFont();
+      else
+        f = g_pFontSmall->GetChosenFont();
+      GetTextExtentCached(*dc, _T("NW"), &width, &height, f);
+    }
+    m_half = radius + height + 2;
+
+    // Drawn on a fully transparent 32 bit bitmap, so the anti-aliased
+    // edges blend with any background. A colour key mask would keep them
+    // mixed with the key colour.
+    int size = 2 * m_half + 1;
+    wxImage image(size, size);
+    image.InitAlpha();
+    memset(image.GetAlpha(), 0, size * size);
+    m_Bitmap = wxBitmap(image, 32);
+    {
+      wxMemoryDC mdc(m_Bitmap);
+      wxGCDC gdc(mdc);
+      DrawCompassRose(&gdc, m_half, m_half, radius, 0, showlabels, Properties);
+      mdc.SelectObject(wxNullBitmap);
+    }
+
+    m_radius = radius;
+    m_showlabels = showlabels;
+    m_scheme = aktuellColorScheme;
+  }
+
+  gc->PushState();
+  gc->Translate(cx, cy);
+  gc->Rotate(deg2rad(startangle));
+  gc->DrawBitmap(m_Bitmap, -m_half, -m_half, 2 * m_half + 1, 2 * m_half + 1);
+  gc->PopState();
+}
+
 void DrawBoat(wxGCDC* dc, int cx, int cy, int radius) {
   // Now draw the boat
   wxColour cl;
-  GetGlobalColor(_T("DASH2"), &cl);
+  cl = DashColour(DC_DASH2);
   wxPen* pen = wxThePenList->FindOrCreatePen(cl, 1, wxPENSTYLE_SOLID);
   dc->SetPen(*pen);
-  GetGlobalColor(_T("DASH1"), &cl);
+  cl = DashColour(DC_DASH1);
   dc->SetBrush(cl);
   wxPoint points[7];
 
@@ -56,7 +56,7 @@ void DashboardInstrument_FromOwnship::Draw(wxGCDC* dc) {
 
   dc->SetFont((g_pFontData->GetChosenFont()));
   // dc.SetTextForeground(pFontMgr->GetFontColor(_T("Dashboard Data")));
-  GetGlobalColor(_T("DASHF"), &cl);
+  cl = DashColour(DC_DASHF);
   dc->SetTextForeground(cl);
 
   dc->DrawText(m_data1, 10, m_TitleHeight);
@@ -91,9 +91,9 @@ wxSize DashboardInstrument_FromOwnship::GetSize(int orient, wxSize hint) {
   wxClientDC dc(this);
   int w;
   wxFont f = g_pFontTitle->GetChosenFont();
-  dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
+  GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
   f = g_pFontData->GetChosenFont();
-  dc.GetTextExtent(_T("000.00 NMi"), &w, &m_DataHeight, 0, 0, &f);
+  GetTextExtentCached(dc, _T("000.00 NMi"), &w, &m_DataHeight, f);
 
   if (orient == wxHORIZONTAL) {
     return wxSize(w + 10, wxMax(hint.y, m_TitleHeight + m_DataHeight * 2));
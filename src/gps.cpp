@@ -78,10 +78,10 @@ wxSize DashboardInstrument_GPS::GetSize(int orient, wxSize hint) {
   int w;
   wxFont f;
   if(m_Properties)
-      f = m_Properties->m_TitelFont.GetChosenFont();
+      f = m_Properties->Style().m_TitelFont.GetChosenFont();
   else
       f = g_pFontTitle->GetChosenFont();
-  dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
+  GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
   w = (12 * m_refDim);  // Max 12 vertical bars
   if (orient == wxHORIZONTAL) {
     m_cx = w / 2;
@@ -205,32 +205,26 @@ void DashboardInstrument_GPS::Draw(wxGCDC* dc) {
 void DashboardInstrument_GPS::DrawFrame(wxGCDC* dc) {
   wxSize size = GetClientSize();
   wxColour cb;
-  if (m_Properties)
-      cb = GetColourSchemeBackgroundColour(m_Properties->m_DataBackgroundColour);
-  else
-      GetGlobalColor(_T("DASHB"), &cb);
+  cb = Palette().m_DataBackground;
   dc->SetTextBackground(cb);
   dc->SetBackgroundMode(wxSOLID);
 
   wxColour cl;
-  if (m_Properties)
-      cl = GetColourSchemeBackgroundColour(m_Properties->m_TitlelBackgroundColour);
-  else
-      GetGlobalColor(_T("DASHL"), &cl);
+  cl = Palette().m_TitleBackground;
   dc->SetTextForeground(cl);
   dc->SetBrush(*wxTRANSPARENT_BRUSH);
 
   wxPen pen;
   pen.SetStyle(wxPENSTYLE_SOLID);
   wxColour cf;
-  GetGlobalColor(_T("DASHF"), &cf);
+  cf = DashColour(DC_DASHF);
   pen.SetColour(cf);
   pen.SetWidth(1);
   dc->SetPen(pen);
 
   dc->DrawCircle(m_cx, m_cy, m_radius);
   if (m_Properties)
-      dc->SetFont((m_Properties->m_SmallFont.GetChosenFont()));
+      dc->SetFont((m_Properties->Style().m_SmallFont.GetChosenFont()));
   else
       dc->SetFont((g_pFontSmall->GetChosenFont()));
 
@@ -238,10 +232,10 @@ void DashboardInstrument_GPS::DrawFrame(wxGCDC* dc) {
   int height, width;
   wxFont f;
   if (m_Properties)
-    f = m_Properties->m_SmallFont.GetChosenFont();
+    f = m_Properties->Style().m_SmallFont.GetChosenFont();
   else
     f = g_pFontSmall->GetChosenFont();
-  sdc.GetTextExtent(_T("W"), &width, &height, NULL, NULL, &f);
+  GetTextExtentCached(sdc, _T("W"), &width, &height, f);
 
   wxBitmap tbm(width, height, -1);
   wxMemoryDC tdc(tbm);
@@ -251,13 +245,13 @@ void DashboardInstrument_GPS::DrawFrame(wxGCDC* dc) {
   tdc.SetBackgroundMode(wxSOLID);
   if (m_Properties)
   {
-      tdc.SetFont(m_Properties->m_SmallFont.GetChosenFont());
-      tdc.SetTextForeground(GetColourSchemeFont(m_Properties->m_SmallFont.GetColour()));
+      tdc.SetFont(m_Properties->Style().m_SmallFont.GetChosenFont());
+      tdc.SetTextForeground(Palette().m_SmallFont);
   }
   else
   {
       tdc.SetFont(g_pFontSmall->GetChosenFont());
-      tdc.SetTextForeground(GetColourSchemeFont(g_pFontSmall->GetColour()));
+      tdc.SetTextForeground(Palette().m_SmallFont);
   }
   tdc.Clear();
   tdc.DrawText(_("N"), 0, 0);
@@ -308,31 +302,28 @@ void DashboardInstrument_GPS::DrawBackground(wxGCDC* dc) {
   wxScreenDC sdc;
   int height, width;
   if (m_Properties)
-      f = m_Properties->m_SmallFont.GetChosenFont();
+      f = m_Properties->Style().m_SmallFont.GetChosenFont();
   else
       f = g_pFontSmall->GetChosenFont();
-  sdc.GetTextExtent(_T("W"), &width, &height, NULL, NULL, &f);
+  GetTextExtentCached(sdc, _T("W"), &width, &height, f);
 
   wxColour cl;
   wxBitmap tbm(dc->GetSize().x, height, -1);
   wxMemoryDC tdc(tbm);
   wxColour c2;
-  if (m_Properties)
-      c2 = GetColourSchemeBackgroundColour(m_Properties->m_DataBackgroundColour);
-  else
-      GetGlobalColor(_T("DASHB"), &c2);
+  c2 = Palette().m_DataBackground;
   tdc.SetBackground(c2);
   tdc.Clear();
 
   if (m_Properties)
   {
-      tdc.SetFont(m_Properties->m_SmallFont.GetChosenFont());
-      cl = GetColourSchemeFont(m_Properties->m_SmallFont.GetColour());
+      tdc.SetFont(m_Properties->Style().m_SmallFont.GetChosenFont());
+      cl = Palette().m_SmallFont;
   }
   else
   {
       tdc.SetFont(g_pFontSmall->GetChosenFont());
-      GetGlobalColor(_T("DASHF"), &cl);
+      cl = DashColour(DC_DASHF);
   }
   tdc.SetTextForeground(cl);
   tdc.SetTextBackground(c2);
@@ -360,10 +351,7 @@ void DashboardInstrument_GPS::DrawBackground(wxGCDC* dc) {
 
 void DashboardInstrument_GPS::DrawForeground(wxGCDC* dc) {
   wxColour cl;
-  if (m_Properties)
-      cl = GetColourSchemeFont(m_Properties->m_DataFont.GetColour());
-  else
-      cl = GetColourSchemeFont(g_pFontData->GetColour());
+  cl = Palette().m_DataFont;
   //GetGlobalColor(_T("DASHL"), &cl);
   wxBrush brush(cl);
   dc->SetBrush(brush);
@@ -371,15 +359,12 @@ void DashboardInstrument_GPS::DrawForeground(wxGCDC* dc) {
   dc->SetTextBackground(cl);
 
   wxColor cf;
-  GetGlobalColor(_T("DASHF"), &cf);
+  cf = DashColour(DC_DASHF);
   dc->SetTextForeground(cf);
   dc->SetBackgroundMode(wxSOLID);
 
   wxColour cb;
-  if (m_Properties)
-      cb = GetColourSchemeBackgroundColour(m_Properties->m_TitlelBackgroundColour);
-  else
-      GetGlobalColor(_T("DASHL"), &cb);
+  cb = Palette().m_TitleBackground;
   dc->SetTextBackground(cb);
 
   int m_scaleDelta = m_refDim / 2;
@@ -403,10 +388,10 @@ void DashboardInstrument_GPS::DrawForeground(wxGCDC* dc) {
       int width, height;
       wxScreenDC sdc;
       if (m_Properties)
-          f = m_Properties->m_SmallFont.GetChosenFont();
+          f = m_Properties->Style().m_SmallFont.GetChosenFont();
       else
           f = g_pFontSmall->GetChosenFont();
-      sdc.GetTextExtent(label, &width, &height, 0, 0, &f);
+      GetTextExtentCached(sdc, label, &width, &height, f);
 
       wxBitmap tbm(width, height, -1);
       wxMemoryDC tdc(tbm);
@@ -415,13 +400,13 @@ void DashboardInstrument_GPS::DrawForeground(wxGCDC* dc) {
 
       if (m_Properties)
       {
-          tdc.SetFont(m_Properties->m_SmallFont.GetChosenFont());
-          tdc.SetTextForeground(GetColourSchemeFont(m_Properties->m_SmallFont.GetColour()));
+          tdc.SetFont(m_Properties->Style().m_SmallFont.GetChosenFont());
+          tdc.SetTextForeground(Palette().m_SmallFont);
       }
       else
       {
           tdc.SetFont(g_pFontSmall->GetChosenFont());
-          tdc.SetTextForeground(GetColourSchemeFont(g_pFontSmall->GetColour()));
+          tdc.SetTextForeground(Palette().m_SmallFont);
       }
       tdc.SetBackgroundMode(wxSOLID);
       tdc.SetTextBackground(cb);
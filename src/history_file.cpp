@@ -0,0 +1,211 @@
+/******************************************************************************
+ * history_file.cpp
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Persistent history file of the history instruments
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+
+#include "history_file.h"
+#include <wx/filename.h>
+#include <wx/datetime.h>
+#include <cstddef>
+#include <cstring>
+#include <set>
+#include "../../../include/ocpn_plugin.h"
+
+#define HISTORY_FILE_MAGIC 0x49484244  // "DBHI"
+
+// Files written by an open HistoryFile
+static std::set<wxString> s_Writers;
+
+static uint32_t Crc32(const void *data, size_t len) {
+  static uint32_t table[256];
+  if (!table[1]) {
+    for (uint32_t i = 0; i < 256; i++) {
+      uint32_t c = i;
+      for (int k = 0; k < 8; k++) c = c & 1 ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+      table[i] = c;
+    }
+  }
+  const unsigned char *p = (const unsigned char *)data;
+  uint32_t crc = 0xFFFFFFFF;
+  for (size_t i = 0; i < len; i++) crc = table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+  return crc ^ 0xFFFFFFFF;
+}
+
+HistoryFile::HistoryFile() : m_size(0) {
+  memset(&m_header, 0, sizeof(m_header));
+}
+
+void HistoryFile::MakeHeader(const HistoryTiers &tiers, int tag) {
+  m_header.magic = HISTORY_FILE_MAGIC;
+  m_header.version = HISTORY_FILE_VERSION;
+  m_header.interval = tiers.m_interval;
+  m_header.series = tiers.m_series;
+  m_header.tag = tag;
+  m_size = sizeof(Header);
+  for (int t = 0; t < HT_TIERS; t++) {
+    m_header.count[t] = tiers.m_tier[t].m_count;
+    m_columns[t] = tiers.m_tier[t].m_series;
+    m_base[t] = m_size;
+    m_size += RecordSize(t) * m_header.count[t];
+  }
+  m_header.crc = Crc32(&m_header, offsetof(Header, crc));
+}
+
+void HistoryFile::Open(const wxString &name, HistoryTiers &tiers, int tag) {
+  Close();
+  MakeHeader(tiers, tag);
+  wxFileName fn(*GetpPrivateApplicationDataLocation(), name);
+  fn.AppendDir(_T("plugins"));
+  fn.AppendDir(_T("dashboard_pi"));
+  if (!fn.DirExists() && !fn.Mkdir(wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL)) return;
+  wxString path = fn.GetFullPath();
+
+  // Restore with a single read, an unusable file is started over
+  bool valid = false;
+  if (fn.FileExists()) {
+    wxFile file(path);
+    std::vector<char> data(m_size);
+    if (file.IsOpened() && file.Length() == (wxFileOffset)m_size &&
+        file.Read(&data[0], m_size) == (ssize_t)m_size &&
+        memcmp(&data[0], &m_header, sizeof(Header)) == 0) {
+      Restore(tiers, data);
+      valid = true;
+    }
+  }
+  m_path = path;
+  if (s_Writers.count(path)) return;  // Taken over later by Claim()
+  if (!m_file.Open(path, valid ? wxFile::read_write : wxFile::write)) return;
+  s_Writers.insert(path);
+  if (!valid) Clear(tiers, tag);
+}
+
+void HistoryFile::Close(void) {
+  if (m_file.IsOpened()) {
+    m_file.Close();
+    s_Writers.erase(m_path);
+  }
+  m_path.Clear();
+}
+
+// Takes over a file whose writer was closed. The file is written again
+// from the tiers, the old writer may have had other samples.
+bool HistoryFile::Claim(const HistoryTiers &tiers) {
+  if (m_file.IsOpened()) return true;
+  if (m_path.IsEmpty() || s_Writers.count(m_path)) return false;
+  if (!m_file.Open(m_path, wxFile::write)) return false;
+  s_Writers.insert(m_path);
+  std::vector<char> data(m_size, 0);
+  memcpy(&data[0], &m_header, sizeof(Header));
+  for (int t = 0; t < HT_TIERS; t++) {
+    const HistoryStore &store = tiers.m_tier[t];
+    int count = store.m_count;
+    for (int i = count - tiers.m_samples[t]; i < count; i++) {
+      int slot = store.Slot(i);
+      PackRecord(store, t, slot, &data[m_base[t] + slot * RecordSize(t)]);
+    }
+  }
+  m_file.Write(&data[0], m_size);
+  return true;
+}
+
+void HistoryFile::PackRecord(const HistoryStore &store, int tier, int slot,
+                             char *rec) const {
+  size_t size = RecordSize(tier);
+  memcpy(rec, &store.m_times[slot], 4);
+  for (int c = 0; c < m_columns[tier]; c++)
+    memcpy(rec + 4 + c * 4, &store.m_values[c * store.m_count + slot], 4);
+  uint32_t crc = Crc32(rec, size - 4);
+  memcpy(rec + size - 4, &crc, 4);
+}
+
+// Walks back from the newest valid record of each tier as long as the
+// records are valid, older than their successor and within the span of
+// the tier. These slots are copied into the store, at the same position.
+void HistoryFile::Restore(HistoryTiers &tiers,
+                          const std::vector<char> &data) const {
+  time_t now = wxDateTime::Now().GetTicks();
+  for (int t = 0; t < HT_TIERS; t++) {
+    HistoryStore &store = tiers.m_tier[t];
+    int count = store.m_count;
+    size_t size = RecordSize(t);
+    const char *base = &data[m_base[t]];
+    int newest = -1;
+    uint32_t newestTime = 0;
+    for (int slot = 0; slot < count; slot++) {
+      const char *rec = base + slot * size;
+      uint32_t time, crc;
+      memcpy(&time, rec, 4);
+      memcpy(&crc, rec + size - 4, 4);
+      if (time > newestTime && Crc32(rec, size - 4) == crc) {
+        newest = slot;
+        newestTime = time;
+      }
+    }
+    if (newest < 0) continue;
+
+    time_t oldest = now - tiers.GetSpan(t);
+    uint32_t limit =
+        oldest > HISTORY_EPOCH ? (uint32_t)(oldest - HISTORY_EPOCH) : 1;
+    uint32_t prev = newestTime + 1;
+    int n = 0;
+    for (; n < count; n++) {
+      int slot = newest - n < 0 ? newest - n + count : newest - n;
+      const char *rec = base + slot * size;
+      uint32_t time, crc;
+      memcpy(&time, rec, 4);
+      memcpy(&crc, rec + size - 4, 4);
+      if (time >= prev || time < limit || Crc32(rec, size - 4) != crc) break;
+      store.m_times[slot] = time;
+      for (int c = 0; c < m_columns[t]; c++)
+        memcpy(&store.m_values[c * count + slot], rec + 4 + c * 4, 4);
+      prev = time;
+    }
+    store.m_start = newest + 1 == count ? 0 : newest + 1;
+    tiers.m_samples[t] = n;
+  }
+}
+
+void HistoryFile::Append(const HistoryTiers &tiers, unsigned added) {
+  if (!Claim(tiers)) return;
+  for (int t = 0; t < HT_TIERS; t++) {
+    if (!(added & (1u << t))) continue;
+    const HistoryStore &store = tiers.m_tier[t];
+    int slot = store.Slot(store.m_count - 1);
+    size_t size = RecordSize(t);
+    m_record.resize(size);
+    PackRecord(store, t, slot, &m_record[0]);
+    if (m_file.Seek(m_base[t] + slot * size) != wxInvalidOffset)
+      m_file.Write(&m_record[0], size);
+  }
+}
+
+void HistoryFile::Clear(const HistoryTiers &tiers, int tag) {
+  // Also when not writing, the header is used by a later Claim()
+  MakeHeader(tiers, tag);
+  if (!m_file.IsOpened()) return;
+  std::vector<char> data(m_size, 0);
+  memcpy(&data[0], &m_header, sizeof(Header));
+  m_file.Seek(0);
+  m_file.Write(&data[0], m_size);
+}
@@ -0,0 +1,46 @@
+/******************************************************************************
+ * history_store.cpp
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Compact sample storage of the history instruments
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+
+#include "history_store.h"
+
+HistoryStore::HistoryStore(int series, int count)
+    : m_series(series),
+      m_count(count),
+      m_start(0),
+      m_values(series * count),
+      m_times(count) {}
+
+void HistoryStore::Fill(float value) {
+  m_values.assign(m_values.size(), value);
+  m_times.assign(m_times.size(), 0);
+  m_start = 0;
+}
+
+void HistoryStore::Push(time_t time) {
+  int slot = m_start;
+  if (++m_start == m_count) m_start = 0;
+  m_times[slot] = time > HISTORY_EPOCH ? (uint32_t)(time - HISTORY_EPOCH) : 1;
+}
@@ -0,0 +1,142 @@
+/******************************************************************************
+ * history_tiers.cpp
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Multi-resolution history of the history instruments
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+
+#include "history_tiers.h"
+
+// Seconds per slot of the aggregate tiers, in the order of HT_
+static const int s_Period[HT_TIERS] = {0, 60, 600};
+
+HistoryTiers::HistoryTiers(int series, int count, int interval)
+    : m_series(series), m_interval(interval) {
+  m_tier.push_back(HistoryStore(series, count));
+  m_tier.push_back(HistoryStore(series * HT_KINDS, HISTORY_MINUTE_SLOTS));
+  m_tier.push_back(HistoryStore(series * HT_KINDS, HISTORY_TEN_MINUTE_SLOTS));
+  for (int t = 0; t < HT_TIERS; t++) {
+    m_open[t].min.resize(series);
+    m_open[t].max.resize(series);
+    m_open[t].sum.resize(series);
+  }
+  m_sample = m_open[HT_FULL];
+  Fill(0);
+}
+
+void HistoryTiers::Fill(float value) {
+  for (int t = 0; t < HT_TIERS; t++) {
+    m_tier[t].Fill(value);
+    m_samples[t] = 0;
+    m_open[t].n = 0;
+  }
+}
+
+unsigned HistoryTiers::Aggregate(void) {
+  const HistoryStore &full = m_tier[HT_FULL];
+  int last = full.GetCount() - 1;
+  m_sample.time = full.GetTime(last);
+  m_sample.n = 1;
+  for (int s = 0; s < m_series; s++) {
+    float v = full.Get(s, last);
+    m_sample.min[s] = m_sample.max[s] = v;
+    m_sample.sum[s] = v;
+  }
+  if (m_samples[HT_FULL] < full.GetCount()) m_samples[HT_FULL]++;
+  return (1u << HT_FULL) | Add(HT_MINUTE, m_sample);
+}
+
+void HistoryTiers::Merge(Slot &slot, const Slot &in) {
+  for (int s = 0; s < m_series; s++) {
+    if (in.min[s] < slot.min[s]) slot.min[s] = in.min[s];
+    if (in.max[s] > slot.max[s]) slot.max[s] = in.max[s];
+    slot.sum[s] += in.sum[s];
+  }
+  slot.n += in.n;
+}
+
+unsigned HistoryTiers::Add(int tier, const Slot &in) {
+  Slot &open = m_open[tier];
+  time_t start = in.time - in.time % s_Period[tier];
+  unsigned added = 0;
+  if (open.n && start != open.time) {
+    Close(tier);
+    added |= 1u << tier;
+    if (tier + 1 < HT_TIERS) added |= Add(tier + 1, open);
+    open.n = 0;
+  }
+  if (open.n)
+    Merge(open, in);
+  else {
+    open = in;
+    open.time = start;
+  }
+  return added;
+}
+
+void HistoryTiers::Close(int tier) {
+  const Slot &open = m_open[tier];
+  HistoryStore &store = m_tier[tier];
+  store.Push(open.time);
+  int last = store.GetCount() - 1;
+  for (int s = 0; s < m_series; s++) {
+    store.Set(Column(s, HT_MIN), last, open.min[s]);
+    store.Set(Column(s, HT_MAX), last, open.max[s]);
+    store.Set(Column(s, HT_MEAN), last, (float)(open.sum[s] / open.n));
+  }
+  if (m_samples[tier] < store.GetCount()) m_samples[tier]++;
+}
+
+int HistoryTiers::GetSpan(int tier) const {
+  int period = tier == HT_FULL ? m_interval : s_Period[tier];
+  return period * m_tier[tier].GetCount();
+}
+
+int HistoryTiers::SelectTier(int seconds) const {
+  for (int t = HT_FULL; t < HT_TIERS - 1; t++)
+    if (GetSpan(t) >= seconds) return t;
+  return HT_TIERS - 1;
+}
+
+bool HistoryTiers::GetRange(int tier, int series, double &min,
+                            double &max) const {
+  const HistoryStore &store = m_tier[tier];
+  int count = store.GetCount();
+  int lo = tier == HT_FULL ? series : Column(series, HT_MIN);
+  int hi = tier == HT_FULL ? series : Column(series, HT_MAX);
+  bool found = false;
+  for (int i = count - m_samples[tier]; i < count; i++) {
+    double vmin = store.Get(lo, i), vmax = store.Get(hi, i);
+    if (!found || vmin < min) min = vmin;
+    if (!found || vmax > max) max = vmax;
+    found = true;
+  }
+  // The newest samples are still in the open slots of the finer tiers
+  for (int t = HT_MINUTE; t <= tier; t++) {
+    const Slot &open = m_open[t];
+    if (!open.n) continue;
+    if (!found || open.min[series] < min) min = open.min[series];
+    if (!found || open.max[series] > max) max = open.max[series];
+    found = true;
+  }
+  return found;
+}
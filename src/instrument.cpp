@@ -31,8 +31,12 @@
 #include "wx/wx.h"
 #endif  // precompiled headers
 #include <cmath>
+#include <climits>
+#include <cstring>
+#include <list>
 
 #include "instrument.h"
+#include "startup_profile.h"
 
 #ifdef __OCPN__ANDROID__
 #include "qdebug.h"
@@ -40,6 +44,7 @@
 
  // ColorScheme ... Try only make a simple darker in Night mode. this could be made better.
 extern PI_ColorScheme aktuellColorScheme;
+extern StartupProfile g_StartupProfile;
 
 wxColour GetColourSchemeBackgroundColour(wxColour co)
 {
@@ -116,6 +121,178 @@ wxColour GetColourSchemeFont(wxColour co)
     return ret_val;
 }
 
+// Text extents are asked for the same font and text pairs in every layout
+// and paint, which is slow on GTK/Pango. The key is the native font
+// description, the kind of DC (wxGCDC measures a bit different) and the
+// text. Only titles, units and layout templates are cached; data values
+// are measured directly, as they would flush the cache. The limit only
+// guards against a caller passing them anyway.
+WX_DECLARE_STRING_HASH_MAP(wxSize, TextExtentHashMap);
+static TextExtentHashMap s_TextExtentCache;
+#define TEXT_EXTENT_CACHE_MAX 2048
+
+void GetTextExtentCached(wxDC &dc, const wxString &text, int *w, int *h,
+                         const wxFont &font) {
+  static wxFont s_LastFont;
+  static wxString s_LastDesc;
+  if (!s_LastFont.IsOk() || font != s_LastFont) {
+    s_LastFont = font;
+    s_LastDesc = font.GetNativeFontInfoDesc();
+  }
+  wxString key = s_LastDesc;
+  key += dc.IsKindOf(CLASSINFO(wxGCDC)) ? _T("|G|") : _T("|D|");
+  key += text;
+
+  TextExtentHashMap::iterator it = s_TextExtentCache.find(key);
+  if (it == s_TextExtentCache.end()) {
+    if (s_TextExtentCache.size() >= TEXT_EXTENT_CACHE_MAX)
+      s_TextExtentCache.clear();
+    wxCoord tw, th;
+    dc.GetTextExtent(text, &tw, &th, 0, 0, &font);
+    it = s_TextExtentCache.insert(
+        TextExtentHashMap::value_type(key, wxSize(tw, th))).first;
+  }
+  if (w) *w = it->second.x;
+  if (h) *h = it->second.y;
+}
+
+void ResetTextExtentCache(void) { s_TextExtentCache.clear(); }
+
+// Bumped on every colour scheme or property change, palettes resolved for
+// an older generation are resolved again on their next use.
+static unsigned s_PaletteGeneration = 1;
+static InstrumentPalette s_DefaultPalette;
+
+// In the order of the DC_ enum
+static const wxChar *s_DashColourNames[DC_LAST] = {
+    _T("DASH1"), _T("DASH2"), _T("DASHB"), _T("DASHF"), _T("DASHG"),
+    _T("DASHL"), _T("DASHN"), _T("DASHR"), _T("BLUE3"), _T("UBLCK")};
+
+const wxColour &DashColour(int colour) {
+  static wxColour s_Colours[DC_LAST];
+  static unsigned s_Generation = 0;
+  if (s_Generation != s_PaletteGeneration) {
+    for (int i = 0; i < DC_LAST; i++)
+      GetGlobalColor(s_DashColourNames[i], &s_Colours[i]);
+    s_Generation = s_PaletteGeneration;
+  }
+  return s_Colours[colour];
+}
+
+void InstrumentPalette::Resolve(const InstrumentStyle *style) {
+  if (style) {
+    m_DataBackground =
+        GetColourSchemeBackgroundColour(style->m_DataBackgroundColour);
+    m_TitleBackground =
+        GetColourSchemeBackgroundColour(style->m_TitlelBackgroundColour);
+    m_TitleFont = GetColourSchemeFont(style->m_TitelFont.GetColour());
+    m_DataFont = GetColourSchemeFont(style->m_DataFont.GetColour());
+    m_LabelFont = GetColourSchemeFont(style->m_LabelFont.GetColour());
+    m_SmallFont = GetColourSchemeFont(style->m_SmallFont.GetColour());
+    m_ArrowFirst = GetColourSchemeFont(style->m_Arrow_First_Colour);
+    m_ArrowSecond = GetColourSchemeFont(style->m_Arrow_Second_Colour);
+  } else {
+    m_DataBackground = DashColour(DC_DASHB);
+    m_TitleBackground = DashColour(DC_DASHL);
+    m_TitleFont = GetColourSchemeFont(g_pFontTitle->GetColour());
+    m_DataFont = GetColourSchemeFont(g_pFontData->GetColour());
+    m_LabelFont = GetColourSchemeFont(g_pFontLabel->GetColour());
+    m_SmallFont = GetColourSchemeFont(g_pFontSmall->GetColour());
+    m_ArrowFirst = DashColour(DC_DASHN);
+    m_ArrowSecond = DashColour(DC_BLUE3);
+  }
+  m_DataBackgroundBrush = wxBrush(m_DataBackground);
+  m_TitleBackgroundBrush = wxBrush(m_TitleBackground);
+  m_TitleBackgroundPen = wxPen(m_TitleBackground, 1, wxPENSTYLE_SOLID);
+  m_Generation = s_PaletteGeneration;
+}
+
+// Instruments with equal styles share the palette of the interned style
+const InstrumentPalette &GetInstrumentPalette(InstrumentProperties *Properties) {
+  const InstrumentStyle *style = Properties ? &Properties->Style() : NULL;
+  InstrumentPalette &palette = style ? style->m_Palette : s_DefaultPalette;
+  if (palette.m_Generation != s_PaletteGeneration) palette.Resolve(style);
+  return palette;
+}
+
+void ResetInstrumentPalettes(void) {
+  if (++s_PaletteGeneration == 0) s_PaletteGeneration = 1;
+}
+
+// Interned styles with their number of users. A list, so the addresses
+// handed out stay valid while other styles come and go.
+struct InternedStyle {
+  InstrumentStyle style;
+  int users;
+};
+static std::list<InternedStyle> s_Styles;
+
+static bool IsSameFont(const wxFontData &a, const wxFontData &b) {
+  return a.GetChosenFont() == b.GetChosenFont() &&
+         a.GetColour() == b.GetColour();
+}
+
+bool InstrumentStyle::operator==(const InstrumentStyle &style) const {
+  return IsSameFont(m_TitelFont, style.m_TitelFont) &&
+         IsSameFont(m_DataFont, style.m_DataFont) &&
+         IsSameFont(m_LabelFont, style.m_LabelFont) &&
+         IsSameFont(m_SmallFont, style.m_SmallFont) &&
+         m_TitlelBackgroundColour == style.m_TitlelBackgroundColour &&
+         m_DataBackgroundColour == style.m_DataBackgroundColour &&
+         m_Arrow_First_Colour == style.m_Arrow_First_Colour &&
+         m_Arrow_Second_Colour == style.m_Arrow_Second_Colour;
+}
+
+const InstrumentStyle *InstrumentStyle::Intern(const InstrumentStyle &style) {
+  for (std::list<InternedStyle>::iterator it = s_Styles.begin();
+       it != s_Styles.end(); ++it) {
+    if (it->style == style) {
+      it->users++;
+      return &it->style;
+    }
+  }
+  InternedStyle interned;
+  interned.style = style;
+  interned.style.m_Palette = InstrumentPalette();
+  interned.users = 1;
+  s_Styles.push_back(interned);
+  return &s_Styles.back().style;
+}
+
+// The colours come from DashColour(), so this costs no GetGlobalColor()
+// calls while the colour scheme stays the same.
+const InstrumentStyle *InstrumentStyle::Default(void) {
+  InstrumentStyle style;
+  style.m_TitelFont = *g_pFontTitle;
+  style.m_DataFont = *g_pFontData;
+  style.m_LabelFont = *g_pFontLabel;
+  style.m_SmallFont = *g_pFontSmall;
+  style.m_TitlelBackgroundColour = DashColour(DC_DASHL);
+  style.m_DataBackgroundColour = DashColour(DC_DASHB);
+  style.m_Arrow_First_Colour = DashColour(DC_DASHN);
+  style.m_Arrow_Second_Colour = DashColour(DC_BLUE3);
+  return Intern(style);
+}
+
+void InstrumentStyle::Release(const InstrumentStyle *style) {
+  if (!style) return;
+  for (std::list<InternedStyle>::iterator it = s_Styles.begin();
+       it != s_Styles.end(); ++it) {
+    if (&it->style == style) {
+      if (--it->users == 0) s_Styles.erase(it);
+      return;
+    }
+  }
+}
+
+size_t InstrumentStyle::GetInternedCount(void) { return s_Styles.size(); }
+
+void InstrumentProperties::SetStyle(const InstrumentStyle &style) {
+  const InstrumentStyle *interned = InstrumentStyle::Intern(style);
+  if (interned != m_Style) m_bDirty = true;
+  InstrumentStyle::Release(m_Style);
+  m_Style = interned;
+}
 
 //----------------------------------------------------------------
 //
@@ -131,6 +308,7 @@ DashboardInstrument::DashboardInstrument(wxWindow* pparent, wxWindowID id,
   m_title = title;
   m_Properties = Properties;
   m_cap_flag.set(cap_flag);
+  m_SuppressedRepaints = 0;
 
   SetBackgroundStyle(wxBG_STYLE_CUSTOM);
   SetDrawSoloInPane(false);
@@ -138,11 +316,11 @@ DashboardInstrument::DashboardInstrument(wxWindow* pparent, wxWindowID id,
   int width;
   wxFont f;
   if (m_Properties) {
-    f = m_Properties->m_TitelFont.GetChosenFont();
-    dc.GetTextExtent(m_title, &width, &m_TitleHeight, 0, 0, &f);
+    f = m_Properties->Style().m_TitelFont.GetChosenFont();
+    GetTextExtentCached(dc, m_title, &width, &m_TitleHeight, f);
   } else {
     f = g_pFontTitle->GetChosenFont();
-    dc.GetTextExtent(m_title, &width, &m_TitleHeight, 0, 0, &f);
+    GetTextExtentCached(dc, m_title, &width, &m_TitleHeight, f);
   }
   Connect(wxEVT_ERASE_BACKGROUND,
           wxEraseEventHandler(DashboardInstrument::OnEraseBackground));
@@ -174,11 +352,18 @@ void DashboardInstrument::MouseEvent(wxMouseEvent& event) {
 void DashboardInstrument::SetDrawSoloInPane(bool value) {
   m_drawSoloInPane = value;
 }
+void DashboardInstrument::SetCapStale(DASH_CAP val, bool stale) {
+  if (!m_cap_flag.test(val) || m_stale_flag.test(val) == stale) return;
+  m_stale_flag.set(val, stale);
+  Refresh();
+}
+
 void DashboardInstrument::OnEraseBackground(wxEraseEvent& WXUNUSED(evt)) {
   // intentionally empty
 }
 
 void DashboardInstrument::OnPaint(wxPaintEvent& WXUNUSED(event)) {
+    StartupProfile::Clock::time_point start = StartupProfile::Clock::now();
     wxAutoBufferedPaintDC pdc(this);
     if (!pdc.IsOk()) {
         wxLogMessage(
@@ -198,18 +383,10 @@ void DashboardInstrument::OnPaint(wxPaintEvent& WXUNUSED(event)) {
 #else
     wxDC& dc(pdc);
 #endif
-    wxColour cl;
-    if (m_Properties)
-    {
-        dc.SetBackground(GetColourSchemeBackgroundColour(m_Properties->m_DataBackgroundColour));
-    }
-    else
-    {
-        GetGlobalColor(_T("DASHB"), &cl);
-        dc.SetBackground(cl);
-    }
+    const InstrumentPalette &palette = Palette();
+    dc.SetBackground(palette.m_DataBackgroundBrush);
 #ifdef __WXGTK__
-  dc.SetBrush(cl);
+  dc.SetBrush(palette.m_DataBackgroundBrush);
   dc.SetPen(*wxTRANSPARENT_PEN);
   dc.DrawRectangle(0, 0, size.x, size.y);
 #endif
@@ -218,40 +395,25 @@ void DashboardInstrument::OnPaint(wxPaintEvent& WXUNUSED(event)) {
   Draw(&dc);
 
   if (!m_drawSoloInPane) {
-      wxPen pen;
-      pen.SetStyle(wxPENSTYLE_SOLID);
-      if (m_Properties)
-      {
-          pen.SetColour(GetColourSchemeBackgroundColour(m_Properties->m_TitlelBackgroundColour));
-          dc.SetPen(pen);
-          dc.SetBrush(GetColourSchemeBackgroundColour(m_Properties->m_TitlelBackgroundColour));
-      }
-      else
-      {
-          GetGlobalColor(_T("DASHL"), &cl);
-          pen.SetColour(cl);
-          dc.SetPen(pen);
-          dc.SetBrush(cl);
-      }
+      dc.SetPen(palette.m_TitleBackgroundPen);
+      dc.SetBrush(palette.m_TitleBackgroundBrush);
 
     dc.DrawRoundedRectangle(0, 0, size.x, m_TitleHeight, 3);
     if (m_Properties)
     {
-        dc.SetFont(m_Properties->m_TitelFont.GetChosenFont());
-        dc.SetTextForeground(GetColourSchemeFont(m_Properties->m_TitelFont.GetColour()));
-        dc.SetTextBackground(GetColourSchemeBackgroundColour(m_Properties->m_TitlelBackgroundColour));
+        dc.SetFont(m_Properties->Style().m_TitelFont.GetChosenFont());
     }
     else
     {
         dc.SetFont((g_pFontTitle->GetChosenFont()));
-        dc.SetTextForeground(GetColourSchemeFont(g_pFontTitle->GetColour()));
-        GetGlobalColor(_T("DASHL"), &cl);
-        dc.SetTextBackground(cl);
     }
+    dc.SetTextForeground(palette.m_TitleFont);
+    dc.SetTextBackground(palette.m_TitleBackground);
     // GetGlobalColor(_T("DASHF"), &cl);
     //dc.SetTextForeground(cl);
     dc.DrawText(m_title, 5, 0);
   }
+  g_StartupProfile.Paint(start);
 }
 
 //----------------------------------------------------------------
@@ -271,6 +433,8 @@ DashboardInstrument_Single::DashboardInstrument_Single(wxWindow* pparent,
   m_data = _T("---");
   m_DataHeight = 0;
   m_Properties = Properties;
+  m_LastData = 0.0;
+  m_bLastValid = false;
 }
 
 wxSize DashboardInstrument_Single::GetSize(int orient, wxSize hint) {
@@ -279,17 +443,17 @@ wxSize DashboardInstrument_Single::GetSize(int orient, wxSize hint) {
   wxFont f;
   if (m_Properties)
   {
-      f = m_Properties->m_TitelFont.GetChosenFont();
-      dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
-      f = m_Properties->m_DataFont.GetChosenFont();
-      dc.GetTextExtent(_T("000"), &w, &m_DataHeight, 0, 0, &f);
+      f = m_Properties->Style().m_TitelFont.GetChosenFont();
+      GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
+      f = m_Properties->Style().m_DataFont.GetChosenFont();
+      GetTextExtentCached(dc, _T("000"), &w, &m_DataHeight, f);
   }
   else
   {
       f = g_pFontTitle->GetChosenFont();
-      dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
+      GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
       f = g_pFontData->GetChosenFont();
-      dc.GetTextExtent(_T("000"), &w, &m_DataHeight, 0, 0, &f);
+      GetTextExtentCached(dc, _T("000"), &w, &m_DataHeight, f);
   }
   if (orient == wxHORIZONTAL) {
     return wxSize(DefaultWidth, wxMax(hint.y, m_TitleHeight + m_DataHeight));
@@ -302,13 +466,13 @@ void DashboardInstrument_Single::Draw(wxGCDC* dc) {
   wxColour cl;
   if (m_Properties)
   {
-      dc->SetFont((m_Properties->m_DataFont.GetChosenFont()));
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_DataFont.GetColour()));
+      dc->SetFont((m_Properties->Style().m_DataFont.GetChosenFont()));
+      dc->SetTextForeground(Palette().m_DataFont);
   }
   else
   {
       dc->SetFont(g_pFontData->GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(g_pFontData->GetColour()));
+      dc->SetTextForeground(Palette().m_DataFont);
   }
   //GetGlobalColor(_T("DASHF"), &cl);
   //dc->SetTextForeground(cl);
@@ -319,21 +483,32 @@ void DashboardInstrument_Single::Draw(wxGCDC* dc) {
 void DashboardInstrument_Single::SetData(DASH_CAP st, double data,
                                          wxString unit) {
   if (m_cap_flag.test(st)) {
+    // The same bits format the same, no need to format them again
+    if (m_bLastValid && unit == m_LastUnit &&
+        memcmp(&data, &m_LastData, sizeof(data)) == 0) {
+      m_SuppressedRepaints++;
+      return;
+    }
+    m_LastData = data;
+    m_LastUnit = unit;
+    m_bLastValid = true;
+
+    wxString text;
     if (!std::isnan(data)) {
       if (unit == _T("C"))
-        m_data = wxString::Format(m_format, data) + DEGREE_SIGN + _T("C");
+        text = wxString::Format(m_format, data) + DEGREE_SIGN + _T("C");
       else if (unit == _T("\u00B0"))
-        m_data = wxString::Format(m_format, data) + DEGREE_SIGN;
+        text = wxString::Format(m_format, data) + DEGREE_SIGN;
       else if (unit == _T("\u00B0T"))
-        m_data = wxString::Format(m_format, data) + DEGREE_SIGN + _(" true");
+        text = wxString::Format(m_format, data) + DEGREE_SIGN + _(" true");
       else if (unit == _T("\u00B0M"))
-        m_data = wxString::Format(m_format, data) + DEGREE_SIGN + _(" mag");
+        text = wxString::Format(m_format, data) + DEGREE_SIGN + _(" mag");
       else if (unit == _T("\u00B0L"))
-        m_data = _T(">") + wxString::Format(m_format, data) + DEGREE_SIGN;
+        text = _T(">") + wxString::Format(m_format, data) + DEGREE_SIGN;
       else if (unit == _T("\u00B0R"))
-        m_data = wxString::Format(m_format, data) + DEGREE_SIGN + _T("<");
+        text = wxString::Format(m_format, data) + DEGREE_SIGN + _T("<");
       else if (unit == _T("N"))  // Knots
-        m_data = wxString::Format(m_format, data) + _T(" Kts");
+        text = wxString::Format(m_format, data) + _T(" Kts");
       /* maybe in the future ...
                       else if (unit == _T("M")) // m/s
                         m_data = wxString::Format(m_format, data)+_T(" m/s");
@@ -342,14 +517,32 @@ void DashboardInstrument_Single::SetData(DASH_CAP st, double data,
        ... to be completed
        */
       else
-        m_data = wxString::Format(m_format, data) + _T(" ") + unit;
+        text = wxString::Format(m_format, data) + _T(" ") + unit;
     } else
-      m_data = _T("---");
+      text = _T("---");
+
+    // Nothing to paint if the shown text is the same
+    if (text == m_data) {
+      m_SuppressedRepaints++;
+      return;
+    }
+    m_data = text;
 
     Refresh();
   }
 }
 
+// Shows "---" while stale, the next value replaces it
+void DashboardInstrument_Single::SetCapStale(DASH_CAP val, bool stale) {
+  if (!m_cap_flag.test(val) || m_stale_flag.test(val) == stale) return;
+  m_stale_flag.set(val, stale);
+  if (stale) {
+    m_data = _T("---");
+    m_bLastValid = false;
+  }
+  Refresh();
+}
+
 //----------------------------------------------------------------
 //
 //    DashboardInstrument_Position Implementation
@@ -369,26 +562,36 @@ DashboardInstrument_Position::DashboardInstrument_Position(wxWindow* pparent,
   m_data2 = _T("---");
   m_cap_flag1 = cap_flag1;
   m_cap_flag2 = cap_flag2;
+  m_Shown1 = m_Shown2 = LLONG_MIN;
   m_DataHeight = 0;
 }
 
+// The position quantised like toSDMM() shows it, hemisphere in bit 0
+static long long QuantiseSDMM(double a) {
+  bool neg = a < 0.0;
+  if (neg) a = -a;
+  int d = (int)a;
+  long m = (long)((a - (double)d) * 60000.0);
+  return ((long long)d * 60000 + m) * 2 + (neg ? 1 : 0);
+}
+
 wxSize DashboardInstrument_Position::GetSize(int orient, wxSize hint) {
   wxClientDC dc(this);
   int w;
   wxFont f;
   if (m_Properties)
   {
-      f = m_Properties->m_TitelFont.GetChosenFont();
-      dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
-      f = m_Properties->m_DataFont.GetChosenFont();
-      dc.GetTextExtent(_T("000  00.0000 W"), &w, &m_DataHeight, 0, 0, &f);
+      f = m_Properties->Style().m_TitelFont.GetChosenFont();
+      GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
+      f = m_Properties->Style().m_DataFont.GetChosenFont();
+      GetTextExtentCached(dc, _T("000  00.0000 W"), &w, &m_DataHeight, f);
   }
   else
   {
       f = g_pFontTitle->GetChosenFont();
-      dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
+      GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
       f = g_pFontData->GetChosenFont();
-      dc.GetTextExtent(_T("000  00.0000 W"), &w, &m_DataHeight, 0, 0, &f);
+      GetTextExtentCached(dc, _T("000  00.0000 W"), &w, &m_DataHeight, f);
   }
 
   if (orient == wxHORIZONTAL) {
@@ -402,13 +605,13 @@ void DashboardInstrument_Position::Draw(wxGCDC* dc) {
   wxColour cl;
   if (m_Properties)
   {
-      dc->SetFont((m_Properties->m_DataFont.GetChosenFont()));
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_DataFont.GetColour()));
+      dc->SetFont((m_Properties->Style().m_DataFont.GetChosenFont()));
+      dc->SetTextForeground(Palette().m_DataFont);
   }
   else
   {
       dc->SetFont((g_pFontData->GetChosenFont()));
-      dc->SetTextForeground(GetColourSchemeFont(g_pFontData->GetColour()));
+      dc->SetTextForeground(Palette().m_DataFont);
   }
   //GetGlobalColor(_T("DASHF"), &cl);
   //dc->SetTextForeground(cl);
@@ -421,9 +624,21 @@ void DashboardInstrument_Position::SetData(DASH_CAP st, double data,
                                            wxString unit) {
   if (std::isnan(data)) return;
   if (st == m_cap_flag1) {
+    long long shown = QuantiseSDMM(data);
+    if (shown == m_Shown1) {
+      m_SuppressedRepaints++;
+      return;
+    }
+    m_Shown1 = shown;
     m_data1 = toSDMM(1, data);
     m_data1[0] = ' ';
   } else if (st == m_cap_flag2) {
+    long long shown = QuantiseSDMM(data);
+    if (shown == m_Shown2) {
+      m_SuppressedRepaints++;
+      return;
+    }
+    m_Shown2 = shown;
     m_data2 = toSDMM(2, data);
   } else
     return;
@@ -436,6 +651,7 @@ DashboardInstrument_Block::DashboardInstrument_Block(wxWindow* pparent, wxWindow
     m_format = format;
     m_data = _T("---");
     m_DataHeight = 0;
+    m_ShownValue = -1;
 
 }
 
@@ -447,16 +663,16 @@ wxSize DashboardInstrument_Block::GetSize(int orient, wxSize hint) {
     if (m_Properties)
     {
         f = g_pFontTitle->GetChosenFont();
-        dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
-        f = m_Properties->m_DataFont.GetChosenFont();
-        dc.GetTextExtent(_T("000000000000000"), &w, &m_DataHeight, 0, 0, &f);
+        GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
+        f = m_Properties->Style().m_DataFont.GetChosenFont();
+        GetTextExtentCached(dc, _T("000000000000000"), &w, &m_DataHeight, f);
     }
     else
     {
         f = g_pFontTitle->GetChosenFont();
-        dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
+        GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
         f = g_pFontData->GetChosenFont();
-        dc.GetTextExtent(_T("000  00.0000 W"), &w, &m_DataHeight, 0, 0, &f);
+        GetTextExtentCached(dc, _T("000  00.0000 W"), &w, &m_DataHeight, f);
     }
 
 
@@ -475,19 +691,19 @@ void DashboardInstrument_Block::Draw(wxGCDC* dc) {
     wxMemoryDC tdc(tbm);
     wxColour c2;
     wxFont f;
-    GetGlobalColor(_T("DASHB"), &c2);
+    c2 = DashColour(DC_DASHB);
     tdc.SetBackground(c2);
     tdc.Clear();
     if (m_Properties)
-        f = m_Properties->m_DataFont.GetChosenFont();
+        f = m_Properties->Style().m_DataFont.GetChosenFont();
     else
         f = g_pFontData->GetChosenFont();
     tdc.SetFont(f);
     if (m_Value > 20) {
-        GetGlobalColor(_T("DASHF"), &cl);
+        cl = DashColour(DC_DASHF);
     }
     else {
-        GetGlobalColor(_T("DASHR"), &cl);
+        cl = DashColour(DC_DASHR);
     }
     tdc.SetTextForeground(cl);
 
@@ -500,10 +716,10 @@ void DashboardInstrument_Block::Draw(wxGCDC* dc) {
     dc->SetFont(g_pFontData->GetChosenFont());
 
     if (m_Value > 20) {
-        GetGlobalColor(_T("DASHF"), &cl);
+        cl = DashColour(DC_DASHF);
     }
     else {
-        GetGlobalColor(_T("DASHR"), &cl);
+        cl = DashColour(DC_DASHR);
     }
     dc->SetTextForeground(cl);
 
@@ -517,6 +733,12 @@ void DashboardInstrument_Block::SetData(DASH_CAP st, double data, wxString unit)
     if (m_cap_flag.test(st)) {
         if (!std::isnan(data) && (data > 0) && (data <= 100)) {
             if (unit == _T("Level")) {
+                // The block string shows the level in whole percent only
+                if ((int)data == m_ShownValue) {
+                    m_SuppressedRepaints++;
+                    return;
+                }
+                m_ShownValue = (int)data;
                 m_Value = (int)data; // class member used to determine foreground colour
                 m_data.Clear();
                 for (int i = 0; i < (int)(data / 10); i++) {
@@ -529,10 +751,21 @@ void DashboardInstrument_Block::SetData(DASH_CAP st, double data, wxString unit)
         }
         else {
             m_data = _T("---");
+            m_ShownValue = -1;
         }
     }
 }
 
+void DashboardInstrument_Block::SetCapStale(DASH_CAP val, bool stale) {
+    if (!m_cap_flag.test(val) || m_stale_flag.test(val) == stale) return;
+    m_stale_flag.set(val, stale);
+    if (stale) {
+        m_data = _T("---");
+        m_ShownValue = -1;
+    }
+    Refresh();
+}
+
 /**************************************************************************/
 /*          Some assorted utilities                                       */
 /**************************************************************************/
@@ -0,0 +1,239 @@
+/******************************************************************************
+ * layout_snapshot.cpp
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Binary snapshot of the dashboard layout
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+#include "layout_snapshot.h"
+#include <wx/file.h>
+#include <wx/filename.h>
+#include <cstddef>
+#include <cstring>
+#include "../../../include/ocpn_plugin.h"
+
+#define LAYOUT_SNAPSHOT_MAGIC 0x4C424244  // "DBBL"
+
+// FNV-1a
+static uint64_t Hash(const void *data, size_t len,
+                     uint64_t hash = 0xCBF29CE484222325ULL) {
+  const unsigned char *p = (const unsigned char *)data;
+  for (size_t i = 0; i < len; i++) hash = (hash ^ p[i]) * 0x100000001B3ULL;
+  return hash;
+}
+
+static wxString GetSnapshotPath(const wxString &name) {
+  wxFileName fn(*GetpPrivateApplicationDataLocation(), name);
+  fn.AppendDir(_T("plugins"));
+  fn.AppendDir(_T("dashboard_pi"));
+  if (!fn.DirExists() && !fn.Mkdir(wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL))
+    return wxEmptyString;
+  return fn.GetFullPath();
+}
+
+// Collects "path/name=value" of all entries below the current path of pConf
+static void CollectEntries(wxConfigBase *pConf, wxArrayString &entries) {
+  wxString path = pConf->GetPath();
+  wxString name, value;
+  long index;
+  for (bool more = pConf->GetFirstEntry(name, index); more;
+       more = pConf->GetNextEntry(name, index)) {
+    pConf->Read(name, &value);
+    entries.Add(path + _T("/") + name + _T("=") + value);
+  }
+  // Changing the path while enumerating would invalidate the index
+  wxArrayString groups;
+  for (bool more = pConf->GetFirstGroup(name, index); more;
+       more = pConf->GetNextGroup(name, index))
+    groups.Add(name);
+  for (size_t i = 0; i < groups.GetCount(); i++) {
+    pConf->SetPath(path + _T("/") + groups[i]);
+    CollectEntries(pConf, entries);
+  }
+  pConf->SetPath(path);
+}
+
+uint64_t LayoutSnapshot::HashConfig(wxConfigBase *pConf, const wxString &path,
+                                    const wxString &salt) {
+  wxString old = pConf->GetPath();
+  wxArrayString entries;
+  pConf->SetPath(path);
+  CollectEntries(pConf, entries);
+  pConf->SetPath(old);
+  // The order of the entries in the file does not matter
+  entries.Sort();
+  wxCharBuffer buf = salt.ToUTF8();
+  uint64_t hash = Hash(buf.data(), buf.length());
+  for (size_t i = 0; i < entries.GetCount(); i++) {
+    buf = entries[i].ToUTF8();
+    hash = Hash(buf.data(), buf.length() + 1, hash);
+  }
+  return hash;
+}
+
+// The whole file in one read, it is used only when it is complete and was
+// made from the same config
+bool LayoutSnapshot::Load(const wxString &name, uint64_t hash) {
+  m_data.clear();
+  m_pos = 0;
+  m_ok = false;
+  wxString path = GetSnapshotPath(name);
+  if (path.IsEmpty() || !wxFileExists(path)) return false;
+  wxFile file(path);
+  wxFileOffset length = file.IsOpened() ? file.Length() : 0;
+  if (length < (wxFileOffset)sizeof(Header)) return false;
+  std::vector<char> data(length);
+  if (file.Read(&data[0], length) != (ssize_t)length) return false;
+
+  Header header;
+  memcpy(&header, &data[0], sizeof(Header));
+  if (header.magic != LAYOUT_SNAPSHOT_MAGIC ||
+      header.version != LAYOUT_SNAPSHOT_VERSION || header.hash != hash ||
+      header.size != length - sizeof(Header) ||
+      header.check != Hash(&data[sizeof(Header)], header.size))
+    return false;
+  m_data.assign(data.begin() + sizeof(Header), data.end());
+  m_ok = true;
+  return true;
+}
+
+// Through a temporary file, so a crash never leaves a torn snapshot
+bool LayoutSnapshot::Save(const wxString &name, uint64_t hash) const {
+  wxString path = GetSnapshotPath(name);
+  if (path.IsEmpty()) return false;
+  Header header;
+  memset(&header, 0, sizeof(header));
+  header.magic = LAYOUT_SNAPSHOT_MAGIC;
+  header.version = LAYOUT_SNAPSHOT_VERSION;
+  header.hash = hash;
+  header.size = m_data.size();
+  header.check = Hash(m_data.empty() ? NULL : &m_data[0], m_data.size());
+  wxTempFile file(path);
+  return file.IsOpened() && file.Write(&header, sizeof(header)) &&
+         (m_data.empty() || file.Write(&m_data[0], m_data.size())) &&
+         file.Commit();
+}
+
+void LayoutSnapshot::PutInt(int32_t value) {
+  const char *p = (const char *)&value;
+  m_data.insert(m_data.end(), p, p + sizeof(value));
+}
+
+void LayoutSnapshot::PutDouble(double value) {
+  const char *p = (const char *)&value;
+  m_data.insert(m_data.end(), p, p + sizeof(value));
+}
+
+void LayoutSnapshot::PutString(const wxString &value) {
+  wxCharBuffer buf = value.ToUTF8();
+  PutInt(buf.length());
+  m_data.insert(m_data.end(), buf.data(), buf.data() + buf.length());
+}
+
+void LayoutSnapshot::PutColour(const wxColour &colour) {
+  PutInt(colour.IsOk());
+  if (!colour.IsOk()) return;
+  uint32_t rgba = colour.Red() | colour.Green() << 8 | colour.Blue() << 16 |
+                  (uint32_t)colour.Alpha() << 24;
+  PutInt((int32_t)rgba);
+}
+
+// The attributes, not the native description, which would have to be
+// parsed again
+void LayoutSnapshot::PutFont(const wxFont &font) {
+  PutInt(font.IsOk());
+  if (!font.IsOk()) return;
+#if wxCHECK_VERSION(3, 1, 2)
+  PutDouble(font.GetFractionalPointSize());
+#else
+  PutDouble(font.GetPointSize());
+#endif
+  PutInt(font.GetFamily());
+  PutInt(font.GetStyle());
+  PutInt(font.GetWeight());
+  PutInt(font.GetUnderlined());
+  PutInt(font.GetStrikethrough());
+  PutInt(font.GetEncoding());
+  PutString(font.GetFaceName());
+}
+
+bool LayoutSnapshot::Get(void *value, size_t size) {
+  if (!m_ok || m_pos + size > m_data.size()) {
+    m_ok = false;
+    return false;
+  }
+  memcpy(value, &m_data[m_pos], size);
+  m_pos += size;
+  return true;
+}
+
+int32_t LayoutSnapshot::GetInt(void) {
+  int32_t value = 0;
+  Get(&value, sizeof(value));
+  return value;
+}
+
+double LayoutSnapshot::GetDouble(void) {
+  double value = 0;
+  Get(&value, sizeof(value));
+  return value;
+}
+
+wxString LayoutSnapshot::GetString(void) {
+  int32_t length = GetInt();
+  if (length < 0 || m_pos + length > m_data.size()) {
+    m_ok = false;
+    return wxEmptyString;
+  }
+  wxString value = wxString::FromUTF8(&m_data[m_pos], length);
+  m_pos += length;
+  return value;
+}
+
+wxColour LayoutSnapshot::GetColour(void) {
+  if (!GetInt()) return wxColour();
+  uint32_t rgba = GetInt();
+  return wxColour(rgba & 0xFF, rgba >> 8 & 0xFF, rgba >> 16 & 0xFF,
+                  rgba >> 24 & 0xFF);
+}
+
+wxFont LayoutSnapshot::GetFont(void) {
+  if (!GetInt()) return wxFont();
+  double size = GetDouble();
+  int family = GetInt();
+  int style = GetInt();
+  int weight = GetInt();
+  bool underlined = GetInt() != 0;
+  bool strikethrough = GetInt() != 0;
+  int encoding = GetInt();
+  wxString face = GetString();
+  if (!m_ok) return wxFont();
+  if (family < wxFONTFAMILY_DEFAULT || family >= wxFONTFAMILY_MAX)
+    family = wxFONTFAMILY_DEFAULT;
+  wxFont font(wxRound(size), (wxFontFamily)family, (wxFontStyle)style,
+              (wxFontWeight)weight, underlined, face,
+              (wxFontEncoding)encoding);
+#if wxCHECK_VERSION(3, 1, 2)
+  font.SetFractionalPointSize(size);
+#endif
+  font.SetStrikethrough(strikethrough);
+  return font;
+}
@@ -0,0 +1,93 @@
+/******************************************************************************
+ * priority_arbiter.cpp
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Source priority arbitration per data group
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+#include "priority_arbiter.h"
+
+// Config key names, in the order of the PG_ enum
+static const char *s_GroupNames[PG_LAST] = {
+    "Position", "COGSOG",   "HeadingM",  "HeadingT", "Variation",
+    "DateTime", "AWA",      "TWA",       "TWD",      "Depth",
+    "STW",      "WaterTemp", "AirTemp",  "Pressure", "Humidity",
+    "SatStatus", "SatUsed", "Altitude",  "Rudder",   "PitchRoll",
+    "VMGW"};
+
+PriorityArbiter::PriorityArbiter() {
+  for (int g = 0; g < PG_LAST; g++) {
+    m_lastWinner[g] = 0;
+    m_flaps[g] = 0;
+    for (int s = 0; s < PRIORITY_SOURCES; s++) m_wins[g][s] = 0;
+  }
+  ResetOrder();
+  Reset();
+}
+
+void PriorityArbiter::Reset(void) {
+  for (int g = 0; g < PG_LAST; g++) Release(g);
+}
+
+void PriorityArbiter::ResetOrder(void) {
+  for (int g = 0; g < PG_LAST; g++) {
+    m_rank[g][0] = PRIORITY_NONE;
+    for (int s = 1; s < PRIORITY_SOURCES; s++) m_rank[g][s] = s;
+  }
+}
+
+// 'sources' lists the source numbers of the group, best first. They get the
+// ranks 1..n, the others keep their default order behind them.
+bool PriorityArbiter::SetOrder(int group, const std::vector<int> &sources) {
+  if (group < 0 || group >= PG_LAST) return false;
+  bool listed[PRIORITY_SOURCES] = {false};
+  int rank = 1;
+  for (size_t i = 0; i < sources.size(); i++) {
+    int s = sources[i];
+    if (s <= 0 || s >= PRIORITY_SOURCES || listed[s]) return false;
+    listed[s] = true;
+  }
+  for (size_t i = 0; i < sources.size(); i++) m_rank[group][sources[i]] = rank++;
+  for (int s = 1; s < PRIORITY_SOURCES; s++)
+    if (!listed[s]) m_rank[group][s] = rank++;
+  return true;
+}
+
+void PriorityArbiter::Won(int group, int source) {
+  m_current[group] = m_rank[group][source];
+  m_source[group] = source;
+  m_wins[group][source]++;
+  if (source != m_lastWinner[group]) {
+    if (m_lastWinner[group]) m_flaps[group]++;
+    m_lastWinner[group] = source;
+  }
+}
+
+const char *PriorityArbiter::GetGroupName(int group) {
+  if (group < 0 || group >= PG_LAST) return "";
+  return s_GroupNames[group];
+}
+
+int PriorityArbiter::GetGroup(const std::string &name) {
+  for (int g = 0; g < PG_LAST; g++)
+    if (name == s_GroupNames[g]) return g;
+  return -1;
+}
@@ -60,7 +60,7 @@ wxSize DashboardInstrument_RudderAngle::GetSize(int orient, wxSize hint) {
   wxClientDC dc(this);
   int w;
   wxFont f = g_pFontTitle->GetChosenFont();
-  dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
+  GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
   if (orient == wxHORIZONTAL) {
     w = wxMax(hint.y, (DefaultWidth - m_TitleHeight) / .7);
   } else {
@@ -105,7 +105,7 @@ void DashboardInstrument_RudderAngle::DrawFrame(wxGCDC* dc) {
   wxPen pen;
   pen.SetStyle(wxPENSTYLE_SOLID);
   pen.SetWidth(2);
-  GetGlobalColor(_T("DASHF"), &cl);
+  cl = DashColour(DC_DASHF);
   pen.SetColour(cl);
   dc->SetPen(pen);
 
@@ -123,7 +123,7 @@ void DashboardInstrument_RudderAngle::DrawBackground(wxGCDC* dc) {
   wxCoord x = m_cx - (m_radius * 0.3);
   wxCoord y = m_cy - (m_radius * 1.1);
   wxColour cl;
-  GetGlobalColor(_T("DASH1"), &cl);
+  cl = DashColour(DC_DASH1);
   dc->SetBrush(cl);
   dc->DrawEllipticArc(x, y, m_radius * 0.6, m_radius * 1.4, 0, -180);
 }
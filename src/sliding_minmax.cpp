@@ -0,0 +1,52 @@
+/******************************************************************************
+ * sliding_minmax.cpp
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Minimum and maximum of the last N samples
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+
+#include "sliding_minmax.h"
+
+SlidingMinMax::SlidingMinMax(int count) {
+  m_count = count;
+  m_total = 0;
+}
+
+void SlidingMinMax::Reset(void) {
+  m_min.clear();
+  m_max.clear();
+}
+
+void SlidingMinMax::Push(double value) {
+  Sample s;
+  s.seq = m_total++;
+  s.value = value;
+  // A sample which is not larger than a newer one can never be the maximum
+  while (!m_max.empty() && m_max.back().value <= value) m_max.pop_back();
+  m_max.push_back(s);
+  while (!m_min.empty() && m_min.back().value >= value) m_min.pop_back();
+  m_min.push_back(s);
+
+  long long start = m_total - m_count;  // Oldest sample still in the history
+  while (m_max.front().seq < start) m_max.pop_front();
+  while (m_min.front().seq < start) m_min.pop_front();
+}
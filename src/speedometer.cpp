@@ -91,29 +91,29 @@ void DashboardInstrument_SpeedometerSOGSTW::DrawData(wxGCDC* dc, double value, w
 
     if (m_Properties)
     {
-        dc->SetFont(m_Properties->m_LabelFont.GetChosenFont());
+        dc->SetFont(m_Properties->Style().m_LabelFont.GetChosenFont());
         if (position == DIAL_POSITION_BOTTOMLEFT)
-            dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_Arrow_Second_Colour));
+            dc->SetTextForeground(Palette().m_ArrowSecond);
         else if (position == DIAL_POSITION_BOTTOMRIGHT)
-            dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_Arrow_First_Colour));
+            dc->SetTextForeground(Palette().m_ArrowFirst);
         else
-            dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_LabelFont.GetColour()));
+            dc->SetTextForeground(Palette().m_LabelFont);
     }
     else
     {
         dc->SetFont(g_pFontLabel->GetChosenFont());
         if (position == DIAL_POSITION_BOTTOMLEFT)
         {
-            GetGlobalColor(_T("BLUE3"), &cl);
+            cl = DashColour(DC_BLUE3);
             dc->SetTextForeground(cl);
         }
         else if (position == DIAL_POSITION_BOTTOMRIGHT)
         {
-            GetGlobalColor(_T("DASHN"), &cl);
+            cl = DashColour(DC_DASHN);
             dc->SetTextForeground(cl);
         }
         else
-            dc->SetTextForeground(GetColourSchemeFont(g_pFontLabel->GetColour()));
+            dc->SetTextForeground(Palette().m_LabelFont);
     }
     wxSize size = GetClientSize();
 
@@ -142,7 +142,7 @@ void DashboardInstrument_SpeedometerSOGSTW::DrawData(wxGCDC* dc, double value, w
     int width, height;
     wxFont f;
     if (m_Properties)
-        f = m_Properties->m_LabelFont.GetChosenFont();
+        f = m_Properties->Style().m_LabelFont.GetChosenFont();
     else
         f = g_pFontLabel->GetChosenFont();
     dc->GetMultiLineTextExtent(text, &width, &height, NULL, &f);
@@ -158,18 +158,12 @@ void DashboardInstrument_SpeedometerSOGSTW::DrawData(wxGCDC* dc, double value, w
     case DIAL_POSITION_INSIDE: {
         TextPoint.x = m_cx - (width / 2) - 1;
         TextPoint.y = (size.y * .75) - height;
-        if (m_Properties)
-            cl = GetColourSchemeBackgroundColour(m_Properties->m_TitlelBackgroundColour);
-        else
-            GetGlobalColor(_T("DASHL"), &cl);
+        cl = Palette().m_TitleBackground;
         int penwidth = size.x / 100;
         wxPen* pen =
             wxThePenList->FindOrCreatePen(cl, penwidth, wxPENSTYLE_SOLID);
         dc->SetPen(*pen);
-        if (m_Properties)
-            cl = GetColourSchemeBackgroundColour(m_Properties->m_DataBackgroundColour);
-        else
-            GetGlobalColor(_T("DASHB"), &cl);
+        cl = Palette().m_DataBackground;
         dc->SetBrush(cl);
         // There might be a background drawn below
         // so we must clear it first.
@@ -209,7 +203,7 @@ void DashboardInstrument_SpeedometerSOGSTW::DrawData(wxGCDC* dc, double value, w
     //wxColour c2;
     //GetGlobalColor(_T("DASHB"), &c2);
     wxColour c3;
-    GetGlobalColor(_T("DASHF"), &c3);
+    c3 = DashColour(DC_DASHF);
 
     wxStringTokenizer tkz(text, _T("\n"));
     wxString token;
@@ -217,10 +211,10 @@ void DashboardInstrument_SpeedometerSOGSTW::DrawData(wxGCDC* dc, double value, w
     token = tkz.GetNextToken();
     while (token.Length()) {
         if (m_Properties)
-            f = m_Properties->m_LabelFont.GetChosenFont();
+            f = m_Properties->Style().m_LabelFont.GetChosenFont();
         else
             f = g_pFontLabel->GetChosenFont();
-        dc->GetTextExtent(token, &width, &height, NULL, NULL, &f);
+        dc->GetTextExtent(token, &width, &height, 0, 0, &f);
         dc->DrawText(token, TextPoint.x, TextPoint.y);
         TextPoint.y += height;
         token = tkz.GetNextToken();
@@ -234,13 +228,13 @@ void DashboardInstrument_SpeedometerSOGSTW::DrawForeground(wxGCDC* dc) {
     double value;
     // The default foreground is the arrow used in most dials
     wxColour cl;
-    GetGlobalColor(_T("DASH2"), &cl);
+    cl = DashColour(DC_DASH2);
     wxPen pen1;
     pen1.SetStyle(wxPENSTYLE_SOLID);
     pen1.SetColour(cl);
     pen1.SetWidth(2);
     dc->SetPen(pen1);
-    GetGlobalColor(_T("DASH1"), &cl);
+    cl = DashColour(DC_DASH1);
     wxBrush brush1;
     brush1.SetStyle(wxBRUSHSTYLE_SOLID);
     brush1.SetColour(cl);
@@ -249,10 +243,7 @@ void DashboardInstrument_SpeedometerSOGSTW::DrawForeground(wxGCDC* dc) {
 
     /*True Wind*/
     dc->SetPen(*wxTRANSPARENT_PEN);
-    if (m_Properties)
-        cl = GetColourSchemeFont(m_Properties->m_Arrow_Second_Colour);
-    else
-        GetGlobalColor(_T("BLUE3"), &cl);
+    cl = Palette().m_ArrowSecond;
     wxBrush brush2;
     brush2.SetStyle(wxBRUSHSTYLE_SOLID);
     brush2.SetColour(cl);
@@ -289,10 +280,7 @@ void DashboardInstrument_SpeedometerSOGSTW::DrawForeground(wxGCDC* dc) {
 
     /* Apparent Wind*/
     dc->SetPen(*wxTRANSPARENT_PEN);
-    if (m_Properties)
-        cl = GetColourSchemeFont(m_Properties->m_Arrow_First_Colour);
-    else
-        GetGlobalColor(_T("DASHN"), &cl);
+    cl = Palette().m_ArrowFirst;
     wxBrush brush;
     brush.SetStyle(wxBRUSHSTYLE_SOLID);
     brush.SetColour(cl);
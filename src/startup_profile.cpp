@@ -0,0 +1,111 @@
+/******************************************************************************
+ * startup_profile.cpp
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Timing of the plugin start and of layout changes
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+#include "startup_profile.h"
+#include <wx/log.h>
+
+static double ToMs(StartupProfile::Clock::duration time) {
+  return std::chrono::duration<double, std::milli>(time).count();
+}
+
+void StartupProfile::Begin(const wxString &cycle) {
+  // Keep the first cycle, it is the one of Init
+  if (m_cycles.size() >= PROFILE_CYCLES) m_cycles.erase(m_cycles.begin() + 1);
+  Cycle c;
+  c.name = cycle;
+  c.start = Clock::now();
+  m_cycles.push_back(c);
+  m_open = true;
+  m_waitPaint = true;
+}
+
+void StartupProfile::AddTo(Cycle &cycle, const wxString &phase,
+                           Clock::duration time) {
+  for (size_t i = 0; i < cycle.phases.size(); i++) {
+    if (cycle.phases[i].name == phase) {
+      cycle.phases[i].count++;
+      cycle.phases[i].time += time;
+      return;
+    }
+  }
+  Phase p;
+  p.name = phase;
+  p.count = 1;
+  p.time = time;
+  cycle.phases.push_back(p);
+}
+
+void StartupProfile::Add(const wxString &phase, Clock::time_point start) {
+  if (m_open) AddTo(m_cycles.back(), phase, Clock::now() - start);
+}
+
+void StartupProfile::End(void) {
+  if (!m_open) return;
+  Cycle &cycle = m_cycles.back();
+  AddTo(cycle, _T("Total"), Clock::now() - cycle.start);
+  m_open = false;
+}
+
+void StartupProfile::Paint(Clock::time_point start) {
+  if (!m_waitPaint) return;
+  m_waitPaint = false;
+  Clock::time_point now = Clock::now();
+  Cycle &cycle = m_cycles.back();
+  AddTo(cycle, _T("First paint"), now - start);
+  AddTo(cycle, _T("Until first paint"), now - cycle.start);
+}
+
+void StartupProfile::Log(void) const {
+  for (size_t i = 0; i < m_cycles.size(); i++) {
+    const Cycle &cycle = m_cycles[i];
+    for (size_t j = 0; j < cycle.phases.size(); j++) {
+      const Phase &p = cycle.phases[j];
+      wxLogMessage(_T("Dashboard: Profile %s, %s %dx %.1f ms"), cycle.name,
+                   p.name, p.count, ToMs(p.time));
+    }
+  }
+}
+
+// {"Cycles": [{"Name": "Init", "Phases": [{"Name": "LoadConfig",
+//   "Count": 1, "ms": 12.5}, ...]}, ...]}
+wxJSONValue StartupProfile::ToJSON(void) const {
+  wxJSONValue root;
+  root[_T("Cycles")].SetType(wxJSONTYPE_ARRAY);
+  for (size_t i = 0; i < m_cycles.size(); i++) {
+    const Cycle &cycle = m_cycles[i];
+    wxJSONValue c;
+    c[_T("Name")] = cycle.name;
+    c[_T("Phases")].SetType(wxJSONTYPE_ARRAY);
+    for (size_t j = 0; j < cycle.phases.size(); j++) {
+      wxJSONValue p;
+      p[_T("Name")] = cycle.phases[j].name;
+      p[_T("Count")] = cycle.phases[j].count;
+      p[_T("ms")] = ToMs(cycle.phases[j].time);
+      c[_T("Phases")].Append(p);
+    }
+    root[_T("Cycles")].Append(c);
+  }
+  return root;
+}
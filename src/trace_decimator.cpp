@@ -0,0 +1,96 @@
+/******************************************************************************
+ * trace_decimator.cpp
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Min/max per pixel column decimation of history traces
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+
+#include "trace_decimator.h"
+#include <algorithm>
+
+TraceDecimator::TraceDecimator(int count) {
+  m_count = count;
+  m_bucket = 1;
+  m_total = 0;
+}
+
+void TraceDecimator::Reset(void) { m_buckets.clear(); }
+
+void TraceDecimator::SetCount(int count) {
+  m_count = count;
+  m_bucket = 0;
+  m_buckets.clear();
+}
+
+bool TraceDecimator::SetColumns(int columns) {
+  if (columns < 1) columns = 1;
+  int bucket = (m_count + columns - 1) / columns;
+  if (bucket < 1) bucket = 1;
+  if (bucket == m_bucket) return false;
+  m_bucket = bucket;
+  m_buckets.clear();
+  return true;
+}
+
+void TraceDecimator::Add(long long seq, double value) {
+  if (m_buckets.empty() || m_buckets.back().n >= m_bucket) {
+    Bucket b;
+    b.first = b.minSeq = b.maxSeq = seq;
+    b.n = 1;
+    b.min = b.max = value;
+    m_buckets.push_back(b);
+    return;
+  }
+  Bucket &b = m_buckets.back();
+  b.n++;
+  if (value < b.min) {
+    b.min = value;
+    b.minSeq = seq;
+  }
+  if (value > b.max) {
+    b.max = value;
+    b.maxSeq = seq;
+  }
+}
+
+int TraceDecimator::GetPoints(std::vector<wxPoint> &points, double x0,
+                              double ratioW, double y0, double offset,
+                              double ratioH, int top, int bottom) const {
+  points.clear();
+  long long start = m_total - m_count;
+  for (size_t i = 0; i < m_buckets.size(); i++) {
+    const Bucket &b = m_buckets[i];
+    long long seq[2] = {b.minSeq, b.maxSeq};
+    double value[2] = {b.min, b.max};
+    if (seq[1] < seq[0]) {
+      std::swap(seq[0], seq[1]);
+      std::swap(value[0], value[1]);
+    }
+    for (int j = 0; j < 2; j++) {
+      if (j == 1 && seq[1] == seq[0]) break;
+      wxPoint p((int)(x0 + (seq[j] - start) * ratioW),
+                (int)(y0 - (value[j] - offset) * ratioH));
+      if (p.y > top && p.y <= bottom) points.push_back(p);
+    }
+  }
+  return (int)points.size();
+}
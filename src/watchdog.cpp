@@ -0,0 +1,105 @@
+/******************************************************************************
+ * watchdog.cpp
+ *
+ * Project:  OpenCPN
+ * Purpose:  Dashboard Plugin
+ *           Hashed timing wheel used to time out stale instrument data
+ *
+ ***************************************************************************
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301,  USA.         *
+ ***************************************************************************
+ */
+
+#include "watchdog.h"
+
+WatchdogWheel::WatchdogWheel(int entries) {
+  m_origin = Clock::now();
+  m_lastTick = 0;
+  Resize(entries);
+}
+
+void WatchdogWheel::Resize(int entries) {
+  for (int i = 0; i < WHEEL_SLOTS; i++) m_head[i] = -1;
+  m_next.assign(entries, -1);
+  m_prev.assign(entries, -1);
+  m_slot.assign(entries, -1);
+  m_tick.assign(entries, 0);
+}
+
+// Deadlines are rounded up to the next full second, "now" is rounded down,
+// so an entry never fires before its deadline.
+long long WatchdogWheel::ToTick(Clock::time_point t) const {
+  long long ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                     t - m_origin).count();
+  if (ms <= 0) return 0;
+  return (ms + 999) / 1000;
+}
+
+void WatchdogWheel::Link(int id, int slot) {
+  m_slot[id] = slot;
+  m_prev[id] = -1;
+  m_next[id] = m_head[slot];
+  if (m_head[slot] >= 0) m_prev[m_head[slot]] = id;
+  m_head[slot] = id;
+}
+
+void WatchdogWheel::Unlink(int id) {
+  int slot = m_slot[id];
+  if (slot < 0) return;
+  if (m_prev[id] >= 0)
+    m_next[m_prev[id]] = m_next[id];
+  else
+    m_head[slot] = m_next[id];
+  if (m_next[id] >= 0) m_prev[m_next[id]] = m_prev[id];
+  m_next[id] = m_prev[id] = m_slot[id] = -1;
+}
+
+void WatchdogWheel::Arm(int id, Clock::time_point deadline) {
+  long long tick = ToTick(deadline);
+  // A deadline already in the past is handled by the next Advance()
+  if (tick <= m_lastTick) tick = m_lastTick + 1;
+  int slot = (int)(tick % WHEEL_SLOTS);
+  m_tick[id] = tick;
+  if (m_slot[id] == slot) return;  // Same slot, just a deadline bump
+  Unlink(id);
+  Link(id, slot);
+}
+
+void WatchdogWheel::Disarm(int id) { Unlink(id); }
+
+void WatchdogWheel::Advance(Clock::time_point now, std::vector<int>& expired) {
+  expired.clear();
+  long long ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                     now - m_origin).count();
+  long long nowTick = ms > 0 ? ms / 1000 : 0;
+  if (nowTick <= m_lastTick) return;
+
+  // Only the slots passed since the last call can hold expired entries
+  long long first = m_lastTick + 1;
+  if (nowTick - first >= WHEEL_SLOTS) first = nowTick - WHEEL_SLOTS + 1;
+  for (long long t = first; t <= nowTick; t++) {
+    int id = m_head[t % WHEEL_SLOTS];
+    while (id >= 0) {
+      int next = m_next[id];
+      if (m_tick[id] <= nowTick) {
+        Unlink(id);
+        expired.push_back(id);
+      }
+      id = next;
+    }
+  }
+  m_lastTick = nowTick;
+}
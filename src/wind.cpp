@@ -72,7 +72,7 @@ DashboardInstrument_WindCompass::DashboardInstrument_WindCompass(
 }
 
 void DashboardInstrument_WindCompass::DrawBackground(wxGCDC* dc) {
-  DrawCompassRose(dc, m_cx, m_cy, m_radius * 0.85, m_AngleStart, false, m_Properties);
+  m_Rose.Draw(dc, m_cx, m_cy, m_radius * 0.85, m_AngleStart, false, m_Properties);
 }
 
 // Display the arrow for MainValue (wind angle)
@@ -135,50 +135,35 @@ void DashboardInstrument_AppTrueWindAngle::SetData(DASH_CAP st, double data,
 }
 
 void DashboardInstrument_AppTrueWindAngle::Draw(wxGCDC* bdc) {
+  DrawStaticLayer(bdc);
+  DrawBackground(bdc);
+  DrawData(bdc, m_MainValueApp, m_MainValueAppUnit, m_MainValueFormat,
+           m_MainValueOption1);
+  DrawData(bdc, m_MainValueTrue, m_MainValueTrueUnit, m_MainValueFormat,
+           m_MainValueOption2);
+  DrawData(bdc, m_ExtraValueApp, m_ExtraValueAppUnit, m_ExtraValueFormat,
+           m_ExtraValueOption1);
+  DrawData(bdc, m_ExtraValueTrue, m_ExtraValueTrueUnit, m_ExtraValueFormat,
+           m_ExtraValueOption2);
+  DrawForeground(bdc);
+}
 
-
-  if (m_Properties)
-  {
-      wxBrush b1(GetColourSchemeBackgroundColour(m_Properties->m_DataBackgroundColour));
-      bdc->SetBackground(GetColourSchemeBackgroundColour(m_Properties->m_DataBackgroundColour));
-  }
-  else
-  {
-      wxColour c1;
-      GetGlobalColor(_T("DASHB"), &c1);
-      wxBrush b1(c1);
-      bdc->SetBackground(b1);
-  }
-  bdc->Clear();
-
+void DashboardInstrument_AppTrueWindAngle::CalculateGeometry(wxGCDC* bdc) {
   wxSize size = GetClientSize();
   int width, height;
   wxFont f;
   if (m_Properties)
-    f = m_Properties->m_LabelFont.GetChosenFont();
+    f = m_Properties->Style().m_LabelFont.GetChosenFont();
   else
     f = g_pFontLabel->GetChosenFont();
-  bdc->GetTextExtent(_T("000"), &width, &height, 0, 0, &f);
+  GetTextExtentCached(*bdc, _T("000"), &width, &height, f);
   m_cx = size.x / 2;
   int availableHeight = size.y - m_TitleHeight - height;
   m_cy = m_TitleHeight + height / 2;
   m_cy += availableHeight / 2;
   m_radius = availableHeight / 2.0 * 0.95;
-
-  DrawLabels(bdc);
-  DrawFrame(bdc);
-  DrawMarkers(bdc);
-  DrawBackground(bdc);
-  DrawData(bdc, m_MainValueApp, m_MainValueAppUnit, m_MainValueFormat,
-           m_MainValueOption1);
-  DrawData(bdc, m_MainValueTrue, m_MainValueTrueUnit, m_MainValueFormat,
-           m_MainValueOption2);
-  DrawData(bdc, m_ExtraValueApp, m_ExtraValueAppUnit, m_ExtraValueFormat,
-           m_ExtraValueOption1);
-  DrawData(bdc, m_ExtraValueTrue, m_ExtraValueTrueUnit, m_ExtraValueFormat,
-           m_ExtraValueOption2);
-  DrawForeground(bdc);
 }
+
 void DashboardInstrument_AppTrueWindAngle::DrawForeground(wxGCDC* dc) {
   wxPoint points[4];
   double data;
@@ -186,13 +171,13 @@ void DashboardInstrument_AppTrueWindAngle::DrawForeground(wxGCDC* dc) {
   double value;
   // The default foreground is the arrow used in most dials
   wxColour cl;
-  GetGlobalColor(_T("DASH2"), &cl);
+  cl = DashColour(DC_DASH2);
   wxPen pen1;
   pen1.SetStyle(wxPENSTYLE_SOLID);
   pen1.SetColour(cl);
   pen1.SetWidth(2);
   dc->SetPen(pen1);
-  GetGlobalColor(_T("DASH1"), &cl);
+  cl = DashColour(DC_DASH1);
   wxBrush brush1;
   brush1.SetStyle(wxBRUSHSTYLE_SOLID);
   brush1.SetColour(cl);
@@ -201,10 +186,7 @@ void DashboardInstrument_AppTrueWindAngle::DrawForeground(wxGCDC* dc) {
 
   /*True Wind*/
   dc->SetPen(*wxTRANSPARENT_PEN);
-  if (m_Properties)
-      cl = GetColourSchemeFont(m_Properties->m_Arrow_Second_Colour);
-  else
-      GetGlobalColor(_T("BLUE3"), &cl);
+  cl = Palette().m_ArrowSecond;
   wxBrush brush2;
   brush2.SetStyle(wxBRUSHSTYLE_SOLID);
   brush2.SetColour(cl);
@@ -241,10 +223,7 @@ void DashboardInstrument_AppTrueWindAngle::DrawForeground(wxGCDC* dc) {
 
   /* Apparent Wind*/
   dc->SetPen(*wxTRANSPARENT_PEN);
-  if (m_Properties)
-      cl = GetColourSchemeFont(m_Properties->m_Arrow_First_Colour);
-  else
-      GetGlobalColor(_T("DASHN"), &cl);
+  cl = Palette().m_ArrowFirst;
   wxBrush brush;
   brush.SetStyle(wxBRUSHSTYLE_SOLID);
   brush.SetColour(cl);
@@ -287,13 +266,13 @@ void DashboardInstrument_AppTrueWindAngle::DrawData(
   wxColour cl;
   if (m_Properties)
   {
-      dc->SetFont(m_Properties->m_LabelFont.GetChosenFont());
-      cl = GetColourSchemeFont(m_Properties->m_LabelFont.GetColour());
+      dc->SetFont(m_Properties->Style().m_LabelFont.GetChosenFont());
+      cl = Palette().m_LabelFont;
   }
   else
   {
       dc->SetFont(g_pFontLabel->GetChosenFont());
-      cl = GetColourSchemeFont(g_pFontLabel->GetColour());
+      cl = Palette().m_LabelFont;
   }
   //GetGlobalColor(_T("DASHF"), &cl);
   dc->SetTextForeground(cl);
@@ -324,7 +303,7 @@ void DashboardInstrument_AppTrueWindAngle::DrawData(
   int width, height;
   wxFont f;
   if (m_Properties)
-    f = m_Properties->m_LabelFont.GetChosenFont();
+    f = m_Properties->Style().m_LabelFont.GetChosenFont();
   else
     f = g_pFontLabel->GetChosenFont();
   dc->GetMultiLineTextExtent(text, &width, &height, NULL, &f);
@@ -342,12 +321,12 @@ void DashboardInstrument_AppTrueWindAngle::DrawData(
     case DIAL_POSITION_INSIDE: {
       TextPoint.x = m_cx - (width / 2) - 1;
       TextPoint.y = (size.y * .75) - height;
-      GetGlobalColor(_T("DASHL"), &cl);
+      cl = DashColour(DC_DASHL);
       int penwidth = size.x / 100;
       wxPen* pen =
           wxThePenList->FindOrCreatePen(cl, penwidth, wxPENSTYLE_SOLID);
       dc->SetPen(*pen);
-      GetGlobalColor(_T("DASHB"), &cl);
+      cl = DashColour(DC_DASHB);
       dc->SetBrush(cl);
       // There might be a background drawn below
       // so we must clear it first.
@@ -356,41 +335,41 @@ void DashboardInstrument_AppTrueWindAngle::DrawData(
       break;
     }
     case DIAL_POSITION_TOPLEFT:
-      GetGlobalColor(_T("DASHN"), &c3);
+      c3 = DashColour(DC_DASHN);
       TextPoint.x = 0;
       TextPoint.y = m_TitleHeight;
       text = _T("A:") + text;
       break;
     case DIAL_POSITION_TOPRIGHT:
-      GetGlobalColor(_T("DASHN"), &c3);
+      c3 = DashColour(DC_DASHN);
       TextPoint.x = size.x - width - 1;
       TextPoint.y = m_TitleHeight;
       break;
     case DIAL_POSITION_BOTTOMLEFT:
-      GetGlobalColor(_T("BLUE3"), &c3);
+      c3 = DashColour(DC_BLUE3);
       text = _T("T:") + text;
       TextPoint.x = 0;
       TextPoint.y = size.y - height;
       break;
     case DIAL_POSITION_BOTTOMRIGHT:
-      GetGlobalColor(_T("BLUE3"), &c3);
+      c3 = DashColour(DC_BLUE3);
       TextPoint.x = size.x - width - 1;
       TextPoint.y = size.y - height;
       break;
   }
   wxColour c2;
-  GetGlobalColor(_T("DASHB"), &c2);
+  c2 = DashColour(DC_DASHB);
   wxStringTokenizer tkz(text, _T("\n"));
   wxString token;
 
   token = tkz.GetNextToken();
   while (token.Length()) {
     if (m_Properties) {
-        f = m_Properties->m_LabelFont.GetChosenFont();
-        dc->GetTextExtent(token, &width, &height, NULL, NULL, &f);
+        f = m_Properties->Style().m_LabelFont.GetChosenFont();
+        dc->GetTextExtent(token, &width, &height, 0, 0, &f);
     } else {
         f = g_pFontLabel->GetChosenFont();
-        dc->GetTextExtent(token, &width, &height, NULL, NULL, &f);
+        dc->GetTextExtent(token, &width, &height, 0, 0, &f);
     }
     dc->DrawText(token, TextPoint.x, TextPoint.y);
     TextPoint.y += height;
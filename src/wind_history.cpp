@@ -38,13 +38,24 @@
 #pragma hdrstop
 #endif
 
+extern int g_iDashWindHistorySpan;
+extern int g_iDashWindSpeedUnit;
+
 //************************************************************************************************************************
 // History of wind direction
 //************************************************************************************************************************
 
 DashboardInstrument_WindDirHistory::DashboardInstrument_WindDirHistory(
     wxWindow* parent, wxWindowID id, wxString title, InstrumentProperties* Properties)
-    : DashboardInstrument(parent, id, title, OCPN_DBP_STC_TWD, Properties) {
+    : DashboardInstrument(parent, id, title, OCPN_DBP_STC_TWD, Properties),
+      m_History(WH_SERIES, WIND_RECORD_COUNT, WIND_RECORD_INTERVAL),
+      m_Tier(HT_FULL),
+      m_DirTrace(WIND_RECORD_COUNT),
+      m_SpdTrace(WIND_RECORD_COUNT),
+      m_SmoothDirTrace(WIND_RECORD_COUNT),
+      m_SmoothSpdTrace(WIND_RECORD_COUNT),
+      m_DirMinMax(WIND_RECORD_COUNT),
+      m_SpdMinMax(WIND_RECORD_COUNT) {
   m_cap_flag.set(OCPN_DBP_STC_TWS);
   SetDrawSoloInPane(true);
   m_MaxWindDir = -1;
@@ -59,10 +70,10 @@ DashboardInstrument_WindDirHistory::DashboardInstrument_WindDirHistory(
   int w, h;
   wxFont f;
   if (m_Properties)
-      f = m_Properties->m_DataFont.GetChosenFont();
+      f = m_Properties->Style().m_DataFont.GetChosenFont();
   else
       f = g_pFontData->GetChosenFont();
-  dc.GetTextExtent("TWS----", &w, &h, 0, 0, &f);
+  GetTextExtentCached(dc, "TWS----", &w, &h, f);
   m_TopLineHeight = wxMax(30, h);
   m_SpdRecCnt = 0;
   m_DirRecCnt = 0;
@@ -73,14 +84,9 @@ DashboardInstrument_WindDirHistory::DashboardInstrument_WindDirHistory(
   m_SampleCount = 0;
   m_LeftLegend = 3;
   m_RightLegend = 3;
-  for (int idx = 0; idx < WIND_RECORD_COUNT; idx++) {
-    m_ArrayWindDirHistory[idx] = -1;
-    m_ArrayWindSpdHistory[idx] = -1;
-    m_ExpSmoothArrayWindSpd[idx] = -1;
-    m_ExpSmoothArrayWindDir[idx] = -1;
-    m_ArrayRecTime[idx] = wxDateTime::Now().GetTm();
-    m_ArrayRecTime[idx].year = 999;
-  }
+  m_History.Fill(-1);
+  m_HistoryFile.Open(_T("wind_history.dat"), m_History, g_iDashWindSpeedUnit);
+  RestoreHistory();
   alpha = 0.01;  // smoothing constant
   m_WindowRect = GetClientRect();
   m_DrawAreaRect = GetClientRect();
@@ -93,10 +99,10 @@ wxSize DashboardInstrument_WindDirHistory::GetSize(int orient, wxSize hint) {
   int w;
   wxFont f;
   if (m_Properties)
-      f = m_Properties->m_TitelFont.GetChosenFont();
+      f = m_Properties->Style().m_TitelFont.GetChosenFont();
   else
       f = g_pFontTitle->GetChosenFont();
-  dc.GetTextExtent(m_title, &w, &m_TitleHeight, 0, 0, &f);
+  GetTextExtentCached(dc, m_title, &w, &m_TitleHeight, f);
   if (orient == wxHORIZONTAL) {
     return wxSize(DefaultWidth, wxMax(m_TitleHeight + 140, hint.y));
   } else {
@@ -140,6 +146,10 @@ void DashboardInstrument_WindDirHistory::SetData(DASH_CAP st, double data,
         m_WindDir = m_DirStartVal / 5;
         m_oldDirVal = m_WindDir;  // make sure we don't get a diff > or <180 in
         // the initial run
+        // continue a restored history without a jump of 360 degrees
+        if (m_SampleCount)
+          m_oldDirVal =
+              m_History.Full().Get(WH_SMOOTH_DIR, WIND_RECORD_COUNT - 1);
       }
       // start working after we collected 5 records each, as start values for the
       // smoothed curves
@@ -147,21 +157,6 @@ void DashboardInstrument_WindDirHistory::SetData(DASH_CAP st, double data,
         m_IsRunning = true;
         m_SampleCount = m_SampleCount < WIND_RECORD_COUNT ? m_SampleCount + 1
           : WIND_RECORD_COUNT;
-        m_MaxWindDir = 0;
-        m_MinWindDir = 360;
-        m_MaxWindSpd = 0;
-        // data shifting
-        for (int idx = 1; idx < WIND_RECORD_COUNT; idx++) {
-          if (WIND_RECORD_COUNT - m_SampleCount <= idx)
-            m_MinWindDir = wxMin(m_ArrayWindDirHistory[idx], m_MinWindDir);
-          m_MaxWindDir = wxMax(m_ArrayWindDirHistory[idx - 1], m_MaxWindDir);
-          m_MaxWindSpd = wxMax(m_ArrayWindSpdHistory[idx - 1], m_MaxWindSpd);
-          m_ArrayWindDirHistory[idx - 1] = m_ArrayWindDirHistory[idx];
-          m_ArrayWindSpdHistory[idx - 1] = m_ArrayWindSpdHistory[idx];
-          m_ExpSmoothArrayWindSpd[idx - 1] = m_ExpSmoothArrayWindSpd[idx];
-          m_ExpSmoothArrayWindDir[idx - 1] = m_ExpSmoothArrayWindDir[idx];
-          m_ArrayRecTime[idx - 1] = m_ArrayRecTime[idx];
-        }
         double diff = m_WindDir - m_oldDirVal;
         if (diff < -270) {
           m_WindDir += 360;
@@ -169,26 +164,38 @@ void DashboardInstrument_WindDirHistory::SetData(DASH_CAP st, double data,
         else if (diff > 270) {
           m_WindDir -= 360;
         }
-        m_ArrayWindDirHistory[WIND_RECORD_COUNT - 1] = m_WindDir;
-        m_ArrayWindSpdHistory[WIND_RECORD_COUNT - 1] = m_WindSpd;
+        HistoryStore& full = m_History.Full();
+        full.Push(wxDateTime::Now().GetTicks());
+        int last = WIND_RECORD_COUNT - 1;
+        full.Set(WH_DIR, last, m_WindDir);
+        full.Set(WH_SPD, last, m_WindSpd);
         if (m_SampleCount < 2) {
-          m_ArrayWindSpdHistory[WIND_RECORD_COUNT - 2] = m_WindSpd;
-          m_ExpSmoothArrayWindSpd[WIND_RECORD_COUNT - 2] = m_WindSpd;
-          m_ArrayWindDirHistory[WIND_RECORD_COUNT - 2] = m_WindDir;
-          m_ExpSmoothArrayWindDir[WIND_RECORD_COUNT - 2] = m_WindDir;
+          full.Set(WH_SPD, last - 1, m_WindSpd);
+          full.Set(WH_SMOOTH_SPD, last - 1, m_WindSpd);
+          full.Set(WH_DIR, last - 1, m_WindDir);
+          full.Set(WH_SMOOTH_DIR, last - 1, m_WindDir);
+        }
+        full.Set(WH_SMOOTH_SPD, last,
+          alpha * full.Get(WH_SPD, last - 1) +
+          (1 - alpha) * full.Get(WH_SMOOTH_SPD, last - 1));
+        full.Set(WH_SMOOTH_DIR, last,
+          alpha * full.Get(WH_DIR, last - 1) +
+          (1 - alpha) * full.Get(WH_SMOOTH_DIR, last - 1));
+        m_oldDirVal = full.Get(WH_SMOOTH_DIR, last);
+        unsigned added = m_History.Aggregate();
+        m_HistoryFile.Append(m_History, added);
+        // the traces follow the tier they draw
+        if (added & (1u << m_Tier)) {
+          m_DirTrace.Push(m_History.GetSeries(m_Tier, WH_DIR));
+          m_SpdTrace.Push(m_History.GetSeries(m_Tier, WH_SPD));
+          m_SmoothDirTrace.Push(m_History.GetSeries(m_Tier, WH_SMOOTH_DIR));
+          m_SmoothSpdTrace.Push(m_History.GetSeries(m_Tier, WH_SMOOTH_SPD));
         }
-        m_ExpSmoothArrayWindSpd[WIND_RECORD_COUNT - 1] =
-          alpha * m_ArrayWindSpdHistory[WIND_RECORD_COUNT - 2] +
-          (1 - alpha) * m_ExpSmoothArrayWindSpd[WIND_RECORD_COUNT - 2];
-        m_ExpSmoothArrayWindDir[WIND_RECORD_COUNT - 1] =
-          alpha * m_ArrayWindDirHistory[WIND_RECORD_COUNT - 2] +
-          (1 - alpha) * m_ExpSmoothArrayWindDir[WIND_RECORD_COUNT - 2];
-        m_ArrayRecTime[WIND_RECORD_COUNT - 1] = wxDateTime::Now().GetTm();
-        m_oldDirVal = m_ExpSmoothArrayWindDir[WIND_RECORD_COUNT - 1];
-        // include the new/latest value in the max/min value test too
-        m_MaxWindDir = wxMax(m_WindDir, m_MaxWindDir);
-        m_MinWindDir = wxMin(m_WindDir, m_MinWindDir);
-        m_MaxWindSpd = wxMax(m_WindSpd, m_MaxWindSpd);
+        m_DirMinMax.Push(m_WindDir);
+        m_SpdMinMax.Push(m_WindSpd);
+        double min, max;
+        if (GetExtremes(m_SpdMinMax, WH_SPD, min, max))
+          m_MaxWindSpd = wxMax(max, 0.);
         // get the overall max Wind Speed
         m_TotalMaxWindSpd = wxMax(m_WindSpd, m_TotalMaxWindSpd);
 
@@ -219,17 +226,18 @@ void DashboardInstrument_WindDirHistory::ResetData() {
   m_SampleCount = 0;
   m_LeftLegend = 3;
   m_RightLegend = 3;
-  for (int idx = 0; idx < WIND_RECORD_COUNT; idx++) {
-    m_ArrayWindDirHistory[idx] = -1;
-    m_ArrayWindSpdHistory[idx] = -1;
-    m_ExpSmoothArrayWindSpd[idx] = -1;
-    m_ExpSmoothArrayWindDir[idx] = -1;
-    m_ArrayRecTime[idx] = wxDateTime::Now().GetTm();
-    m_ArrayRecTime[idx].year = 999;
-  }
+  m_History.Fill(-1);
+  m_HistoryFile.Clear(m_History, g_iDashWindSpeedUnit);
+  m_DirTrace.Reset();
+  m_SpdTrace.Reset();
+  m_SmoothDirTrace.Reset();
+  m_SmoothSpdTrace.Reset();
+  m_DirMinMax.Reset();
+  m_SpdMinMax.Reset();
 }
 
 void DashboardInstrument_WindDirHistory::Draw(wxGCDC* dc) {
+  SelectTier();
   m_WindowRect = GetClientRect();
   m_DrawAreaRect = GetClientRect();
   m_DrawAreaRect.SetHeight(m_WindowRect.height - m_TopLineHeight -
@@ -239,6 +247,77 @@ void DashboardInstrument_WindDirHistory::Draw(wxGCDC* dc) {
   DrawForeground(dc);
 }
 
+//*********************************************************************************
+// draw one history array, at most two points per pixel column
+//*********************************************************************************
+void DashboardInstrument_WindDirHistory::DrawTrace(wxGCDC* dc,
+                                                   TraceDecimator& trace,
+                                                   int series, double offset,
+                                                   double ratioH) {
+  if (trace.SetColumns(m_DrawAreaRect.width))
+    trace.Rebuild(m_History.GetSeries(m_Tier, series),
+                  m_History.GetSamples(m_Tier));
+  int bottom = m_TopLineHeight + m_DrawAreaRect.height;
+  int n = trace.GetPoints(m_TracePoints, 3 + m_LeftLegend, m_ratioW, bottom,
+                          offset, ratioH, m_TopLineHeight, bottom);
+  if (n > 1) dc->DrawLines(n, &m_TracePoints[0]);
+}
+
+//*********************************************************************************
+// take over the samples restored from the history file
+//*********************************************************************************
+void DashboardInstrument_WindDirHistory::RestoreHistory() {
+  // overall max speed of all restored tiers. After a long break only the
+  // coarse tiers may still be within their span.
+  bool restored = false;
+  for (int t = HT_FULL; t < HT_TIERS; t++) {
+    double min, max;
+    if (!m_History.GetRange(t, WH_SPD, min, max)) continue;
+    m_TotalMaxWindSpd = wxMax(max, m_TotalMaxWindSpd);
+    restored = true;
+  }
+  if (!restored) return;
+  m_SampleCount = m_History.GetSamples(HT_FULL);
+  const HistoryStore& full = m_History.GetTier(HT_FULL);
+  for (int i = WIND_RECORD_COUNT - m_SampleCount; i < WIND_RECORD_COUNT; i++) {
+    m_DirMinMax.Push(full.Get(WH_DIR, i));
+    m_SpdMinMax.Push(full.Get(WH_SPD, i));
+  }
+  // select the tier again, the traces are rebuilt on the next draw
+  m_Tier = -1;
+  SelectTier();
+}
+
+//*********************************************************************************
+// switch to the finest history tier which covers the configured span
+//*********************************************************************************
+void DashboardInstrument_WindDirHistory::SelectTier() {
+  int tier = m_History.SelectTier(g_iDashWindHistorySpan * 3600);
+  if (tier == m_Tier) return;
+  m_Tier = tier;
+  int count = m_History.GetTier(tier).GetCount();
+  m_DirTrace.SetCount(count);
+  m_SpdTrace.SetCount(count);
+  m_SmoothDirTrace.SetCount(count);
+  m_SmoothSpdTrace.SetCount(count);
+  double min, max;
+  if (GetExtremes(m_SpdMinMax, WH_SPD, min, max))
+    m_MaxWindSpd = wxMax(max, 0.);
+  SetMinMaxWindScale();
+}
+
+//*********************************************************************************
+// extremes of a series over the drawn tier, the full rate ones are at hand
+//*********************************************************************************
+bool DashboardInstrument_WindDirHistory::GetExtremes(
+    const SlidingMinMax& minmax, int series, double& min, double& max) {
+  if (m_Tier != HT_FULL) return m_History.GetRange(m_Tier, series, min, max);
+  if (minmax.IsEmpty()) return false;
+  min = minmax.GetMin();
+  max = minmax.GetMax();
+  return true;
+}
+
 //*********************************************************************************
 // determine and set  min and max values for the direction
 //*********************************************************************************
@@ -246,6 +325,11 @@ void DashboardInstrument_WindDirHistory::SetMinMaxWindScale() {
   // set wind direction legend to full +/- 90 degr depending on the real max/min
   // value recorded example : max wind dir. = 45 degr  ==> max = 90 degr
   //           min wind dir. = 45 degr  ==> min = 0 degr
+  // start with the extremes of the recorded history
+  double min, max;
+  if (!GetExtremes(m_DirMinMax, WH_DIR, min, max)) return;
+  m_MaxWindDir = wxMax(max, 0.);
+  m_MinWindDir = wxMin(min, 360.);
   // first calculate the max wind direction
   int fulldeg = m_MaxWindDir / 90;  // we explicitly chop off the decimals by
                                     // type conversion from double to int !
@@ -295,12 +379,12 @@ void DashboardInstrument_WindDirHistory::DrawWindDirScale(wxGCDC* dc) {
   cl = wxColour(204, 41, 41, 255);  // red, opague
   if (m_Properties)
   {
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_SmallFont.GetColour()));
-      dc->SetFont(m_Properties->m_SmallFont.GetChosenFont());
+      dc->SetTextForeground(Palette().m_SmallFont);
+      dc->SetFont(m_Properties->Style().m_SmallFont.GetChosenFont());
   }
   else
   {
-      dc->SetTextForeground(GetColourSchemeFont(g_pFontSmall->GetColour()));
+      dc->SetTextForeground(Palette().m_SmallFont);
       dc->SetFont(g_pFontSmall->GetChosenFont());
   }
   if (!m_IsRunning) {
@@ -342,7 +426,7 @@ void DashboardInstrument_WindDirHistory::DrawWindDirScale(wxGCDC* dc) {
   wxFont f;
   if (m_Properties)
   {
-      f = m_Properties->m_SmallFont.GetChosenFont();
+      f = m_Properties->Style().m_SmallFont.GetChosenFont();
       dc->GetTextExtent(label5, &width, &height, 0, 0, &f);
       m_RightLegend = width;
       dc->GetTextExtent(label4, &width, &height, 0, 0, &f);
@@ -395,12 +479,12 @@ void DashboardInstrument_WindDirHistory::DrawWindSpeedScale(wxGCDC* dc) {
   //cl = wxColour(61, 61, 204, 255);
   if (m_Properties)
   {
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_SmallFont.GetColour()));
-      dc->SetFont(m_Properties->m_SmallFont.GetChosenFont());
+      dc->SetTextForeground(Palette().m_SmallFont);
+      dc->SetFont(m_Properties->Style().m_SmallFont.GetChosenFont());
   }
   else
   {      
-      dc->SetTextForeground(GetColourSchemeFont(g_pFontSmall->GetColour()));
+      dc->SetTextForeground(Palette().m_SmallFont);
       dc->SetFont(g_pFontSmall->GetChosenFont());
   }
   // round maxWindSpd up to the next full knot; nicer view ...
@@ -454,13 +538,13 @@ void DashboardInstrument_WindDirHistory::DrawWindSpeedScale(wxGCDC* dc) {
   }
   wxFont f;
   if (m_Properties)
-      f = m_Properties->m_SmallFont.GetChosenFont();
+      f = m_Properties->Style().m_SmallFont.GetChosenFont();
   else
       f = g_pFontSmall->GetChosenFont();
   dc->GetTextExtent(label1, &m_LeftLegend, &height, 0, 0, &f);
   dc->DrawText(label1, 4, (int)(m_TopLineHeight - height / 2));
   if (m_Properties)
-      f = m_Properties->m_SmallFont.GetChosenFont();
+      f = m_Properties->Style().m_SmallFont.GetChosenFont();
   else
       f = g_pFontSmall->GetChosenFont();
   dc->GetTextExtent(label2, &width, &height, 0, 0, &f);
@@ -468,7 +552,7 @@ void DashboardInstrument_WindDirHistory::DrawWindSpeedScale(wxGCDC* dc) {
                (int)(m_TopLineHeight + m_DrawAreaRect.height / 4 - height / 2));
   m_LeftLegend = wxMax(width, m_LeftLegend);
   if (m_Properties)
-      f = m_Properties->m_SmallFont.GetChosenFont();
+      f = m_Properties->Style().m_SmallFont.GetChosenFont();
   else
       f = g_pFontSmall->GetChosenFont();
   dc->GetTextExtent(label3, &width, &height, 0, 0, &f);
@@ -476,7 +560,7 @@ void DashboardInstrument_WindDirHistory::DrawWindSpeedScale(wxGCDC* dc) {
                (int)(m_TopLineHeight + m_DrawAreaRect.height / 2 - height / 2));
   m_LeftLegend = wxMax(width, m_LeftLegend);
   if (m_Properties)
-      f = m_Properties->m_SmallFont.GetChosenFont();
+      f = m_Properties->Style().m_SmallFont.GetChosenFont();
   else
       f = g_pFontSmall->GetChosenFont();
   dc->GetTextExtent(label4, &width, &height, 0, 0, &f);
@@ -485,7 +569,7 @@ void DashboardInstrument_WindDirHistory::DrawWindSpeedScale(wxGCDC* dc) {
       (int)(m_TopLineHeight + m_DrawAreaRect.height * 0.75 - height / 2));
   m_LeftLegend = wxMax(width, m_LeftLegend);
   if (m_Properties)
-      f = m_Properties->m_SmallFont.GetChosenFont();
+      f = m_Properties->Style().m_SmallFont.GetChosenFont();
   else
       f = g_pFontSmall->GetChosenFont();
   dc->GetTextExtent(label5, &width, &height, 0, 0, &f);
@@ -511,7 +595,7 @@ void DashboardInstrument_WindDirHistory::DrawBackground(wxGCDC* dc) {
   //---------------------------------------------------------------------------------
   // horizontal lines
   //---------------------------------------------------------------------------------
-  GetGlobalColor(_T("UBLCK"), &cl);
+  cl = DashColour(DC_UBLCK);
   pen.SetColour(cl);
   dc->SetPen(pen);
   dc->DrawLine(m_LeftLegend + 3, m_TopLineHeight,
@@ -601,16 +685,16 @@ void DashboardInstrument_WindDirHistory::DrawForeground(wxGCDC* dc) {
   col = wxColour(204, 41, 41, 255);  // red, opaque Set TWD to DataFonf + Color, TWS to LabelFOnt + Color
   if (m_Properties)
   {
-      dc->SetFont(m_Properties->m_DataFont.GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_DataFont.GetColour()));
+      dc->SetFont(m_Properties->Style().m_DataFont.GetChosenFont());
+      dc->SetTextForeground(Palette().m_DataFont);
   }
   else
   {
       dc->SetFont(g_pFontData->GetChosenFont());
-      if (GetColourSchemeFont(g_pFontData->GetColour()) == GetColourSchemeFont(g_pFontLabel->GetColour()))
+      if (Palette().m_DataFont == Palette().m_LabelFont)
           dc->SetTextForeground(col);
       else
-          dc->SetTextForeground(GetColourSchemeFont(g_pFontData->GetColour()));
+          dc->SetTextForeground(Palette().m_DataFont);
   }
   if (!m_IsRunning)
     WindAngle = _T("TWD --- ");
@@ -625,7 +709,7 @@ void DashboardInstrument_WindDirHistory::DrawForeground(wxGCDC* dc) {
   }
   wxFont f;
   if (m_Properties)
-      f = m_Properties->m_DataFont.GetChosenFont();
+      f = m_Properties->Style().m_DataFont.GetChosenFont();
   else
       f = g_pFontData->GetChosenFont();
   dc->GetTextExtent(WindAngle, &degw, &degh, 0, 0, &f);
@@ -633,27 +717,27 @@ void DashboardInstrument_WindDirHistory::DrawForeground(wxGCDC* dc) {
   pen.SetStyle(wxPENSTYLE_SOLID);
   if (m_Properties) {
       #if wxCHECK_VERSION(3, 1, 6)
-      unsigned int r = GetColourSchemeFont(m_Properties->m_DataFont.GetColour()).GetRed();
-      unsigned int g = GetColourSchemeFont(m_Properties->m_DataFont.GetColour()).GetGreen();
-      unsigned int b = GetColourSchemeFont(m_Properties->m_DataFont.GetColour()).GetBlue();
+      unsigned int r = Palette().m_DataFont.GetRed();
+      unsigned int g = Palette().m_DataFont.GetGreen();
+      unsigned int b = Palette().m_DataFont.GetBlue();
       #else
-      unsigned int r = GetColourSchemeFont(m_Properties->m_DataFont.GetColour()).Red();
-      unsigned int g = GetColourSchemeFont(m_Properties->m_DataFont.GetColour()).Green();
-      unsigned int b = GetColourSchemeFont(m_Properties->m_DataFont.GetColour()).Blue();
+      unsigned int r = Palette().m_DataFont.Red();
+      unsigned int g = Palette().m_DataFont.Green();
+      unsigned int b = Palette().m_DataFont.Blue();
       #endif
       pen.SetColour(wxColour(r, g, b, 96)); // transparent
   } else {
-      if (GetColourSchemeFont(g_pFontData->GetColour()) == GetColourSchemeFont(g_pFontLabel->GetColour()))
+      if (Palette().m_DataFont == Palette().m_LabelFont)
           pen.SetColour(wxColour(204, 41, 41, 96));
       else {
           #if wxCHECK_VERSION(3, 1, 6)
-          unsigned int r = GetColourSchemeFont(g_pFontData->GetColour()).GetRed();
-          unsigned int g = GetColourSchemeFont(g_pFontData->GetColour()).GetGreen();
-          unsigned int b = GetColourSchemeFont(g_pFontData->GetColour()).GetBlue();
+          unsigned int r = Palette().m_DataFont.GetRed();
+          unsigned int g = Palette().m_DataFont.GetGreen();
+          unsigned int b = Palette().m_DataFont.GetBlue();
           #else
-          unsigned int r = GetColourSchemeFont(g_pFontData->GetColour()).Red();
-          unsigned int g = GetColourSchemeFont(g_pFontData->GetColour()).Green();
-          unsigned int b = GetColourSchemeFont(g_pFontData->GetColour()).Blue();
+          unsigned int r = Palette().m_DataFont.Red();
+          unsigned int g = Palette().m_DataFont.Green();
+          unsigned int b = Palette().m_DataFont.Blue();
           #endif
           pen.SetColour(wxColour(r, g, b, 96)); // transparent
       }
@@ -664,31 +748,14 @@ void DashboardInstrument_WindDirHistory::DrawForeground(wxGCDC* dc) {
   ratioH = (double)m_DrawAreaRect.height / m_WindDirRange;
   m_DrawAreaRect.SetWidth(m_WindowRect.width - 6 - m_LeftLegend -
                           m_RightLegend);
-  m_ratioW = double(m_DrawAreaRect.width) / (WIND_RECORD_COUNT - 1);
+  const HistoryStore& visible = m_History.GetTier(m_Tier);
+  int count = visible.GetCount();
+  m_ratioW = double(m_DrawAreaRect.width) / (count - 1);
 
   //---------------------------------------------------------------------------------
   // live direction data
   //---------------------------------------------------------------------------------
-  wxPoint points[WIND_RECORD_COUNT + 2];
-  wxPoint wdDraw[WIND_RECORD_COUNT + 2];
-  int ld = 0;
-  wdDraw[ld].x = m_ratioW + 3 + m_LeftLegend;
-  wdDraw[ld].y = m_TopLineHeight + m_DrawAreaRect.height -
-    (m_ArrayWindDirHistory[1] - m_MinWindDir) * ratioH;
-
-  for (int idx = 1; idx < WIND_RECORD_COUNT; idx++) {
-    points[idx].x = idx * m_ratioW + 3 + m_LeftLegend;
-    points[idx].y = m_TopLineHeight + m_DrawAreaRect.height -
-                    (m_ArrayWindDirHistory[idx] - m_MinWindDir) * ratioH;
-    if (WIND_RECORD_COUNT - m_SampleCount <= idx &&
-                 points[idx].y > m_TopLineHeight &&
-                 points[idx].y <= m_TopLineHeight + m_DrawAreaRect.height) {
-      wdDraw[ld] = points[idx];
-      ld++;
-    }
-  }
-  if (ld > 1)
-    dc->DrawLines(ld, wdDraw);
+  DrawTrace(dc, m_DirTrace, WH_DIR, m_MinWindDir, ratioH);
 
   //---------------------------------------------------------------------------------
   // exponential smoothing of direction
@@ -696,35 +763,18 @@ void DashboardInstrument_WindDirHistory::DrawForeground(wxGCDC* dc) {
   pen.SetStyle(wxPENSTYLE_SOLID);
   //pen.SetColour(wxColour(204, 41, 41, 255));
   if (m_Properties)
-      pen.SetColour(GetColourSchemeFont(m_Properties->m_DataFont.GetColour()));
+      pen.SetColour(Palette().m_DataFont);
   else
   {
-      if (GetColourSchemeFont(g_pFontData->GetColour()) == GetColourSchemeFont(g_pFontLabel->GetColour()))
+      if (Palette().m_DataFont == Palette().m_LabelFont)
           pen.SetColour(wxColour(204, 41, 41, 255));
       else
-          pen.SetColour(GetColourSchemeFont(g_pFontData->GetColour()));
+          pen.SetColour(Palette().m_DataFont);
   }
   pen.SetWidth(2);
   dc->SetPen(pen);
 
-  ld = 0;
-  wdDraw[ld].x = m_ratioW + 3 + m_LeftLegend;
-  wdDraw[ld].y = m_TopLineHeight + m_DrawAreaRect.height -
-    (m_ExpSmoothArrayWindDir[ld] - m_MinWindDir) * ratioH;
-
-  for (int idx = 1; idx < WIND_RECORD_COUNT; idx++) {
-    points[idx].x = idx * m_ratioW + 3 + m_LeftLegend;
-    points[idx].y = m_TopLineHeight + m_DrawAreaRect.height -
-                    (m_ExpSmoothArrayWindDir[idx] - m_MinWindDir) * ratioH;
-    if (WIND_RECORD_COUNT - m_SampleCount <= idx &&
-      points[idx].y > m_TopLineHeight &&
-      points[idx].y <= m_TopLineHeight + m_DrawAreaRect.height) {
-      wdDraw[ld] = points[idx];
-      ld++;
-    }
-  }
-  if (ld > 1)
-    dc->DrawLines(ld, wdDraw);
+  DrawTrace(dc, m_SmoothDirTrace, WH_SMOOTH_DIR, m_MinWindDir, ratioH);
 
   //---------------------------------------------------------------------------------
   // wind speed
@@ -732,16 +782,16 @@ void DashboardInstrument_WindDirHistory::DrawForeground(wxGCDC* dc) {
   col = wxColour(61, 61, 204, 255);  // blue, opaque
   if (m_Properties)
   {
-      dc->SetFont(m_Properties->m_LabelFont.GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_LabelFont.GetColour()));
+      dc->SetFont(m_Properties->Style().m_LabelFont.GetChosenFont());
+      dc->SetTextForeground(Palette().m_LabelFont);
   }
   else
   {
       dc->SetFont(g_pFontLabel->GetChosenFont());
-      if (GetColourSchemeFont(g_pFontData->GetColour()) == GetColourSchemeFont(g_pFontLabel->GetColour()))
+      if (Palette().m_DataFont == Palette().m_LabelFont)
           dc->SetTextForeground(col);
       else
-          dc->SetTextForeground(GetColourSchemeFont(g_pFontLabel->GetColour()));
+          dc->SetTextForeground(Palette().m_LabelFont);
   }
   if (!std::isnan(m_WindSpd))
     WindSpeed = wxString::Format(_T("TWS %3.1f %s "), m_WindSpd,
@@ -749,7 +799,7 @@ void DashboardInstrument_WindDirHistory::DrawForeground(wxGCDC* dc) {
   else
     WindSpeed = wxString::Format(_T("TWS --- %s "), m_WindSpeedUnit.c_str());
   if (m_Properties) {
-      f =m_Properties->m_LabelFont.GetChosenFont();
+      f =m_Properties->Style().m_LabelFont.GetChosenFont();
       dc->GetTextExtent(WindSpeed, &degw, &degh, 0, 0, &f);
   } else {
       f = g_pFontLabel->GetChosenFont();
@@ -760,26 +810,26 @@ void DashboardInstrument_WindDirHistory::DrawForeground(wxGCDC* dc) {
   int labelw, labelh;
   if (m_Properties)
   {
-      f = m_Properties->m_LabelFont.GetChosenFont();
+      f = m_Properties->Style().m_LabelFont.GetChosenFont();
       dc->GetTextExtent(WindSpeed, &labelw, &labelh, 0, 0, &f);
-      dc->SetFont(m_Properties->m_TitelFont.GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(m_Properties->m_TitelFont.GetColour()));
+      dc->SetFont(m_Properties->Style().m_TitelFont.GetChosenFont());
+      dc->SetTextForeground(Palette().m_TitleFont);
   }
   else
   {
       f = g_pFontLabel->GetChosenFont();
       dc->GetTextExtent(WindSpeed, &labelw, &labelh, 0, 0, &f);
       dc->SetFont(g_pFontTitle->GetChosenFont());
-      dc->SetTextForeground(GetColourSchemeFont(g_pFontTitle->GetColour()));
+      dc->SetTextForeground(Palette().m_TitleFont);
   }
   // determine the time range of the available data (=oldest data value)
   int i = 0;
-  while (m_ArrayRecTime[i].year == 999 && i < WIND_RECORD_COUNT - 1) i++;
-  if (i == WIND_RECORD_COUNT - 1) {
+  while (visible.GetTime(i) == 0 && i < count - 1) i++;
+  if (i == count - 1) {
     min = 0;
     hour = 0;
   } else {
-    wxDateTime localTime(m_ArrayRecTime[i]);
+    wxDateTime localTime(visible.GetTime(i));
     min = localTime.GetMinute();
     hour = localTime.GetHour();
   }
@@ -791,27 +841,27 @@ void DashboardInstrument_WindDirHistory::DrawForeground(wxGCDC* dc) {
   pen.SetStyle(wxPENSTYLE_SOLID);
   if (m_Properties) {
       #if wxCHECK_VERSION(3, 1, 6)
-      unsigned int r = GetColourSchemeFont(m_Properties->m_LabelFont.GetColour()).GetRed();
-      unsigned int g = GetColourSchemeFont(m_Properties->m_LabelFont.GetColour()).GetGreen();
-      unsigned int b = GetColourSchemeFont(m_Properties->m_LabelFont.GetColour()).GetBlue();
+      unsigned int r = Palette().m_LabelFont.GetRed();
+      unsigned int g = Palette().m_LabelFont.GetGreen();
+      unsigned int b = Palette().m_LabelFont.GetBlue();
       #else
-      unsigned int r = GetColourSchemeFont(m_Properties->m_LabelFont.GetColour()).Red();
-      unsigned int g = GetColourSchemeFont(m_Properties->m_LabelFont.GetColour()).Green();
-      unsigned int b = GetColourSchemeFont(m_Properties->m_LabelFont.GetColour()).Blue();
+      unsigned int r = Palette().m_LabelFont.Red();
+      unsigned int g = Palette().m_LabelFont.Green();
+      unsigned int b = Palette().m_LabelFont.Blue();
       #endif
       pen.SetColour(wxColour(r, g, b, 96)); // transparent
   } else {
-      if (GetColourSchemeFont(g_pFontData->GetColour()) == GetColourSchemeFont(g_pFontLabel->GetColour()))
+      if (Palette().m_DataFont == Palette().m_LabelFont)
           pen.SetColour(wxColour(61, 61, 204, 96)); // blue, transparent
       else {
           #if wxCHECK_VERSION(3, 1, 6)
-          unsigned int r = GetColourSchemeFont(g_pFontLabel->GetColour()).GetRed();
-          unsigned int g = GetColourSchemeFont(g_pFontLabel->GetColour()).GetGreen();
-          unsigned int b = GetColourSchemeFont(g_pFontLabel->GetColour()).GetBlue();
+          unsigned int r = Palette().m_LabelFont.GetRed();
+          unsigned int g = Palette().m_LabelFont.GetGreen();
+          unsigned int b = Palette().m_LabelFont.GetBlue();
           #else
-          unsigned int r = GetColourSchemeFont(g_pFontLabel->GetColour()).Red();
-          unsigned int g = GetColourSchemeFont(g_pFontLabel->GetColour()).Green();
-          unsigned int b = GetColourSchemeFont(g_pFontLabel->GetColour()).Blue();
+          unsigned int r = Palette().m_LabelFont.Red();
+          unsigned int g = Palette().m_LabelFont.Green();
+          unsigned int b = Palette().m_LabelFont.Blue();
           #endif
           pen.SetColour(wxColour(r, g, b, 96)); // transparent
       }
@@ -820,84 +870,50 @@ void DashboardInstrument_WindDirHistory::DrawForeground(wxGCDC* dc) {
   pen.SetWidth(1);
   dc->SetPen(pen);
   ratioH = (double)m_DrawAreaRect.height / m_MaxWindSpdScale;
-  wxPoint pointsSpd[WIND_RECORD_COUNT + 2];
-  wxPoint spdDraw[WIND_RECORD_COUNT + 2];
 
   //---------------------------------------------------------------------------------
   // live speed data
   //---------------------------------------------------------------------------------
-
-  int ls = 0;
-  spdDraw[ls].x = 1 * m_ratioW + 3 + m_LeftLegend;
-  spdDraw[ls].y = m_TopLineHeight + m_DrawAreaRect.height -
-                      m_ArrayWindSpdHistory[1] * ratioH;
-
-  for (int idx = 1; idx < WIND_RECORD_COUNT; idx++) {
-    pointsSpd[idx].x = idx * m_ratioW + 3 + m_LeftLegend;
-    pointsSpd[idx].y = m_TopLineHeight + m_DrawAreaRect.height -
-                       m_ArrayWindSpdHistory[idx] * ratioH;
-    if (WIND_RECORD_COUNT - m_SampleCount <= idx &&
-      pointsSpd[idx].y > m_TopLineHeight &&
-      pointsSpd[idx].y <= m_TopLineHeight + m_DrawAreaRect.height) {
-      spdDraw[ls] = pointsSpd[idx];
-      ls++;
-    }
-  }
-  if (ls > 1)
-    dc->DrawLines(ls, spdDraw);
+  DrawTrace(dc, m_SpdTrace, WH_SPD, 0., ratioH);
 
   //---------------------------------------------------------------------------------
   // exponential smoothing of speed
   //---------------------------------------------------------------------------------
   pen.SetStyle(wxPENSTYLE_SOLID);
   if (m_Properties)
-      pen.SetColour(GetColourSchemeFont(m_Properties->m_LabelFont.GetColour()));
+      pen.SetColour(Palette().m_LabelFont);
   else
   {
-      if (GetColourSchemeFont(g_pFontData->GetColour()) == GetColourSchemeFont(g_pFontLabel->GetColour()))
+      if (Palette().m_DataFont == Palette().m_LabelFont)
           pen.SetColour(wxColour(61, 61, 204, 255));  // blue, opaque
       else
-          pen.SetColour(GetColourSchemeFont(g_pFontLabel->GetColour()));
+          pen.SetColour(Palette().m_LabelFont);
   }
   //pen.SetColour(wxColour(61, 61, 204, 255));  // blue, opaque
   pen.SetWidth(2);
   dc->SetPen(pen);
-  ls = 0;
-  spdDraw[ls].x = 1 * m_ratioW + 3 + m_LeftLegend;
-  spdDraw[ls].y = m_TopLineHeight + m_DrawAreaRect.height -
-                 m_ExpSmoothArrayWindSpd[1] * ratioH;
-
-  for (int idx = 1; idx < WIND_RECORD_COUNT; idx++) {
-    pointsSpd[idx].x = idx * m_ratioW + 3 + m_LeftLegend;
-    pointsSpd[idx].y = m_TopLineHeight + m_DrawAreaRect.height -
-                       m_ExpSmoothArrayWindSpd[idx] * ratioH;
-    if (WIND_RECORD_COUNT - m_SampleCount <= idx &&
-      pointsSpd[idx].y > m_TopLineHeight &&
-      pointsSpd[idx].y <= m_TopLineHeight + m_DrawAreaRect.height) {
-      spdDraw[ls] = pointsSpd[idx];
-      ls++;
-    }
-  }
-  if (ls > 1)
-    dc->DrawLines(ls, spdDraw);
+  DrawTrace(dc, m_SmoothSpdTrace, WH_SMOOTH_SPD, 0., ratioH);
 
   //---------------------------------------------------------------------------------
-  // draw vertical timelines every 10 minutes
+  // draw vertical timelines every 10 minutes, hourly or every 6 hours
   //---------------------------------------------------------------------------------
-  GetGlobalColor(_T("DASHL"), &col);
+  col = DashColour(DC_DASHL);
   pen.SetColour(col);
   pen.SetStyle(wxPENSTYLE_DOT);
   dc->SetPen(pen);
   dc->SetTextForeground(col);
   dc->SetFont((g_pFontSmall->GetChosenFont()));
+  static const int step[HT_TIERS] = {10, 60, 360};  // minutes
   int done = -1;
   wxPoint pointTime;
-  for (int idx = 0; idx < WIND_RECORD_COUNT; idx++) {
-    if (m_ArrayRecTime[idx].year != 999) {
-      wxDateTime localTime(m_ArrayRecTime[idx]);
+  for (int idx = 0; idx < count; idx++) {
+    time_t recTime = visible.GetTime(idx);
+    if (recTime) {
+      wxDateTime localTime(recTime);
       hour = localTime.GetHour();
       min = localTime.GetMinute();
-      if ((hour * 100 + min) != done && (min % 10 == 0)) {
+      if ((hour * 100 + min) != done &&
+          ((hour * 60 + min) % step[m_Tier] == 0)) {
         pointTime.x = idx * m_ratioW + 3 + m_LeftLegend;
         dc->DrawLine(pointTime.x, m_TopLineHeight + 1, pointTime.x,
                      (m_TopLineHeight + m_DrawAreaRect.height + 1));